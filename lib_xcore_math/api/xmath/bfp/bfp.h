@@ -7,4 +7,5 @@
 #include "xmath/bfp/bfp_s32.h"
 #include "xmath/bfp/bfp_complex_s16.h"
 #include "xmath/bfp/bfp_complex_s32.h"
+#include "xmath/bfp/bfp_mat.h"
 #include "xmath/bfp/bfp_misc.h"
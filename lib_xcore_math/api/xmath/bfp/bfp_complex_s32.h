@@ -108,6 +108,70 @@ void bfp_complex_s32_dealloc(
     bfp_complex_s32_t* vector);
 
 
+/**
+ * @brief Initialize a complex 32-bit BFP vector as a view onto a contiguous slice of another.
+ *
+ * `a` is initialized so that it refers to the `length` elements of `b` beginning at element
+ * `start`. No mantissas are copied; `a->data` points into `b->data`, so the two vectors share
+ * storage. `a` takes the exponent of `b`, and the headroom of `b` (which is a safe lower bound on
+ * the headroom of any slice of `b`).
+ *
+ * The resulting view is an ordinary `bfp_complex_s32_t` and may be passed to any function in this API.
+ * This allows, for example, half of a spectrum to be processed without copying it into a separate
+ * buffer.
+ *
+ * Operations applied to the view may change its exponent, after which the elements of `b` no longer
+ * share a single exponent. Use bfp_complex_s32_merge_slice() to bring `b` and the view back to a common
+ * exponent before `b` is used again.
+ *
+ * The view does not own its mantissa buffer, and bfp_complex_s32_dealloc() does nothing when called on it.
+ *
+ * @param[out] a        BFP vector to initialize as a view
+ * @param[in]  b        Parent BFP vector
+ * @param[in]  start    Index of the first element of `b` in the view
+ * @param[in]  length   Number of elements in the view
+ *
+ * @see bfp_complex_s32_merge_slice
+ *
+ * @ingroup bfp_complex_s32_api
+ */
+C_API
+void bfp_complex_s32_slice(
+    bfp_complex_s32_t* a,
+    const bfp_complex_s32_t* b,
+    const unsigned start,
+    const unsigned length);
+
+
+/**
+ * @brief Bring a complex 32-bit BFP vector and a slice of it back to a common exponent.
+ *
+ * `b` must be a view onto a contiguous slice of `a` created with bfp_complex_s32_slice(). After the view
+ * has been operated upon, its exponent may differ from that of `a`. This function restores the
+ * invariant that all mantissas of `a` share the exponent `a->exp`, and updates the exponent and
+ * headroom of both `a` and `b`.
+ *
+ * If `b->exp` is larger than `a->exp`, the elements of `a` outside of the slice are right-shifted
+ * to the exponent of `b`. Otherwise, the elements of the slice are right-shifted to the exponent of
+ * `a`. In either case, only the elements that need to change are touched, and no element
+ * saturates.
+ *
+ * The headroom of `a` is updated conservatively (it may be smaller than the actual headroom). Use
+ * bfp_complex_s32_headroom() if the exact value is required.
+ *
+ * @param[inout] a    Parent BFP vector
+ * @param[inout] b    Slice of `a`
+ *
+ * @see bfp_complex_s32_slice
+ *
+ * @ingroup bfp_complex_s32_api
+ */
+C_API
+void bfp_complex_s32_merge_slice(
+    bfp_complex_s32_t* a,
+    bfp_complex_s32_t* b);
+
+
 /**
  * @brief Set all elements of a complex 32-bit BFP vector to a specified value.
  *
@@ -689,6 +753,77 @@ void bfp_complex_s32_mag(
     const bfp_complex_s32_t* b);
 
 
+/**
+ * @brief Convert a complex 32-bit BFP vector to polar form.
+ *
+ * Each element @math{M_k} of real output BFP vector @vector{M} is set to the magnitude of
+ * @math{B_k}, the corresponding element of complex input BFP vector @vector{B}, and each element
+ * @math{\Theta_k} of real output BFP vector @vector{\Theta} is set to its angle. Both are
+ * computed in a single pass (see vect_complex_s32_to_polar()).
+ *
+ * The exponent of @vector{\Theta} is always @math{-24}, so its mantissas are angles in radians as
+ * Q8.24 values, within @math{[-\pi, \pi]}.
+ *
+ * `a_mag`, `a_angle` and `b` must have been initialized (see bfp_s32_init() and
+ * bfp_complex_s32_init()), and must be the same length.
+ *
+ * @operation{
+ * &    M_k \leftarrow  \left| B_k \right|                              \\
+ * &    \Theta_k \leftarrow  \arg\left(B_k\right)                       \\
+ * &        \qquad\text{for } k \in 0\ ...\ (N-1)                       \\
+ * &        \qquad\text{where } N \text{ is the length of } \bar{B}
+ * }
+ *
+ * @param[out] a_mag    Output real BFP vector @vector{M}
+ * @param[out] a_angle  Output real BFP vector @vector{\Theta}
+ * @param[in]  b        Input complex BFP vector @vector{B}
+ *
+ * @see bfp_polar_to_complex_s32
+ *
+ * @ingroup bfp_complex_s32_api
+ */
+C_API
+void bfp_complex_s32_to_polar(
+    bfp_s32_t* a_mag,
+    bfp_s32_t* a_angle,
+    const bfp_complex_s32_t* b);
+
+
+/**
+ * @brief Convert a polar vector to a complex 32-bit BFP vector.
+ *
+ * Each element @math{A_k} of complex output BFP vector @vector{A} is set to the complex value with
+ * magnitude @math{M_k} and angle @math{\Theta_k}, taken from real input BFP vectors @vector{M} and
+ * @vector{\Theta} respectively. This is the inverse of bfp_complex_s32_to_polar().
+ *
+ * The exponent of @vector{\Theta} must be @math{-24}, so its mantissas are angles in radians as
+ * Q8.24 values.
+ *
+ * `a`, `b_mag` and `b_angle` must have been initialized (see bfp_s32_init() and
+ * bfp_complex_s32_init()), and must be the same length.
+ *
+ * @operation{
+ * &    A_k \leftarrow  M_k \cdot \left( cos\left(\Theta_k\right) + j\,sin\left(\Theta_k\right)
+ *                        \right)                                         \\
+ * &        \qquad\text{for } k \in 0\ ...\ (N-1)                       \\
+ * &        \qquad\text{where } N \text{ is the length of } \bar{A}
+ * }
+ *
+ * @param[out] a        Output complex BFP vector @vector{A}
+ * @param[in]  b_mag    Input real BFP vector @vector{M}
+ * @param[in]  b_angle  Input real BFP vector @vector{\Theta}
+ *
+ * @see bfp_complex_s32_to_polar
+ *
+ * @ingroup bfp_complex_s32_api
+ */
+C_API
+void bfp_polar_to_complex_s32(
+    bfp_complex_s32_t* a,
+    const bfp_s32_t* b_mag,
+    const bfp_s32_t* b_angle);
+
+
 /**
  * @brief Get the sum of elements of a complex 32-bit BFP vector.
  *
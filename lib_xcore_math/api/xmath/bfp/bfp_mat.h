@@ -0,0 +1,433 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#pragma once
+
+#include "xmath/types.h"
+
+/**
+ * @defgroup bfp_mat_api    Block Floating-Point Matrix API
+ */
+
+#ifdef __XC__
+extern "C" {
+#endif
+
+
+/**
+ * @brief Number of matrix rows processed together by the BFP matrix product functions.
+ *
+ * The matrix products compute this many output rows at once, so that each block of the
+ * right-hand operand is fetched once per group of rows rather than once per row.
+ *
+ * @ingroup bfp_mat_api
+ */
+#define BFP_MAT_ROW_BLOCK   (8)
+
+
+/**
+ * @brief Initialize a 32-bit BFP matrix.
+ *
+ * This function initializes each of the fields of BFP matrix `a`.
+ *
+ * `data` points to the memory buffer used to store elements of the matrix in row-major order, so it
+ * must be at least `rows * cols * 4` bytes long, and must begin at a word-aligned address.
+ *
+ * `exp` is the exponent assigned to the BFP matrix. The logical value associated with the element
+ * in row `i` and column `j` after initialization is @math{ data_{i \cdot cols + j} \cdot 2^{exp} }.
+ *
+ * If `calc_hr` is false, `a->hr` is initialized to 0. Otherwise, the headroom of the the BFP matrix
+ * is calculated and used to initialize `a->hr`.
+ *
+ * @param[out] a         BFP matrix to initialize
+ * @param[in]  data      `int32_t` buffer used to back `a`
+ * @param[in]  exp       Exponent of BFP matrix
+ * @param[in]  rows      Number of rows in the BFP matrix
+ * @param[in]  cols      Number of columns in the BFP matrix
+ * @param[in]  calc_hr   Boolean indicating whether the HR of the BFP matrix should be calculated
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_s32_init(
+    bfp_mat_s32_t* a,
+    int32_t* data,
+    const exponent_t exp,
+    const unsigned rows,
+    const unsigned cols,
+    const unsigned calc_hr);
+
+
+/**
+ * @brief Initialize a complex 32-bit BFP matrix.
+ *
+ * This function initializes each of the fields of BFP matrix `a`.
+ *
+ * `data` points to the memory buffer used to store elements of the matrix in row-major order, so it
+ * must be at least `rows * cols * 8` bytes long, and must begin at a word-aligned address.
+ *
+ * `exp` is the exponent assigned to the BFP matrix. The logical value associated with the element
+ * in row `i` and column `j` after initialization is @math{ data_{i \cdot cols + j} \cdot 2^{exp} }.
+ *
+ * If `calc_hr` is false, `a->hr` is initialized to 0. Otherwise, the headroom of the the BFP matrix
+ * is calculated and used to initialize `a->hr`.
+ *
+ * @param[out] a         BFP matrix to initialize
+ * @param[in]  data      `complex_s32_t` buffer used to back `a`
+ * @param[in]  exp       Exponent of BFP matrix
+ * @param[in]  rows      Number of rows in the BFP matrix
+ * @param[in]  cols      Number of columns in the BFP matrix
+ * @param[in]  calc_hr   Boolean indicating whether the HR of the BFP matrix should be calculated
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_complex_s32_init(
+    bfp_mat_complex_s32_t* a,
+    complex_s32_t* data,
+    const exponent_t exp,
+    const unsigned rows,
+    const unsigned cols,
+    const unsigned calc_hr);
+
+
+/**
+ * @brief Get the headroom of a 32-bit BFP matrix.
+ *
+ * The headroom of the matrix is the minimum headroom of any of its elements. `a->hr` is updated
+ * with the computed headroom, which is also returned.
+ *
+ * @param[inout] a    BFP matrix to get the headroom of
+ *
+ * @returns    Headroom of BFP matrix `a`
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+headroom_t bfp_mat_s32_headroom(
+    bfp_mat_s32_t* a);
+
+
+/**
+ * @brief Get the headroom of a complex 32-bit BFP matrix.
+ *
+ * The headroom of the matrix is the minimum headroom of any of its elements' real or imaginary
+ * parts. `a->hr` is updated with the computed headroom, which is also returned.
+ *
+ * @param[inout] a    BFP matrix to get the headroom of
+ *
+ * @returns    Headroom of BFP matrix `a`
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+headroom_t bfp_mat_complex_s32_headroom(
+    bfp_mat_complex_s32_t* a);
+
+
+/**
+ * @brief Transpose a 32-bit BFP matrix.
+ *
+ * `a` must have `b->cols` rows and `b->rows` columns. The transpose is performed tile by tile so
+ * that both the reads from `b` and the writes to `a` stay local.
+ *
+ * This operation cannot be performed in-place.
+ *
+ * @operation{
+ * &    A_{j,i} \leftarrow B_{i,j}                                          \\
+ * &        \qquad\text{for } i \in 0\ ...\ (M-1) \text{, } j \in 0\ ...\ (N-1)  \\
+ * &        \qquad\text{where } \bar{B} \text{ has } M \text{ rows and } N \text{ columns}
+ * }
+ *
+ * @param[out] a     Output BFP matrix @math{\bar{A}}
+ * @param[in]  b     Input BFP matrix @math{\bar{B}}
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_s32_transpose(
+    bfp_mat_s32_t* a,
+    const bfp_mat_s32_t* b);
+
+
+/**
+ * @brief Transpose a complex 32-bit BFP matrix.
+ *
+ * `a` must have `b->cols` rows and `b->rows` columns. The transpose is performed tile by tile so
+ * that both the reads from `b` and the writes to `a` stay local.
+ *
+ * This operation cannot be performed in-place.
+ *
+ * @operation{
+ * &    A_{j,i} \leftarrow B_{i,j}                                          \\
+ * &        \qquad\text{for } i \in 0\ ...\ (M-1) \text{, } j \in 0\ ...\ (N-1)  \\
+ * &        \qquad\text{where } \bar{B} \text{ has } M \text{ rows and } N \text{ columns}
+ * }
+ *
+ * @param[out] a     Output complex BFP matrix @math{\bar{A}}
+ * @param[in]  b     Input complex BFP matrix @math{\bar{B}}
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_complex_s32_transpose(
+    bfp_mat_complex_s32_t* a,
+    const bfp_mat_complex_s32_t* b);
+
+
+/**
+ * @brief Get the Hermitian (conjugate) transpose of a complex 32-bit BFP matrix.
+ *
+ * `a` must have `b->cols` rows and `b->rows` columns.
+ *
+ * Negating an imaginary part of @math{-2^{31}} saturates to @math{2^{31}-1}.
+ *
+ * This operation cannot be performed in-place.
+ *
+ * @operation{
+ * &    A_{j,i} \leftarrow (B_{i,j})^*                                      \\
+ * &        \qquad\text{for } i \in 0\ ...\ (M-1) \text{, } j \in 0\ ...\ (N-1)  \\
+ * &        \qquad\text{where } \bar{B} \text{ has } M \text{ rows and } N \text{ columns}  \\
+ * &        \qquad\text{and } (B_{i,j})^* \text{ is the complex conjugate of } B_{i,j}
+ * }
+ *
+ * @param[out] a     Output complex BFP matrix @math{\bar{A}}
+ * @param[in]  b     Input complex BFP matrix @math{\bar{B}}
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_complex_s32_hermitian(
+    bfp_mat_complex_s32_t* a,
+    const bfp_mat_complex_s32_t* b);
+
+
+/**
+ * @brief Multiply a 32-bit BFP vector by a 32-bit BFP matrix.
+ *
+ * `b` must have `c->length` columns, and `a` must have length `b->rows`.
+ *
+ * Each output element is computed as a 64-bit inner product of a row of @math{\bar{B}} with
+ * @vector{C}. Rows are processed in groups of @ref BFP_MAT_ROW_BLOCK, so that each block of
+ * @vector{C} is loaded once per group of rows.
+ *
+ * The output exponent is chosen so that the result cannot saturate for any input with the given
+ * headroom.
+ *
+ * This operation cannot be performed in-place on `c`.
+ *
+ * @operation{
+ * &    A_i \leftarrow \sum_{k=0}^{N-1} \left( B_{i,k} \cdot C_k \right)    \\
+ * &        \qquad\text{for } i \in 0\ ...\ (M-1)                           \\
+ * &        \qquad\text{where } \bar{B} \text{ has } M \text{ rows and } N \text{ columns}
+ * }
+ *
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP matrix @math{\bar{B}}
+ * @param[in]  c     Input BFP vector @vector{C}
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_s32_mul_vect(
+    bfp_s32_t* a,
+    const bfp_mat_s32_t* b,
+    const bfp_s32_t* c);
+
+
+/**
+ * @brief Multiply a complex 32-bit BFP vector by a complex 32-bit BFP matrix.
+ *
+ * `b` must have `c->length` columns, and `a` must have length `b->rows`.
+ *
+ * Each output element is computed from 64-bit inner products of a row of @math{\bar{B}} with
+ * @vector{C}. Rows are processed in groups of @ref BFP_MAT_ROW_BLOCK, so that each block of
+ * @vector{C} is loaded once per group of rows.
+ *
+ * The output exponent is chosen so that the result cannot saturate for any input with the given
+ * headroom.
+ *
+ * This operation cannot be performed in-place on `c`.
+ *
+ * @operation{
+ * &    A_i \leftarrow \sum_{k=0}^{N-1} \left( B_{i,k} \cdot C_k \right)    \\
+ * &        \qquad\text{for } i \in 0\ ...\ (M-1)                           \\
+ * &        \qquad\text{where } \bar{B} \text{ has } M \text{ rows and } N \text{ columns}
+ * }
+ *
+ * @param[out] a     Output complex BFP vector @vector{A}
+ * @param[in]  b     Input complex BFP matrix @math{\bar{B}}
+ * @param[in]  c     Input complex BFP vector @vector{C}
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_complex_s32_mul_vect(
+    bfp_complex_s32_t* a,
+    const bfp_mat_complex_s32_t* b,
+    const bfp_complex_s32_t* c);
+
+
+/**
+ * @brief Multiply two 32-bit BFP matrices.
+ *
+ * `b` must have `c->rows` columns, and `a` must have `b->rows` rows and `c->cols` columns.
+ *
+ * Each output element is computed as a 64-bit inner product of a row of @math{\bar{B}} with a
+ * column of @math{\bar{C}}. Columns of @math{\bar{C}} are gathered in blocks which are reused
+ * across @ref BFP_MAT_ROW_BLOCK rows of @math{\bar{B}}.
+ *
+ * The output exponent is chosen so that the result cannot saturate for any input with the given
+ * headroom.
+ *
+ * This operation cannot be performed in-place.
+ *
+ * @operation{
+ * &    A_{i,j} \leftarrow \sum_{k=0}^{K-1} \left( B_{i,k} \cdot C_{k,j} \right)       \\
+ * &        \qquad\text{for } i \in 0\ ...\ (M-1) \text{, } j \in 0\ ...\ (N-1)        \\
+ * &        \qquad\text{where } \bar{B} \text{ is } M \times K
+ *              \text{ and } \bar{C} \text{ is } K \times N
+ * }
+ *
+ * @param[out] a     Output BFP matrix @math{\bar{A}}
+ * @param[in]  b     Input BFP matrix @math{\bar{B}}
+ * @param[in]  c     Input BFP matrix @math{\bar{C}}
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_s32_mul(
+    bfp_mat_s32_t* a,
+    const bfp_mat_s32_t* b,
+    const bfp_mat_s32_t* c);
+
+
+/**
+ * @brief Multiply two complex 32-bit BFP matrices.
+ *
+ * `b` must have `c->rows` columns, and `a` must have `b->rows` rows and `c->cols` columns.
+ *
+ * Each output element is computed from 64-bit inner products of a row of @math{\bar{B}} with a
+ * column of @math{\bar{C}}. Columns of @math{\bar{C}} are gathered in blocks which are reused
+ * across @ref BFP_MAT_ROW_BLOCK rows of @math{\bar{B}}.
+ *
+ * The output exponent is chosen so that the result cannot saturate for any input with the given
+ * headroom.
+ *
+ * This operation cannot be performed in-place.
+ *
+ * @operation{
+ * &    A_{i,j} \leftarrow \sum_{k=0}^{K-1} \left( B_{i,k} \cdot C_{k,j} \right)       \\
+ * &        \qquad\text{for } i \in 0\ ...\ (M-1) \text{, } j \in 0\ ...\ (N-1)        \\
+ * &        \qquad\text{where } \bar{B} \text{ is } M \times K
+ *              \text{ and } \bar{C} \text{ is } K \times N
+ * }
+ *
+ * @param[out] a     Output complex BFP matrix @math{\bar{A}}
+ * @param[in]  b     Input complex BFP matrix @math{\bar{B}}
+ * @param[in]  c     Input complex BFP matrix @math{\bar{C}}
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_complex_s32_mul(
+    bfp_mat_complex_s32_t* a,
+    const bfp_mat_complex_s32_t* b,
+    const bfp_mat_complex_s32_t* c);
+
+
+/**
+ * @brief Initialize a batch of complex 32-bit BFP matrices.
+ *
+ * This function initializes each of the fields of the matrix batch `a`. The exponents in `exp[]`
+ * are not modified.
+ *
+ * `data` must be at least `rows * cols * count * 8` bytes long and must begin at a word-aligned
+ * address. See @ref bfp_mat_complex_s32_batch_t for the element layout.
+ *
+ * @param[out] a         Matrix batch to initialize
+ * @param[in]  data      `complex_s32_t` buffer used to back `a`
+ * @param[in]  exp       Buffer of `count` per-matrix exponents
+ * @param[in]  rows      Number of rows in each matrix
+ * @param[in]  cols      Number of columns in each matrix
+ * @param[in]  count     Number of matrices in the batch
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_complex_s32_batch_init(
+    bfp_mat_complex_s32_batch_t* a,
+    complex_s32_t* data,
+    exponent_t* exp,
+    const unsigned rows,
+    const unsigned cols,
+    const unsigned count);
+
+
+/**
+ * @brief Cholesky-factorize a batch of complex Hermitian positive-definite matrices.
+ *
+ * For each matrix @math{\bar{R}_b} in the batch `r` (e.g. a spatial covariance matrix per
+ * frequency bin), computes the lower-triangular matrix @math{\bar{L}_b} with real, positive
+ * diagonal such that @math{\bar{R}_b = \bar{L}_b \bar{L}_b^H}. Only the lower triangle of each
+ * @math{\bar{R}_b} is read. The upper triangle of each @math{\bar{L}_b} is set to zero.
+ *
+ * Each matrix is first normalized by its own exponent, after which the factorization proceeds as
+ * fixed-point arithmetic which is identical across the batch. Because of the storage layout (see
+ * @ref bfp_mat_complex_s32_batch_t), the inner-product updates are performed by the vector
+ * kernels with the batch as the vector dimension. Only the square root and reciprocal of each
+ * pivot are computed per matrix.
+ *
+ * Every element of @math{\bar{L}_b} is bounded by the square root of the largest diagonal element
+ * of @math{\bar{R}_b}, so the output mantissas do not saturate for positive-definite input.
+ * Pivots which are not positive (because the input is singular or indefinite) are clamped to the
+ * smallest positive value. Diagonal loading should be applied to ill-conditioned inputs.
+ *
+ * `l` and `r` must both contain `count` square `N`x`N` matrices. This operation can be performed
+ * in-place on `r`.
+ *
+ * @param[out] l     Output batch of lower-triangular factors
+ * @param[in]  r     Input batch of Hermitian positive-definite matrices
+ *
+ * @see bfp_mat_complex_s32_cholesky_solve_batch
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_complex_s32_cholesky_batch(
+    bfp_mat_complex_s32_batch_t* l,
+    const bfp_mat_complex_s32_batch_t* r);
+
+
+/**
+ * @brief Solve a batch of complex Hermitian linear systems from their Cholesky factors.
+ *
+ * For each matrix in the batch, solves @math{\bar{L}_b \bar{L}_b^H \bar{x}_b = \bar{y}_b} for
+ * @math{\bar{x}_b} by forward- and back-substitution, where @math{\bar{L}_b} was produced by
+ * bfp_mat_complex_s32_cholesky_batch(). For an MVDR beamformer, @math{\bar{y}_b} is the steering
+ * vector and @math{\bar{x}_b = \bar{R}_b^{-1} \bar{y}_b}.
+ *
+ * `y` and `x` are batches of `N`x`1` column vectors with the same `count` as `l`. Each vector keeps
+ * its own exponent, which is adjusted whenever a substitution step would otherwise overflow, so the
+ * solution is not limited by the conditioning of the other matrices in the batch. The
+ * substitution updates are performed by the vector kernels across the batch.
+ *
+ * This operation can be performed in-place on `y`.
+ *
+ * @param[out] x     Output batch of solution vectors
+ * @param[in]  l     Input batch of Cholesky factors
+ * @param[in]  y     Input batch of right-hand side vectors
+ *
+ * @see bfp_mat_complex_s32_cholesky_batch
+ *
+ * @ingroup bfp_mat_api
+ */
+C_API
+void bfp_mat_complex_s32_cholesky_solve_batch(
+    bfp_mat_complex_s32_batch_t* x,
+    const bfp_mat_complex_s32_batch_t* l,
+    const bfp_mat_complex_s32_batch_t* y);
+
+#ifdef __XC__
+}   //extern "C"
+#endif
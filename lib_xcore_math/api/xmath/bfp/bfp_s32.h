@@ -109,6 +109,70 @@ void bfp_s32_dealloc(
     bfp_s32_t* vector);
 
 
+/**
+ * @brief Initialize a 32-bit BFP vector as a view onto a contiguous slice of another.
+ *
+ * `a` is initialized so that it refers to the `length` elements of `b` beginning at element
+ * `start`. No mantissas are copied; `a->data` points into `b->data`, so the two vectors share
+ * storage. `a` takes the exponent of `b`, and the headroom of `b` (which is a safe lower bound on
+ * the headroom of any slice of `b`).
+ *
+ * The resulting view is an ordinary `bfp_s32_t` and may be passed to any function in this API.
+ * This allows, for example, half of a spectrum to be processed without copying it into a separate
+ * buffer.
+ *
+ * Operations applied to the view may change its exponent, after which the elements of `b` no longer
+ * share a single exponent. Use bfp_s32_merge_slice() to bring `b` and the view back to a common
+ * exponent before `b` is used again.
+ *
+ * The view does not own its mantissa buffer, and bfp_s32_dealloc() does nothing when called on it.
+ *
+ * @param[out] a        BFP vector to initialize as a view
+ * @param[in]  b        Parent BFP vector
+ * @param[in]  start    Index of the first element of `b` in the view
+ * @param[in]  length   Number of elements in the view
+ *
+ * @see bfp_s32_merge_slice
+ *
+ * @ingroup bfp_s32_api
+ */
+C_API
+void bfp_s32_slice(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const unsigned start,
+    const unsigned length);
+
+
+/**
+ * @brief Bring a 32-bit BFP vector and a slice of it back to a common exponent.
+ *
+ * `b` must be a view onto a contiguous slice of `a` created with bfp_s32_slice(). After the view
+ * has been operated upon, its exponent may differ from that of `a`. This function restores the
+ * invariant that all mantissas of `a` share the exponent `a->exp`, and updates the exponent and
+ * headroom of both `a` and `b`.
+ *
+ * If `b->exp` is larger than `a->exp`, the elements of `a` outside of the slice are right-shifted
+ * to the exponent of `b`. Otherwise, the elements of the slice are right-shifted to the exponent of
+ * `a`. In either case, only the elements that need to change are touched, and no element
+ * saturates.
+ *
+ * The headroom of `a` is updated conservatively (it may be smaller than the actual headroom). Use
+ * bfp_s32_headroom() if the exact value is required.
+ *
+ * @param[inout] a    Parent BFP vector
+ * @param[inout] b    Slice of `a`
+ *
+ * @see bfp_s32_slice
+ *
+ * @ingroup bfp_s32_api
+ */
+C_API
+void bfp_s32_merge_slice(
+    bfp_s32_t* a,
+    bfp_s32_t* b);
+
+
 /**
  * @brief Set all elements of a 32-bit BFP vector to a specified value.
  *
@@ -679,6 +743,79 @@ void bfp_s32_inverse(
     const bfp_s32_t* b);
 
 
+/**
+ * @brief Divide one 32-bit BFP vector by another, elementwise.
+ *
+ * Each element @math{B_k} of input BFP vector @vector{B} is divided by the corresponding element
+ * @math{C_k} of input BFP vector @vector{C}, and the results are stored in output BFP vector
+ * @vector{A}.
+ *
+ * Unlike computing bfp_s32_inverse() followed by bfp_s32_mul(), this is done in a single pass and
+ * each output mantissa is the correctly rounded quotient.
+ *
+ * `a`, `b` and `c` must have been initialized (see bfp_s32_init()), and must be the same length.
+ *
+ * This operation can be performed safely in-place on `b` or `c`.
+ *
+ * @operation{
+ * &     A_k \leftarrow \frac{B_k}{C_k}                \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)   \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{A}\text{, } \bar{B}\text{ and } \bar{C}
+ * }
+ *
+ * @par Division by Zero
+ * @parblock
+ * Where @math{C_k = 0}, the output mantissa saturates according to the sign of @math{B_k} (or is
+ * @math{0} if @math{B_k} is also @math{0}). Zero divisors are ignored when choosing the output
+ * exponent, so they do not reduce the precision of the other outputs.
+ * @endparblock
+ *
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Dividend BFP vector @vector{B}
+ * @param[in]  c     Divisor BFP vector @vector{C}
+ *
+ * @see vect_s32_divide
+ *
+ * @ingroup bfp_s32_api
+ */
+C_API
+void bfp_s32_divide(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c);
+
+
+/**
+ * @brief Compute the softmax of a 32-bit BFP vector.
+ *
+ * Computes the softmax of input BFP vector @vector{B} and stores the result in output BFP vector
+ * @vector{A}. The elements of @vector{A} are non-negative and sum to 1.
+ *
+ * The computation is numerically stable for any input exponent: the largest element of @vector{B}
+ * is subtracted before exponentiating (with vect_s32_exp()), so no exponential exceeds 1, and the
+ * results are then normalized by the inverse of their sum.
+ *
+ * `a` and `b` must have been initialized (see bfp_s32_init()), and must be the same length.
+ *
+ * This operation can be performed safely in-place on `b`.
+ *
+ * @operation{
+ * &     A_k \leftarrow \frac{e^{B_k}}{\sum_{j=0}^{N-1} e^{B_j}}      \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)   \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B}
+ * }
+ *
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ *
+ * @ingroup bfp_s32_api
+ */
+C_API
+void bfp_s32_softmax(
+    bfp_s32_t* a,
+    const bfp_s32_t* b);
+
+
 /**
  * @brief Sum the absolute values of elements of a 32-bit BFP vector.
  *
@@ -599,6 +599,102 @@ void dct64_inverse(
     const int32_t x[64]);
 
 
+/**
+ * @brief Even-length 32-bit forward DCT.
+ * 
+ * This function performs an @math{N}-point forward type-II DCT on block floating-point input
+ * vector @vector{x}, in-place, where @math{N} is `dct_length`.
+ * 
+ * `x[]` is interpreted to be a block floating-point vector with shared exponent `*exp` and with 
+ * `*hr` bits of headroom. Upon completion, `*exp` and `*hr` are updated with the exponent and
+ * headroom of the result in `x[]`.
+ * 
+ * If @math{N} is one of 6, 8, 12, 16, 24, 32, 48 or 64, the corresponding fixed-length DCT (e.g.
+ * `dct24_forward()`) is used and `scratch` is unused. Otherwise, @math{N} may be any even length,
+ * and the DCT is computed with an @math{N/2}-point complex DFT together with pre- and
+ * post-processing of cost @math{O(N)}. In that case `scratch` must point to a buffer of at least
+ * @math{N} words, and the contents of `scratch` are clobbered.
+ * 
+ * Writing @math{N/2 = P\cdot m}, where @math{P} is the largest power of 2 which divides
+ * @math{N/2} and @math{m} is odd, the DFT is computed with @math{m} radix-2 FFTs of length
+ * @math{P} (using `fft_dit_forward()`) following direct @math{m}-point DFTs, at a cost of
+ * @math{O(N (m + \log_2 P))}. If @math{P < 4} the whole @math{N/2}-point DFT is computed
+ * directly. @math{P} must be no larger than `(1<<MAX_DIT_FFT_LOG2)`. Powers of 2
+ * no larger than `(1<<(MAX_DIT_FFT_LOG2-2))` use a single FFT and look-up table twiddle factors,
+ * and are the fastest. Lengths with a small odd factor, such as 40 or 80 (@math{m = 5}), are
+ * still efficient. Lengths with a large odd factor (e.g. 2 times a large prime) approach
+ * @math{O(N^2)}. Twiddle factors which are not in the look-up table are computed as needed with
+ * `sbrad_sin()`.
+ * 
+ * `x` and `scratch` must point to 8-byte-aligned addresses.
+ * 
+ * @operation{
+ * &   x_k \leftarrow  2\sum_{n=0}^{N-1} x_n \cos\left( k\pi \frac{2n+1}{2N} \right) \\
+ * &   \qquad\text{for } k = 0,1,\dots,(N-1) \\
+ * }
+ * 
+ * @param[inout]  x           Input/output vector @vector{x}
+ * @param[in]     scratch     Scratch buffer of `dct_length` words
+ * @param[in]     dct_length  Length @math{N} of the DCT
+ * @param[inout]  hr          Headroom of `x[]`
+ * @param[inout]  exp         Exponent associated with `x[]`
+ * 
+ * @exception ET_LOAD_STORE Raised if `x` or `scratch` is not double word-aligned (See @ref 
+ *                          note_vector_alignment)
+ * 
+ * @ingroup dct_api
+ */
+C_API
+void dct_forward(
+    int32_t x[],
+    int32_t scratch[],
+    const unsigned dct_length,
+    headroom_t* hr,
+    exponent_t* exp);
+
+
+/**
+ * @brief Even-length 32-bit inverse DCT.
+ * 
+ * This function performs an @math{N}-point inverse DCT (same as type-III DCT) on block
+ * floating-point input vector @vector{x}, in-place, where @math{N} is `dct_length`. This is the
+ * inverse of `dct_forward()`.
+ * 
+ * `x[]` is interpreted to be a block floating-point vector with shared exponent `*exp` and with 
+ * `*hr` bits of headroom. Upon completion, `*exp` and `*hr` are updated with the exponent and
+ * headroom of the result in `x[]`.
+ * 
+ * The supported lengths, the algorithm and the requirements on `scratch` are the same as for
+ * `dct_forward()`, with `fft_dit_inverse()` in place of `fft_dit_forward()`.
+ * 
+ * `x` and `scratch` must point to 8-byte-aligned addresses.
+ * 
+ * @operation{
+ * &   x_k \leftarrow  \frac{1}{N} \left(  \frac{x_0}{2} + \ 
+ *          \sum_{n=1}^{N-1} x_n \cos\left( n\pi \frac{2k+1}{2N} \right) \right) \\
+ * &   \qquad\text{for } k = 0,1,\dots,(N-1) \\
+ * }
+ * 
+ * @param[inout]  x           Input/output vector @vector{x}
+ * @param[in]     scratch     Scratch buffer of `dct_length` words
+ * @param[in]     dct_length  Length @math{N} of the DCT
+ * @param[inout]  hr          Headroom of `x[]`
+ * @param[inout]  exp         Exponent associated with `x[]`
+ * 
+ * @exception ET_LOAD_STORE Raised if `x` or `scratch` is not double word-aligned (See @ref 
+ *                          note_vector_alignment)
+ * 
+ * @ingroup dct_api
+ */
+C_API
+void dct_inverse(
+    int32_t x[],
+    int32_t scratch[],
+    const unsigned dct_length,
+    headroom_t* hr,
+    exponent_t* exp);
+
+
 
 
 /**
@@ -683,6 +779,404 @@ headroom_t dct8x8_inverse(
     const int8_t x[8][8],
     const right_shift_t sat);
 
+/**
+ * @brief 16-by-16 2D 8-bit forward DCT.
+ * 
+ * This function performs a 2-dimensional 16-by-16 type-II DCT on 8-bit input tensor @vector{x}
+ * (with elements @math{x_{rc}}). Output tensor @vector{y} (with elements @math{y_{rc}}) is
+ * populated with the result.
+ * 
+ * This 2D DCT is performed by first applying a 1D 16-point DCT across each row of @vector{x}, and
+ * then applying a 1D 16-point DCT to each column of that intermediate tensor.
+ * 
+ * The output is scaled by a factor of @math{2^{-\mathtt{sat}-10}}. With @math{\mathtt{sat}=0} this
+ * scaling is just enough to avoid any possible saturation. If saturation is considered acceptable,
+ * or known _a priori_ to not be possible, negative values for @math{\mathtt{sat}} can be used to
+ * increase precision on the output.
+ * 
+ * This operation may be safely performed in-place if `x` and `y` point to the same vector.
+ * 
+ * @operation{
+ * &  y_{rc} \leftarrow \frac{4 \sum_{m=0}^{N-1} \sum_{n=0}^{N-1} \left( \
+ *        x_{mn} \cos\left( c\pi\frac{2n+1}{2N} \right) \cos\left(r\pi\frac{2m+1}{2N}  \right)\right)}{2^{\mathtt{sat}+10}}\\
+ * &   \\
+ * &   \qquad\text{for } r,c \in \\{0,1,\dots,(N-1)\\} \\
+ * &   \qquad\text{with } N = 16 \\
+ * }
+ * 
+ * @param[out]  y    Output vector @vector{y}
+ * @param[in]   x    Input vector @vector{x}
+ * @param[in]   sat  Additional output scaling exponent.
+ * 
+ * @returns Headroom of the output @vector{y}
+ * 
+ * @see dct16x16_forward_image
+ * 
+ * @ingroup dct_api
+ */
+C_API
+headroom_t dct16x16_forward(
+    int8_t y[16][16],
+    const int8_t x[16][16],
+    const right_shift_t sat);
+
+/**
+ * @brief 16-by-16 2D 8-bit inverse DCT.
+ * 
+ * This function performs a 2-dimensional 16-by-16 type-III (inverse) DCT on 8-bit input tensor
+ * @vector{x} (with elements @math{x_{rc}}). Output tensor @vector{y} (with elements @math{y_{rc}})
+ * is populated with the result.
+ * 
+ * This 2D DCT is performed by first applying a 1D 16-point DCT across each row of @vector{x}, and
+ * then applying a 1D 16-point DCT to each column of that intermediate tensor.
+ * 
+ * The output is scaled by a factor of @math{2^{-\mathtt{sat}}}. With @math{\mathtt{sat}=0} this
+ * scaling is just enough to avoid any possible saturation. If saturation is considered acceptable,
+ * or known _a priori_ to not be possible, negative values for @math{\mathtt{sat}} can be used to
+ * increase precision on the output.
+ * 
+ * This operation may be safely performed in-place if `x` and `y` point to the same vector.
+ * 
+ * @operation{
+ * &  y_{rc} \leftarrow \frac{ \frac{1}{N^2} \sum_{m=0}^{N-1} \sum_{n=0}^{N-1} \left( \
+ *        x_{mn} \cos\left( n\pi\frac{2c+1}{2N} \right) \cos\left(m\pi\frac{2r+1}{2N}  \right)\right)}{2^{\mathtt{sat}}}\\
+ * &   \\
+ * &   \qquad\text{for } r,c \in \\{0,1,\dots,(N-1)\\} \\
+ * &   \qquad\text{with } N = 16 \\
+ * }
+ * 
+ * @param[out]  y    Output vector @vector{y}
+ * @param[in]   x    Input vector @vector{x}
+ * @param[in]   sat  Additional output scaling exponent.
+ * 
+ * @returns Headroom of the output @vector{y}
+ * 
+ * @see dct16x16_inverse_image
+ * 
+ * @ingroup dct_api
+ */
+C_API
+headroom_t dct16x16_inverse(
+    int8_t y[16][16],
+    const int8_t x[16][16],
+    const right_shift_t sat);
+
+/**
+ * @brief 8-by-8 2D 8-bit forward DCT of every block of an image.
+ * 
+ * The 8-bit image @vector{x} is @math{W} pixels wide and @math{H} pixels high, with consecutive
+ * rows of the image starting `x_stride` elements apart. Both @math{W} and @math{H} must be
+ * multiples of 8. The image is divided into @math{\frac{W}{8}\cdot\frac{H}{8}} 8-by-8 blocks,
+ * which are visited in raster order (left to right, and then top to bottom). The 2D DCT of the
+ * @math{b}th block is placed in `y[b]`, scaled as described for `dct8x8_forward()`.
+ * 
+ * This gives the same result as calling `dct8x8_forward()` on each block in turn, but saves the
+ * caller from having to copy each block out of the image, and the transform set-up is only done
+ * once for the whole image.
+ * 
+ * If `quant` is not `NULL`, it points to a table of quantiser step sizes @math{q_{rc}} (which must
+ * all be non-zero), and quantisation is fused into the output stage of each DCT. Each output
+ * element is then @math{\mathrm{round}(y_{rc}/q_{rc})} (saturated to 8 bits), where @math{y_{rc}}
+ * is the unquantised output with full precision.
+ * 
+ * `y` must point to an 8-byte-aligned address. `x` need not be aligned.
+ * 
+ * @param[out]  y         Output blocks, in raster order
+ * @param[in]   x         Input image @vector{x}
+ * @param[in]   width     Width of the image @math{W}, in pixels
+ * @param[in]   height    Height of the image @math{H}, in pixels
+ * @param[in]   x_stride  Number of elements between the starts of consecutive rows of @vector{x}
+ * @param[in]   sat       Additional output scaling exponent.
+ * @param[in]   quant     Quantiser step sizes @math{q_{rc}}, or `NULL` for no quantisation
+ * 
+ * @returns Headroom of the output blocks
+ * 
+ * @exception ET_LOAD_STORE Raised if `y` is not double word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see dct8x8_forward
+ * 
+ * @ingroup dct_api
+ */
+C_API
+headroom_t dct8x8_forward_image(
+    int8_t y[][8][8],
+    const int8_t x[],
+    const unsigned width,
+    const unsigned height,
+    const unsigned x_stride,
+    const right_shift_t sat,
+    const uint8_t quant[8][8]);
+
+/**
+ * @brief 8-by-8 2D 8-bit inverse DCT of every block of an image.
+ * 
+ * This is the inverse of `dct8x8_forward_image()`. Input `x[b]` holds the 2D DCT of the
+ * @math{b}th 8-by-8 block of the @math{W}-by-@math{H} output image @vector{y}, with blocks in
+ * raster order (left to right, and then top to bottom). Each block is transformed as by
+ * `dct8x8_inverse()` and placed in @vector{y}, whose consecutive rows start `y_stride` elements
+ * apart. Both @math{W} and @math{H} must be multiples of 8.
+ * 
+ * `x` must point to an 8-byte-aligned address. `y` need not be aligned.
+ * 
+ * @param[out]  y         Output image @vector{y}
+ * @param[in]   x         Input blocks, in raster order
+ * @param[in]   width     Width of the image @math{W}, in pixels
+ * @param[in]   height    Height of the image @math{H}, in pixels
+ * @param[in]   y_stride  Number of elements between the starts of consecutive rows of @vector{y}
+ * @param[in]   sat       Additional output scaling exponent.
+ * 
+ * @returns Headroom of the output image
+ * 
+ * @exception ET_LOAD_STORE Raised if `x` is not double word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see dct8x8_inverse
+ * 
+ * @ingroup dct_api
+ */
+C_API
+headroom_t dct8x8_inverse_image(
+    int8_t y[],
+    const int8_t x[][8][8],
+    const unsigned width,
+    const unsigned height,
+    const unsigned y_stride,
+    const right_shift_t sat);
+
+/**
+ * @brief 16-by-16 2D 8-bit forward DCT of every block of an image.
+ * 
+ * As `dct8x8_forward_image()`, but with 16-by-16 blocks, each transformed as by
+ * `dct16x16_forward()`. Both @math{W} and @math{H} must be multiples of 16.
+ * 
+ * @param[out]  y         Output blocks, in raster order
+ * @param[in]   x         Input image @vector{x}
+ * @param[in]   width     Width of the image @math{W}, in pixels
+ * @param[in]   height    Height of the image @math{H}, in pixels
+ * @param[in]   x_stride  Number of elements between the starts of consecutive rows of @vector{x}
+ * @param[in]   sat       Additional output scaling exponent.
+ * @param[in]   quant     Quantiser step sizes @math{q_{rc}}, or `NULL` for no quantisation
+ * 
+ * @returns Headroom of the output blocks
+ * 
+ * @see dct16x16_forward
+ * 
+ * @ingroup dct_api
+ */
+C_API
+headroom_t dct16x16_forward_image(
+    int8_t y[][16][16],
+    const int8_t x[],
+    const unsigned width,
+    const unsigned height,
+    const unsigned x_stride,
+    const right_shift_t sat,
+    const uint8_t quant[16][16]);
+
+/**
+ * @brief 16-by-16 2D 8-bit inverse DCT of every block of an image.
+ * 
+ * As `dct8x8_inverse_image()`, but with 16-by-16 blocks, each transformed as by
+ * `dct16x16_inverse()`. Both @math{W} and @math{H} must be multiples of 16.
+ * 
+ * @param[out]  y         Output image @vector{y}
+ * @param[in]   x         Input blocks, in raster order
+ * @param[in]   width     Width of the image @math{W}, in pixels
+ * @param[in]   height    Height of the image @math{H}, in pixels
+ * @param[in]   y_stride  Number of elements between the starts of consecutive rows of @vector{y}
+ * @param[in]   sat       Additional output scaling exponent.
+ * 
+ * @returns Headroom of the output image
+ * 
+ * @see dct16x16_inverse
+ * 
+ * @ingroup dct_api
+ */
+C_API
+headroom_t dct16x16_inverse_image(
+    int8_t y[],
+    const int8_t x[][16][16],
+    const unsigned width,
+    const unsigned height,
+    const unsigned y_stride,
+    const right_shift_t sat);
+
+
+
+/**
+ * @brief Number of `int32_t` words required for the buffer of an `mdct_s32_t`.
+ *
+ * @param FRAME_LENGTH  Number of new samples (and of MDCT coefficients) per frame
+ *
+ * @see mdct_init
+ *
+ * @ingroup dct_api
+ */
+#define MDCT_S32_BUFFER_WORDS(FRAME_LENGTH)                                               \
+    (4*(FRAME_LENGTH) + ((((FRAME_LENGTH) % 3) == 0)? (2*(FRAME_LENGTH))/3 : 0))
+
+
+/**
+ * @brief 32-bit block floating-point MDCT / IMDCT with time-domain aliasing cancellation.
+ *
+ * @par Transform
+ * @parblock
+ *
+ * This struct holds the configuration and state of a modified discrete cosine transform with a
+ * frame length (hop size) of @math{F} and a block length of @math{N = 2F}. Each call to
+ * `mdct_forward()` takes @math{F} new samples, which together with the @math{F} samples of the
+ * previous call form the block @math{x[n]}, and computes @math{F} coefficients
+ *
+ * @math{ X[k] = \sum_{n=0}^{N-1} w[n] x[n] \cos\left( \frac{\pi}{F}
+ *         \left(n + \frac{1}{2} + \frac{F}{2}\right)\left(k + \frac{1}{2}\right) \right) }
+ *
+ * Each call to `mdct_inverse()` takes @math{F} coefficients and computes the block
+ *
+ * @math{ y[n] = \frac{2}{F} w[n] \sum_{k=0}^{F-1} X[k] \cos\left( \frac{\pi}{F}
+ *         \left(n + \frac{1}{2} + \frac{F}{2}\right)\left(k + \frac{1}{2}\right) \right) }
+ *
+ * whose first half is added to the second half of the previous block to give @math{F} output
+ * samples. If the window satisfies the Princen-Bradley condition @math{w[n]^2 + w[n+F]^2 = 1}
+ * (e.g. the sine window or a Kaiser-Bessel-derived window), the output of `mdct_inverse()` applied
+ * to the output of `mdct_forward()` reproduces the input, delayed by one frame.
+ * @endparblock
+ *
+ * @par Notes
+ * @parblock
+ *
+ * 1. Both directions are computed as a DCT-IV using an @math{F/2}-point complex FFT
+ *    (`bfp_fft_forward_complex()`), with the window, folding and pre-rotation fused into a single
+ *    pass before the FFT and the post-rotation (and, for the inverse, unfolding, windowing and
+ *    overlap-add) in a single pass after it.
+ *
+ * 2. @math{F} must be either @math{2^p} or @math{3\cdot 2^p}. In the latter case the FFT is
+ *    split into three @math{2^{p-1}}-point FFTs followed by a radix-3 pass.
+ *
+ * 3. The state holds the previous input frame (forward) or the second half of the previous block
+ *    (inverse), so a single instance must only be used for one direction.
+ * @endparblock
+ *
+ * @see mdct_init,
+ *      mdct_forward,
+ *      mdct_inverse
+ *
+ * @ingroup dct_api
+ */
+C_API
+typedef struct {
+    /**
+     * Frame length @math{F}.
+     */
+    unsigned frame_length;
+
+    /**
+     * The @math{2F}-element window @math{w[n]}.
+     */
+    const q2_30* window;
+
+    /**
+     * Buffer of @math{F/2} elements in which the FFT is computed.
+     */
+    complex_s32_t* scratch;
+
+    /**
+     * Rotation applied before the FFT, @math{e^{-j\pi(4k+1)/(4F)}}.
+     */
+    complex_s32_t* pre_twiddle;
+
+    /**
+     * Rotation applied after the FFT, @math{e^{-j\pi k/F}}.
+     */
+    complex_s32_t* post_twiddle;
+
+    /**
+     * Twiddle factors of the radix-3 pass, or `NULL` if @math{F} is a power of 2.
+     */
+    complex_s32_t* radix3_twiddle;
+
+    /**
+     * Previous input frame (forward) or second half of the previous output block (inverse).
+     */
+    bfp_s32_t state;
+} mdct_s32_t;
+
+
+/**
+ * @brief Initialize an MDCT.
+ *
+ * Computes the rotations used by the transform and clears its state.
+ *
+ * `buffer` must be `MDCT_S32_BUFFER_WORDS(frame_length)` words long and 8-byte-aligned. `window`
+ * must be `2*frame_length` elements long; it is not copied, so it must remain valid while the
+ * MDCT is in use.
+ *
+ * `frame_length` must be @math{2^p} or @math{3\cdot 2^p}. The FFT length `frame_length/2` (or,
+ * for @math{3\cdot 2^p}, `frame_length/6`) must be at least 4 and no larger than
+ * `(1<<MAX_DIT_FFT_LOG2)`.
+ *
+ * See `mdct_s32_t` for more information about the MDCT and its operation.
+ *
+ * @param[out]  mdct          MDCT struct to be initialized
+ * @param[in]   buffer        Buffer used by the MDCT for its rotations, scratch and state
+ * @param[in]   window        Analysis / synthesis window, in Q2.30 format
+ * @param[in]   frame_length  Frame length @math{F}
+ *
+ * @see mdct_s32_t
+ *
+ * @ingroup dct_api
+ */
+C_API
+void mdct_init(
+    mdct_s32_t* mdct,
+    int32_t buffer[],
+    const q2_30 window[],
+    const unsigned frame_length);
+
+
+/**
+ * @brief Compute the MDCT of a new frame of samples.
+ *
+ * The `frame_length` samples of `x` follow those of the previous call (zero before the first
+ * call). `X->data` must have room for `frame_length` elements; its exponent, headroom and length
+ * are updated.
+ *
+ * See `mdct_s32_t` for more information about the MDCT and its operation.
+ *
+ * @param[inout]  mdct  MDCT to be processed
+ * @param[out]    X     Output MDCT coefficients
+ * @param[in]     x     New input samples
+ *
+ * @see mdct_s32_t
+ *
+ * @ingroup dct_api
+ */
+C_API
+void mdct_forward(
+    mdct_s32_t* mdct,
+    bfp_s32_t* X,
+    const bfp_s32_t* x);
+
+
+/**
+ * @brief Compute the IMDCT of a frame of coefficients and overlap-add it with the previous one.
+ *
+ * `y->data` must have room for `frame_length` elements; its exponent, headroom and length are
+ * updated.
+ *
+ * See `mdct_s32_t` for more information about the MDCT and its operation.
+ *
+ * @param[inout]  mdct  MDCT to be processed
+ * @param[out]    y     Output samples
+ * @param[in]     X     Input MDCT coefficients
+ *
+ * @see mdct_s32_t
+ *
+ * @ingroup dct_api
+ */
+C_API
+void mdct_inverse(
+    mdct_s32_t* mdct,
+    bfp_s32_t* y,
+    const bfp_s32_t* X);
     
 #ifdef __XC__
 } // extern "C"
@@ -0,0 +1,155 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#pragma once
+
+#include "xmath/types.h"
+
+
+/**
+ * @defgroup dwt_api  XMath DWT API
+ */
+
+
+#ifdef __XC__
+extern "C" {
+#endif
+
+
+/**
+ * @brief Wavelet used by a discrete wavelet transform.
+ *
+ * Each wavelet is implemented as a sequence of lifting steps followed by a scaling of the
+ * approximation and detail coefficients. All wavelets are normalised so that a constant signal
+ * has an approximation gain of @math{\sqrt{2}} per level. The Haar and Daubechies-4 transforms are
+ * orthonormal (they preserve energy).
+ *
+ * @see bfp_s32_dwt_forward,
+ *      bfp_s32_dwt_inverse
+ *
+ * @ingroup dwt_api
+ */
+C_API
+typedef enum {
+    /**
+     * Haar wavelet (2 lifting steps).
+     */
+    DWT_HAAR = 0,
+
+    /**
+     * Daubechies-4 wavelet (3 lifting steps). The signal is extended periodically at its
+     * boundaries.
+     */
+    DWT_DB4 = 1,
+
+    /**
+     * Cohen-Daubechies-Feauveau 9/7 biorthogonal wavelet, as used by JPEG 2000 (4 lifting steps).
+     * The signal is extended symmetrically at its boundaries.
+     */
+    DWT_CDF97 = 2,
+} dwt_wavelet_e;
+
+
+/**
+ * @brief Arrangement of the subbands of a multi-level discrete wavelet transform.
+ *
+ * With @math{N} coefficients and @math{L} levels, the detail band @math{d^{(l)}} produced by
+ * level @math{l} (for @math{1 \le l \le L}) has @math{N/2^l} coefficients, and the final
+ * approximation band @math{a^{(L)}} has @math{N/2^L} coefficients.
+ *
+ * @see bfp_s32_dwt_forward,
+ *      bfp_s32_dwt_inverse
+ *
+ * @ingroup dwt_api
+ */
+C_API
+typedef enum {
+    /**
+     * Subbands are stored contiguously, coarsest first:
+     * @math{\left[ a^{(L)}, d^{(L)}, d^{(L-1)}, \dots, d^{(1)} \right]}. This requires a scratch
+     * buffer of @math{N/2} words.
+     */
+    DWT_LAYOUT_PACKED = 0,
+
+    /**
+     * Coefficients are left where the in-place lifting puts them. Element @math{2^L i} is
+     * @math{a^{(L)}_i}, and element @math{2^{l-1}(2i+1)} is @math{d^{(l)}_i}. No scratch buffer
+     * is required.
+     */
+    DWT_LAYOUT_STRIDED = 1,
+} dwt_layout_e;
+
+
+/**
+ * @brief Multi-level forward discrete wavelet transform of a 32-bit BFP vector.
+ *
+ * This function performs an @math{L}-level forward DWT of BFP vector @vector{x}, in-place, using
+ * the lifting scheme. Each level splits the current approximation band into the next (coarser)
+ * approximation band and a detail band, each of half the length.
+ *
+ * Lifting steps update the even (or odd) samples in place from the odd (or even) samples, so no
+ * memory beyond @vector{x} itself is required other than that for `DWT_LAYOUT_PACKED` output.
+ * Before each level, the headroom of the band about to be transformed is checked, and the whole
+ * vector is shifted down (updating its exponent) only if that band lacks the headroom the wavelet
+ * needs to avoid saturation.
+ *
+ * The length @math{N} of @vector{x} must be a multiple of @math{2^L}. The format of the output is
+ * given by `layout` (see `dwt_layout_e`). If `layout` is `DWT_LAYOUT_PACKED`, `scratch` must point
+ * to a buffer of at least @math{N/2} words, whose contents are clobbered. Otherwise `scratch` is
+ * unused and may be `NULL`.
+ *
+ * @param[inout]  x         Input/output vector @vector{x}
+ * @param[in]     scratch   Scratch buffer of @math{N/2} words, or `NULL`
+ * @param[in]     wavelet   Wavelet to use
+ * @param[in]     levels    Number of levels @math{L}
+ * @param[in]     layout    Output subband layout
+ *
+ * @see bfp_s32_dwt_inverse,
+ *      dwt_wavelet_e,
+ *      dwt_layout_e
+ *
+ * @ingroup dwt_api
+ */
+C_API
+void bfp_s32_dwt_forward(
+    bfp_s32_t* x,
+    int32_t scratch[],
+    const dwt_wavelet_e wavelet,
+    const unsigned levels,
+    const dwt_layout_e layout);
+
+
+/**
+ * @brief Multi-level inverse discrete wavelet transform of a 32-bit BFP vector.
+ *
+ * This function is the inverse of `bfp_s32_dwt_forward()`. `x` holds the subbands of an
+ * @math{L}-level DWT in the given layout, and is replaced, in-place, by the reconstructed signal.
+ * `wavelet`, `levels` and `layout` must be the same as those used for the forward transform.
+ *
+ * As for the forward transform, the vector is only shifted down before a level if the band about
+ * to be reconstructed lacks the headroom needed to avoid saturation.
+ *
+ * @param[inout]  x         Input/output vector @vector{x}
+ * @param[in]     scratch   Scratch buffer of @math{N/2} words, or `NULL`
+ * @param[in]     wavelet   Wavelet to use
+ * @param[in]     levels    Number of levels @math{L}
+ * @param[in]     layout    Input subband layout
+ *
+ * @see bfp_s32_dwt_forward,
+ *      dwt_wavelet_e,
+ *      dwt_layout_e
+ *
+ * @ingroup dwt_api
+ */
+C_API
+void bfp_s32_dwt_inverse(
+    bfp_s32_t* x,
+    int32_t scratch[],
+    const dwt_wavelet_e wavelet,
+    const unsigned levels,
+    const dwt_layout_e layout);
+
+
+#ifdef __XC__
+} // extern "C"
+#endif
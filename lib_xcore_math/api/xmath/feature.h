@@ -0,0 +1,289 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#pragma once
+
+#include "xmath/types.h"
+
+
+/**
+ * @defgroup feature_api  XMath Feature Extraction API
+ */
+
+
+#ifdef __XC__
+extern "C" {
+#endif
+
+
+/**
+ * @brief Number of `int32_t` words required for the buffer of a `mel_filterbank_t`.
+ *
+ * @param FFT_LENGTH  Length of the (real) FFT whose spectrum the filterbank is applied to
+ * @param BAND_COUNT  Number of mel bands
+ *
+ * @see mel_filterbank_init
+ *
+ * @ingroup feature_api
+ */
+#define MEL_FILTERBANK_BUFFER_WORDS(FFT_LENGTH, BAND_COUNT)    \
+    (2*(BAND_COUNT) + (FFT_LENGTH) + 2)
+
+
+/**
+ * @brief Number of `int32_t` words required for the buffer of an `mfcc_s32_t`.
+ *
+ * @param BAND_COUNT  Number of mel bands in the filterbank
+ * @param COEF_COUNT  Number of cepstral coefficients computed
+ *
+ * @see mfcc_s32_init
+ *
+ * @ingroup feature_api
+ */
+#define MFCC_S32_BUFFER_WORDS(BAND_COUNT, COEF_COUNT)    \
+    ((BAND_COUNT) * ((COEF_COUNT) + 1))
+
+
+/**
+ * @brief Sparse triangular mel filterbank.
+ *
+ * @par Filterbank
+ * @parblock
+ *
+ * This struct represents a bank of @math{M} triangular filters applied to the power spectrum of a
+ * real @math{N}-point FFT. The band edges are equally spaced on the mel scale between a minimum
+ * and maximum frequency, and each filter rises linearly (in mel) from 0 at its lower edge to 1 at
+ * its centre, and falls back to 0 at its upper edge, which is the centre of the next band. The
+ * energy of band @math{m} is
+ *
+ * @math{ E_m = \sum_{k} w_{m,k} \left| X_k \right|^2 }
+ *
+ * where @math{X_k} is the @math{k}th FFT bin, for @math{0 \le k \le N/2}.
+ * @endparblock
+ *
+ * @par Representation
+ * @parblock
+ *
+ * Only the nonzero span of each filter is stored. Band @math{m} has `band_length[m]` Q2.30
+ * weights, stored in `weight` directly after those of band @math{m-1}, which apply to the FFT bins
+ * starting at `band_start[m]`. Because neighbouring bands only overlap by half, each bin
+ * contributes to at most two bands, so no more than @math{N+2} weights are stored, regardless of
+ * the number of bands.
+ * @endparblock
+ *
+ * @see mel_filterbank_init,
+ *      mel_filterbank_energy,
+ *      mel_filterbank_log_energy
+ *
+ * @ingroup feature_api
+ */
+C_API
+typedef struct {
+    /**
+     * Length of the FFT @math{N}.
+     */
+    unsigned fft_length;
+
+    /**
+     * Number of mel bands @math{M}.
+     */
+    unsigned band_count;
+
+    /**
+     * Index of the first FFT bin with a nonzero weight in each band.
+     */
+    const unsigned* band_start;
+
+    /**
+     * Number of FFT bins with a nonzero weight in each band.
+     */
+    const unsigned* band_length;
+
+    /**
+     * Nonzero weights of all bands, in Q2.30 format. The weights of each band directly follow those
+     * of the previous band.
+     */
+    const q2_30* weight;
+} mel_filterbank_t;
+
+
+/**
+ * @brief Mel-frequency cepstral coefficient (MFCC) calculator.
+ *
+ * Each call to `mfcc_s32()` takes the spectrum of one frame and computes the type-II DCT of the
+ * natural log of its mel band energies (see `mel_filterbank_t`),
+ *
+ * @math{ c_i = \sum_{m=0}^{M-1} \ln\left(E_m\right) \cos\left(\frac{\pi i (2m+1)}{2M}\right) }
+ *
+ * for @math{0 \le i < C}. Frames are independent, so this may be used on a stream of frames with
+ * no further state. The fields of this struct are considered to be opaque.
+ *
+ * @see mfcc_s32_init,
+ *      mfcc_s32
+ *
+ * @ingroup feature_api
+ */
+C_API
+typedef struct {
+    /**
+     * Mel filterbank applied to each frame.
+     */
+    const mel_filterbank_t* filterbank;
+
+    /**
+     * Number of cepstral coefficients @math{C}.
+     */
+    unsigned coef_count;
+
+    /**
+     * DCT matrix, as @math{C} rows of @math{M} Q2.30 values.
+     */
+    const q2_30* dct_matrix;
+
+    /**
+     * Log mel energies of the current frame, @math{M} words.
+     */
+    q8_24* log_mel;
+} mfcc_s32_t;
+
+
+/**
+ * @brief Initialize a sparse mel filterbank.
+ *
+ * The @math{M+2} band edges are equally spaced in mel between `min_freq` and `max_freq` (in Hz),
+ * with the mel scale @math{\mathrm{mel}(f) \propto \ln(1 + f/700)}. The weight of FFT bin @math{k}
+ * (at frequency @math{k f_s / N}) in each band is computed from the mel of that frequency.
+ *
+ * `buffer` must be `MEL_FILTERBANK_BUFFER_WORDS(fft_length, band_count)` words long, and holds the
+ * filterbank representation for as long as the filterbank is in use. The filterbank is constant
+ * after initialization, and may be shared.
+ *
+ * @param[out] filterbank   Filterbank to be initialized
+ * @param[in]  buffer       Buffer to hold the filterbank representation
+ * @param[in]  fft_length   Length of the FFT @math{N}
+ * @param[in]  band_count   Number of mel bands @math{M}
+ * @param[in]  sample_rate  Sample rate @math{f_s}, in Hz
+ * @param[in]  min_freq     Lower edge of the lowest band, in Hz
+ * @param[in]  max_freq     Upper edge of the highest band, in Hz. Must not exceed @math{f_s/2}
+ *
+ * @see mel_filterbank_t
+ *
+ * @ingroup feature_api
+ */
+C_API
+void mel_filterbank_init(
+    mel_filterbank_t* filterbank,
+    int32_t buffer[],
+    const unsigned fft_length,
+    const unsigned band_count,
+    const float sample_rate,
+    const float min_freq,
+    const float max_freq);
+
+
+/**
+ * @brief Compute the mel band energies of a spectrum.
+ *
+ * `X` is the spectrum of one frame as produced by `bfp_fft_forward_mono()`, with `fft_length/2`
+ * elements and the Nyquist component packed into the imaginary part of element 0. The squared
+ * magnitude of each bin is computed as it is needed, so no power spectrum buffer is required.
+ *
+ * The band energies @math{E_m} are placed in `mel`, which must have space for `band_count`
+ * elements. `mel` is normalised so that it has no headroom (unless all energies are zero).
+ *
+ * @param[in]  filterbank   Mel filterbank
+ * @param[out] mel          Output band energies @vector{E}
+ * @param[in]  X            Input spectrum @vector{X}
+ *
+ * @see mel_filterbank_t,
+ *      mel_filterbank_log_energy
+ *
+ * @ingroup feature_api
+ */
+C_API
+void mel_filterbank_energy(
+    const mel_filterbank_t* filterbank,
+    bfp_s32_t* mel,
+    const bfp_complex_s32_t* X);
+
+
+/**
+ * @brief Compute the log mel band energies of a spectrum.
+ *
+ * As `mel_filterbank_energy()`, but the natural logarithm of each band energy is placed in
+ * `log_mel`, as a Q8.24 value. Band energies which are zero are first replaced by the smallest
+ * representable nonzero energy.
+ *
+ * `log_mel` must have space for `band_count` elements, and must be aligned to an 8-byte (double
+ * word) boundary.
+ *
+ * @param[in]  filterbank   Mel filterbank
+ * @param[out] log_mel      Output log band energies, in Q8.24 format
+ * @param[in]  X            Input spectrum @vector{X}
+ *
+ * @see mel_filterbank_t,
+ *      mel_filterbank_energy
+ *
+ * @ingroup feature_api
+ */
+C_API
+void mel_filterbank_log_energy(
+    const mel_filterbank_t* filterbank,
+    q8_24 log_mel[],
+    const bfp_complex_s32_t* X);
+
+
+/**
+ * @brief Initialize an MFCC calculator.
+ *
+ * `buffer` must be `MFCC_S32_BUFFER_WORDS(band_count, coef_count)` words long, where
+ * `band_count` is that of `filterbank`, and must be aligned to an 8-byte (double word) boundary.
+ * `filterbank` must remain valid for as long as `mfcc` is in use.
+ *
+ * @param[out] mfcc         MFCC calculator to be initialized
+ * @param[in]  buffer       Buffer to hold the DCT matrix and scratch space
+ * @param[in]  filterbank   Initialized mel filterbank
+ * @param[in]  coef_count   Number of cepstral coefficients @math{C}. Must not exceed the number
+ *                          of mel bands
+ *
+ * @see mfcc_s32_t,
+ *      mfcc_s32
+ *
+ * @ingroup feature_api
+ */
+C_API
+void mfcc_s32_init(
+    mfcc_s32_t* mfcc,
+    int32_t buffer[],
+    const mel_filterbank_t* filterbank,
+    const unsigned coef_count);
+
+
+/**
+ * @brief Compute the mel-frequency cepstral coefficients of a spectrum.
+ *
+ * `X` is the spectrum of one frame, as for `mel_filterbank_energy()`. The log mel energies are
+ * computed into the calculator's scratch space, and the DCT is accumulated directly from them in
+ * 64 bits, so that only the output needs scaling.
+ *
+ * `coef` must have space for `coef_count` elements.
+ *
+ * @param[inout] mfcc   MFCC calculator
+ * @param[out]   coef   Output cepstral coefficients @vector{c}
+ * @param[in]    X      Input spectrum @vector{X}
+ *
+ * @see mfcc_s32_t,
+ *      mfcc_s32_init
+ *
+ * @ingroup feature_api
+ */
+C_API
+void mfcc_s32(
+    mfcc_s32_t* mfcc,
+    bfp_s32_t* coef,
+    const bfp_complex_s32_t* X);
+
+
+#ifdef __XC__
+} // extern "C"
+#endif
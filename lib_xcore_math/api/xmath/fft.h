@@ -610,10 +610,13 @@ void fft_dif_inverse (
  * @brief Perform forward FFT on a vector of IEEE754 floats.
  *
  * This function takes real input vector @vector{x} and performs a forward FFT on the signal
- * in-place to get output vector @math{\bar{X} = FFT\{\bar{x}\}}. This implementation is accelerated
- * by converting the IEEE754 float vector into a block floating-point representation to compute the
- * FFT. The resulting BFP spectrum is then converted back to IEEE754 single-precision floats. The
- * operation is performed in-place on `x[]`.
+ * in-place to get output vector @math{\bar{X} = FFT\{\bar{x}\}}. The operation is performed in-place
+ * on `x[]`.
+ *
+ * If @ref XMATH_FFT_F32_NATIVE is true (the default when not compiling for xcore), the FFT is
+ * computed directly on the floating-point data. Otherwise it is accelerated by converting the
+ * IEEE754 float vector into a block floating-point representation to compute the FFT, and the
+ * resulting BFP spectrum is then converted back to IEEE754 single-precision floats.
  *
  * See `bfp_fft_forward_mono()` for the details of the FFT.
  *
@@ -656,10 +659,13 @@ complex_float_t* fft_f32_forward(
  * @brief Perform inverse FFT on a vector of complex_float_t.
  *
  * This function takes complex input vector @vector{X} and performs an inverse real FFT on the
- * spectrum in-place to get output vector @math{\bar{x} = IFFT\{\bar{X}\}}. This implementation is
- * accelerated by converting the IEEE754 float vector into a block floating-point representation to
- * compute the IFFT. The resulting BFP signal is then converted back to IEEE754 single-precision
- * floats. The operation is performed in-place on `X[]`.
+ * spectrum in-place to get output vector @math{\bar{x} = IFFT\{\bar{X}\}}. The operation is
+ * performed in-place on `X[]`.
+ *
+ * If @ref XMATH_FFT_F32_NATIVE is true (the default when not compiling for xcore), the IFFT is
+ * computed directly on the floating-point data. Otherwise it is accelerated by converting the
+ * IEEE754 float vector into a block floating-point representation to compute the IFFT, and the
+ * resulting BFP signal is then converted back to IEEE754 single-precision floats.
  *
  * See `bfp_fft_inverse_mono()` for the details of the IFFT.
  *
@@ -690,6 +696,434 @@ float* fft_f32_inverse(
     const unsigned fft_length);
 
 
+/**
+ * @brief Perform forward FFT on a vector of complex_float_t.
+ *
+ * This function takes complex input vector @vector{x} and performs a forward FFT on the signal
+ * in-place to get output vector @math{\bar{X} = FFT\{\bar{x}\}}. The FFT is computed directly on
+ * the floating-point data using a radix-4 decimation-in-time algorithm.
+ *
+ * See `bfp_fft_forward_complex()` for the details of the FFT.
+ *
+ * `fft_length` must be a power of 2, and must be no larger than `(1<<MAX_DIT_FFT_LOG2)`.
+ *
+ * @operation{
+ * &     \bar{X}  \leftarrow FFT\{\bar{x}\}
+ * }
+ *
+ * @param[inout]  x           Input vector @vector{x}
+ * @param[in]     fft_length  The number of elements in @vector{x}
+ *
+ * @see fft_f32_inverse_complex
+ *
+ * @ingroup vect_f32_api
+ */
+C_API
+void fft_f32_forward_complex(
+    complex_float_t x[],
+    const unsigned fft_length);
+
+
+/**
+ * @brief Perform inverse FFT on a vector of complex_float_t.
+ *
+ * This function takes complex input vector @vector{X} and performs an inverse FFT on the spectrum
+ * in-place to get output vector @math{\bar{x} = IFFT\{\bar{X}\}}. The IFFT is computed directly on
+ * the floating-point data using a radix-4 decimation-in-time algorithm.
+ *
+ * See `bfp_fft_inverse_complex()` for the details of the IFFT.
+ *
+ * `fft_length` must be a power of 2, and must be no larger than `(1<<MAX_DIT_FFT_LOG2)`.
+ *
+ * @operation{
+ * &     \bar{x}  \leftarrow IFFT\{\bar{X}\}
+ * }
+ *
+ * @param[inout]  X           Input vector @vector{X}
+ * @param[in]     fft_length  The number of elements in @vector{X}
+ *
+ * @see fft_f32_forward_complex
+ *
+ * @ingroup vect_f32_api
+ */
+C_API
+void fft_f32_inverse_complex(
+    complex_float_t X[],
+    const unsigned fft_length);
+
+
+/**
+ * @brief Number of `int32_t` words required for the buffer of a `czt_s32_t`.
+ *
+ * @param FFT_LENGTH    Length @math{L} of the FFTs used by the transform
+ * @param INPUT_LENGTH  Number of input samples @math{N}
+ * @param BIN_COUNT     Number of output bins @math{M}
+ *
+ * @see czt_s32_init
+ *
+ * @ingroup fft_api
+ */
+#define CZT_S32_BUFFER_WORDS(FFT_LENGTH, INPUT_LENGTH, BIN_COUNT)   \
+    (4*(FFT_LENGTH) + 2*(INPUT_LENGTH) + 2*(BIN_COUNT))
+
+
+/**
+ * @brief 32-bit chirp-z transform (zoom FFT).
+ *
+ * @par Transform
+ * @parblock
+ *
+ * This struct represents a chirp-z transform which computes @math{M} bins of the DTFT of an
+ * @math{N}-sample input, at equally spaced frequencies starting from @math{f_0} with spacing
+ * @math{\Delta}, both in cycles per sample:
+ *
+ * @math{ X_k = \sum_{n=0}^{N-1} x_n e^{-j 2 \pi n (f_0 + k \Delta)} \qquad 0 \le k < M }
+ *
+ * With @math{f_0 = 0}, @math{\Delta = 1/N} and @math{M = N} this is the DFT of arbitrary length
+ * @math{N}. With a small @math{\Delta}, the bins resolve a narrow band far more finely than an FFT
+ * of length @math{N}, without zero padding and without computing unwanted bins.
+ * @endparblock
+ *
+ * @par Algorithm
+ * @parblock
+ *
+ * Bluestein's algorithm is used. Writing @math{nk = (n^2 + k^2 - (k-n)^2)/2}, the transform
+ * becomes a pre-multiplication by a chirp, a convolution with a chirp, and a post-multiplication
+ * by a chirp. The convolution is performed with `bfp_fft_forward_complex()` and
+ * `bfp_fft_inverse_complex()` of length @math{L \ge N + M - 1}, using the spectrum of the
+ * convolution chirp computed at initialization. The cost is @math{O(L \log L)}.
+ *
+ * Chirp phases are computed exactly (modulo one turn) in fixed point, so they remain accurate for
+ * large @math{N} and @math{M}.
+ * @endparblock
+ *
+ * @see czt_s32_init,
+ *      czt_s32_complex,
+ *      czt_s32_mono
+ *
+ * @ingroup fft_api
+ */
+C_API
+typedef struct {
+    /**
+     * Number of input samples @math{N}.
+     */
+    unsigned input_length;
+
+    /**
+     * Number of output bins @math{M}.
+     */
+    unsigned bin_count;
+
+    /**
+     * Pre-multiplication chirp @math{e^{-j 2 \pi (f_0 n + \Delta n^2 / 2)}}, in Q2.30 format.
+     */
+    complex_s32_t* pre_chirp;
+
+    /**
+     * Post-multiplication chirp @math{e^{-j \pi \Delta k^2}}, in Q2.30 format.
+     */
+    complex_s32_t* post_chirp;
+
+    /**
+     * Spectrum of the @math{L}-point (circular) convolution chirp @math{e^{j \pi \Delta m^2}}.
+     */
+    bfp_complex_s32_t chirp_spectrum;
+
+    /**
+     * Buffer of @math{L} elements in which the convolution is computed.
+     */
+    complex_s32_t* scratch;
+} czt_s32_t;
+
+
+/**
+ * @brief Initialize a chirp-z transform.
+ *
+ * Computes the chirps used by the transform, including the FFT of the convolution chirp.
+ *
+ * `buffer` must be `CZT_S32_BUFFER_WORDS(fft_length, input_length, bin_count)` words long and
+ * 8-byte-aligned. `fft_length` @math{L} must be a power of 2 no smaller than
+ * `input_length + bin_count - 1`, and no larger than `(1<<MAX_DIT_FFT_LOG2)`. The smallest such
+ * power of 2 is the cheapest.
+ *
+ * See `czt_s32_t` for more information about the chirp-z transform.
+ *
+ * @param[out]  czt           Chirp-z transform to be initialized
+ * @param[in]   buffer        Buffer used for the chirps and scratch space
+ * @param[in]   fft_length    FFT length @math{L}
+ * @param[in]   input_length  Number of input samples @math{N}
+ * @param[in]   bin_count     Number of output bins @math{M}
+ * @param[in]   f_start       Frequency of the first bin @math{f_0}, in cycles per sample
+ * @param[in]   f_step        Spacing between bins @math{\Delta}, in cycles per sample
+ *
+ * @see czt_s32_t
+ *
+ * @ingroup fft_api
+ */
+C_API
+void czt_s32_init(
+    czt_s32_t* czt,
+    int32_t buffer[],
+    const unsigned fft_length,
+    const unsigned input_length,
+    const unsigned bin_count,
+    const float f_start,
+    const float f_step);
+
+/**
+ * @brief Compute a chirp-z transform of a complex 32-bit BFP vector.
+ *
+ * `x` is the @math{N}-element input and is not modified. The @math{M} bins @math{X_k} are placed
+ * in `X`, whose data buffer must have space for `bin_count` elements.
+ *
+ * See `czt_s32_t` for more information about the chirp-z transform.
+ *
+ * @param[in]   czt   Chirp-z transform
+ * @param[out]  X     Output bins @vector{X}
+ * @param[in]   x     Input vector @vector{x}
+ *
+ * @see czt_s32_t,
+ *      czt_s32_mono
+ *
+ * @ingroup fft_api
+ */
+C_API
+void czt_s32_complex(
+    const czt_s32_t* czt,
+    bfp_complex_s32_t* X,
+    const bfp_complex_s32_t* x);
+
+/**
+ * @brief Compute a chirp-z transform of a real 32-bit BFP vector.
+ *
+ * As `czt_s32_complex()`, but for the real @math{N}-element input `x`.
+ *
+ * @param[in]   czt   Chirp-z transform
+ * @param[out]  X     Output bins @vector{X}
+ * @param[in]   x     Input vector @vector{x}
+ *
+ * @see czt_s32_t,
+ *      czt_s32_complex
+ *
+ * @ingroup fft_api
+ */
+C_API
+void czt_s32_mono(
+    const czt_s32_t* czt,
+    bfp_complex_s32_t* X,
+    const bfp_s32_t* x);
+
+
+
+/**
+ * @brief Number of `int32_t` words required for the buffer used by the cross-correlation functions.
+ *
+ * @param FFT_LENGTH    Length @math{N} of the (real) FFTs from which the spectra were computed
+ *
+ * @see bfp_fft_xcorr,
+ *      bfp_fft_xcorr_pairs
+ *
+ * @ingroup fft_api
+ */
+#define XCORR_S32_BUFFER_WORDS(FFT_LENGTH)    ((3*(FFT_LENGTH))/2)
+
+
+/**
+ * @brief Frequency weighting applied to a cross-spectrum before it is inverse transformed.
+ *
+ * @see bfp_fft_xcorr,
+ *      bfp_fft_xcorr_pairs
+ *
+ * @ingroup fft_api
+ */
+C_API
+typedef enum {
+    /**
+     * No weighting: the result is the plain (circular) cross-correlation.
+     */
+    XCORR_WEIGHT_NONE = 0,
+
+    /**
+     * Phase transform: each bin of the cross-spectrum is divided by its magnitude (GCC-PHAT).
+     */
+    XCORR_WEIGHT_PHAT = 1,
+} xcorr_weighting_e;
+
+
+/**
+ * @brief Location and height of the peak of a cross-correlation.
+ *
+ * @see bfp_s32_xcorr_peak,
+ *      bfp_fft_xcorr_pairs
+ *
+ * @ingroup fft_api
+ */
+C_API
+typedef struct {
+    /**
+     * Lag of the peak in samples, including the sub-sample offset found by interpolation.
+     */
+    float lag;
+
+    /**
+     * Value of the cross-correlation at the (integer) lag nearest the peak.
+     */
+    float_s32_t value;
+} xcorr_peak_t;
+
+
+/**
+ * @brief Compute the (generalized) cross-correlation of two real signals from their spectra.
+ *
+ * `X` and `Y` are the spectra of two real @math{N}-sample signals @math{x[n]} and @math{y[n]}, as
+ * produced by `bfp_fft_forward_mono()` (i.e. with @math{N/2} elements, and with the Nyquist bin
+ * packed into the imaginary part of the DC bin). They are not modified, so the spectrum of each
+ * signal can be shared by every pair in which it takes part.
+ *
+ * The cross-spectrum @math{X[f] \cdot Y^*[f]} is formed, weighted according to `weighting`, and
+ * inverse transformed in a single pass over `buffer`. With `XCORR_WEIGHT_PHAT` each bin is
+ * normalized to unit magnitude (bins which are exactly zero remain zero), which whitens the
+ * cross-spectrum and sharpens the peak for time-delay estimation.
+ *
+ * @operation{
+ * &    r[\tau] = \frac{1}{N} \sum_{f=0}^{N-1} W[f] X[f] Y^*[f] e^{j2\pi f\tau/N}
+ *                  \qquad \text{ for } 0 \le \tau < N \\
+ * &    W[f] = 1 \text{ (none) or } 1 / \left| X[f] Y^*[f] \right| \text{ (PHAT)}
+ * }
+ *
+ * @math{r[\tau]} is circular in @math{\tau}, so negative lags @math{-\tau} are found at index
+ * @math{N - \tau}. A peak at positive lag @math{\tau} means that @math{x[n]} is delayed by
+ * @math{\tau} samples with respect to @math{y[n]}.
+ *
+ * On return `r` is an @math{N}-element BFP vector whose data is the start of `buffer`. `buffer`
+ * must be `XCORR_S32_BUFFER_WORDS(N)` words long and 8-byte-aligned. To avoid circular wrapping of
+ * the correlation, the signals should be zero-padded to at least twice the largest lag of
+ * interest before the forward FFTs.
+ *
+ * @param[out]  r           Cross-correlation @math{r[\tau]}
+ * @param[in]   buffer      Buffer for the cross-spectrum and the result
+ * @param[in]   X           Spectrum of @math{x[n]}
+ * @param[in]   Y           Spectrum of @math{y[n]}
+ * @param[in]   weighting   Frequency weighting to apply
+ *
+ * @see bfp_s32_xcorr_peak,
+ *      bfp_fft_xcorr_pairs,
+ *      bfp_fft_forward_mono
+ *
+ * @ingroup fft_api
+ */
+C_API
+void bfp_fft_xcorr(
+    bfp_s32_t* r,
+    int32_t buffer[],
+    const bfp_complex_s32_t* X,
+    const bfp_complex_s32_t* Y,
+    const xcorr_weighting_e weighting);
+
+/**
+ * @brief Find the peak of a circular cross-correlation, with sub-sample interpolation.
+ *
+ * Searches `r` (as produced by `bfp_fft_xcorr()`) for its largest value at lags
+ * @math{-max\_lag \le \tau \le max\_lag}, where negative lags are taken from the end of `r`. The
+ * position of the peak is then refined by fitting a parabola through it and its two (circular)
+ * neighbours.
+ *
+ * `max_lag` must be less than `r->length / 2`.
+ *
+ * @param[in]   r         Cross-correlation
+ * @param[in]   max_lag   Largest lag magnitude to search
+ *
+ * @returns The interpolated lag of the peak, and the value of `r` at the nearest integer lag
+ *
+ * @see bfp_fft_xcorr
+ *
+ * @ingroup fft_api
+ */
+C_API
+xcorr_peak_t bfp_s32_xcorr_peak(
+    const bfp_s32_t* r,
+    const unsigned max_lag);
+
+/**
+ * @brief Estimate the delay between each of several pairs of signals.
+ *
+ * `spectra` holds the spectra of each of the signals (e.g. one per microphone) as produced by
+ * `bfp_fft_forward_mono()`. For each of the `pair_count` pairs `(pairs[p][0], pairs[p][1])`, the
+ * cross-correlation of `spectra[pairs[p][0]]` with `spectra[pairs[p][1]]` is computed as by
+ * `bfp_fft_xcorr()`, and its peak within `max_lag` samples is found as by
+ * `bfp_s32_xcorr_peak()`. The result for pair `p` is placed in `peaks[p]`.
+ *
+ * The forward spectra are computed once per signal and shared between pairs, and all pairs use
+ * the same `buffer`, which must be `XCORR_S32_BUFFER_WORDS(N)` words long and 8-byte-aligned,
+ * where @math{N} is the FFT length.
+ *
+ * @param[out]  peaks         Peak of each pair's cross-correlation
+ * @param[in]   buffer        Buffer used for each cross-correlation
+ * @param[in]   spectra       Spectra of the signals
+ * @param[in]   pairs         Indices into `spectra` of the signals in each pair
+ * @param[in]   pair_count    Number of pairs
+ * @param[in]   weighting     Frequency weighting to apply
+ * @param[in]   max_lag       Largest lag magnitude to search
+ *
+ * @see bfp_fft_xcorr,
+ *      bfp_s32_xcorr_peak
+ *
+ * @ingroup fft_api
+ */
+C_API
+void bfp_fft_xcorr_pairs(
+    xcorr_peak_t peaks[],
+    int32_t buffer[],
+    const bfp_complex_s32_t spectra[],
+    const unsigned pairs[][2],
+    const unsigned pair_count,
+    const xcorr_weighting_e weighting,
+    const unsigned max_lag);
+
+/**
+ * @brief Compute the analytic signal of a real 32-bit sequence using the mono FFT.
+ *
+ * The analytic signal of the real @math{N}-sample BFP vector `x` is placed in the @math{N}-element
+ * complex BFP vector `z`. Its real part is @math{x[n]} and its imaginary part is the (circular)
+ * Hilbert transform of @math{x[n]}, whose spectrum is @math{-j X[f]} at positive frequencies,
+ * @math{+j X[f]} at negative frequencies, and zero at DC and Nyquist.
+ *
+ * @operation{
+ * &    z[n] = x[n] + j \cdot \frac{1}{N}\sum_{f=0}^{N-1} \left( H[f] \cdot X[f] \cdot
+ *                 e^{j2\pi fn/N} \right) \qquad \text{ for } 0 \le n < N \\
+ * &    H[f] = -j \text{ for } 0 < f < N/2 \text{, } +j \text{ for } N/2 < f < N
+ *                 \text{, and } 0 \text{ otherwise}
+ * }
+ *
+ * This is equivalent to zeroing the negative-frequency bins of the spectrum, doubling the
+ * positive-frequency bins, and taking an @math{N}-point inverse complex DFT. Instead, the Hilbert
+ * transform is computed as an @math{N}-point inverse real DFT of the rotated mono spectrum (see
+ * @ref note_spectrum_packing), so that only @math{N/2}-point complex FFTs are needed.
+ *
+ * `x->length` must be a power of 2, and must be no larger than `(1<<MAX_DIT_FFT_LOG2)`. `x` is used
+ * as the FFT buffer, so its contents are not preserved. `z->data` must have space for
+ * @math{N} elements, must be 8-byte-aligned, and must not overlap `x->data`. The exponent,
+ * headroom and length of `z` are set by this function.
+ *
+ * Because the transform is circular, samples near the ends of the block are affected by those at
+ * the other end. For a stream of samples, overlapping blocks, or `filter_hilbert_s32_t`, may be
+ * used instead.
+ *
+ * @param[out]    z   Output analytic signal @vector{z}
+ * @param[inout]  x   Input real signal @vector{x}
+ *
+ * @see bfp_fft_forward_mono,
+ *      bfp_fft_inverse_mono,
+ *      filter_hilbert_s32_t
+ *
+ * @ingroup fft_api
+ */
+C_API
+void bfp_fft_analytic_mono(
+    bfp_complex_s32_t* z,
+    bfp_s32_t* x);
+
 #ifdef __XC__
 } // extern "C"
 #endif
\ No newline at end of file
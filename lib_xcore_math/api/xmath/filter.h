@@ -347,6 +347,215 @@ int32_t filter_fir_s32(
     const int32_t new_sample);
 
 
+/**
+ * @brief Number of `int32_t` words required for the state buffer of a `filter_nlms_s32_t`.
+ *
+ * @param TAPS    Number of filter taps
+ * @param BLOCK   Number of samples processed per update
+ *
+ * @see filter_nlms_s32_init
+ *
+ * @ingroup filter_api
+ */
+#define FILTER_NLMS_S32_STATE_WORDS(TAPS, BLOCK)    ((TAPS) + 2 * (BLOCK) - 1)
+
+
+/**
+ * @brief 32-bit Normalised Least Mean Squares (NLMS) Adaptive FIR Filter
+ *
+ * @par Filter Model
+ * @parblock
+ *
+ * This struct represents an N-tap 32-bit adaptive FIR filter whose coefficients are updated with
+ * a normalised LMS rule. The filtering itself is the same as for `filter_fir_s32_t`: with
+ * coefficients `b[k]`, input `x[t]` and desired signal `d[t]`
+ *
+ * @math{ y[t] = \sum_{k=0}^{N-1} b[k] \cdot x[t-k] \cdot 2^{-30-shift} }
+ *
+ * @math{ e[t] = d[t] - y[t] }
+ *
+ * The filter works on blocks of `block_length` samples. After each block, the coefficients
+ * receive the update
+ *
+ * @math{ b[k] \leftarrow b[k] + \frac{\mu}{E + \delta} \sum_{j} e[t_j] \cdot x[t_j-k] \cdot
+ *        2^{30+shift} }
+ *
+ * where the sum is over the samples @math{t_j} of the block, and @math{E} is the energy of the
+ * most recent `num_taps` input samples. With a `block_length` of 1 this is the ordinary NLMS
+ * filter; larger blocks give block-LMS.
+ *
+ * @math{E} is maintained incrementally as samples enter and leave the filter's window, rather
+ * than being recomputed each sample. Each output is computed with `vect_s32_dot()`. Once all of
+ * the block's outputs are known, the whole block's update is applied in a single pass over the
+ * taps: the gradient for each tap is the inner product (`vect_s32_dot()`) of the block's scaled
+ * errors with that tap's inputs, and is added to the coefficients with `vect_s32_add()`.
+ *
+ * The update is not fused into the filtering pass, because it depends on the errors of the whole
+ * block. Filtering and adaptation each make one pass over the coefficients per block.
+ * @endparblock
+ *
+ * @par Notes
+ * @parblock
+ *
+ * 1. As with `filter_fir_s32_t`, `state` holds a circular buffer (of `num_taps + block_length - 1`
+ *    samples), with the newest sample following `state[head]`. It is followed by `block_length`
+ *    words of scratch for the update. Its usage is considered to be opaque.
+ *
+ * 2. `coef` is updated in-place and should be initialized with the starting coefficients
+ *    (often all zeros). Coefficient updates saturate to the 32-bit range.
+ *
+ * 3. @math{\mu} is typically in the range @math{(0, 1]}; values approaching 2 are unstable.
+ * @endparblock
+ *
+ * @see filter_nlms_s32_init,
+ *      filter_nlms_s32,
+ *      filter_nlms_s32_block
+ *
+ * @ingroup filter_api
+ */
+C_API
+typedef struct {
+    /**
+     * The number of taps in the filter.
+     */
+    unsigned num_taps;
+
+    /**
+     * The number of samples processed per coefficient update.
+     */
+    unsigned block_length;
+
+    /**
+     * Index into the `state` buffer where the next new sample will be placed.
+     */
+    unsigned head;
+
+    /**
+     * Unsigned arithmetic rounding right-shift applied to accumulator when computing filter output.
+     */
+    right_shift_t shift;
+
+    /**
+     * Adaptation step size @math{\mu}.
+     */
+    uq2_30 mu;
+
+    /**
+     * Regularisation @math{\delta} added to the input energy, in units of squared input samples.
+     */
+    int64_t delta;
+
+    /**
+     * Running energy @math{E} of the most recent `num_taps` input samples, in units of
+     * @math{2^{16}} squared input samples.
+     */
+    int64_t energy;
+
+    /**
+     * Pointer to a buffer containing the filter coefficients.
+     */
+    int32_t* coef;
+
+    /**
+     * Pointer to the filter's state buffer.
+     */
+    int32_t* state;
+} filter_nlms_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit NLMS adaptive FIR filter.
+ *
+ * Before filter_nlms_s32() or filter_nlms_s32_block() can be used on a filter it must be
+ * initialized with a call to this function. The input history and energy are cleared.
+ *
+ * `state_buffer` must be `FILTER_NLMS_S32_STATE_WORDS(tap_count, block_length)` words long.
+ * `coefficients` must be `tap_count` words long and contain the initial filter coefficients.
+ *
+ * See `filter_nlms_s32_t` for more information about NLMS filters and their operation.
+ *
+ * @param[out]   filter         Filter struct to be initialized
+ * @param[in]    state_buffer   Buffer used by the filter to contain state information
+ * @param[inout] coefficients   Filter coefficients, which are adapted in-place
+ * @param[in]    tap_count      Number of filter taps
+ * @param[in]    block_length   Number of samples processed per coefficient update
+ * @param[in]    shift          Unsigned arithmetic right-shift applied to accumulator to get
+ *                              filter output sample
+ * @param[in]    mu             Adaptation step size @math{\mu}, in UQ2.30 format
+ * @param[in]    delta          Regularisation @math{\delta}, in units of squared input samples.
+ *                              Must be positive
+ *
+ * @see filter_nlms_s32_t
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_nlms_s32_init(
+    filter_nlms_s32_t* filter,
+    int32_t* state_buffer,
+    int32_t* coefficients,
+    const unsigned tap_count,
+    const unsigned block_length,
+    const right_shift_t shift,
+    const uq2_30 mu,
+    const int64_t delta);
+
+/**
+ * @brief Process a block of samples with a 32-bit NLMS adaptive FIR filter.
+ *
+ * The `block_length` new input samples `x` are added to the filter's state, the filter output is
+ * subtracted from the desired signal `d` and the result (saturated to 32 bits) is placed in `e`.
+ * If `adapt` is non-zero, the coefficients are then updated using this block's errors, so the
+ * update takes effect from the next block.
+ *
+ * `e` may be the same array as `d` for in-place processing.
+ *
+ * See `filter_nlms_s32_t` for more information about NLMS filters and their operation.
+ *
+ * @param[inout]    filter      Filter to be processed
+ * @param[out]      e           Output error samples
+ * @param[in]       d           Desired signal samples
+ * @param[in]       x           New input samples
+ * @param[in]       adapt       Whether the coefficients should be updated
+ *
+ * @see filter_nlms_s32_t,
+ *      filter_nlms_s32
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_nlms_s32_block(
+    filter_nlms_s32_t* filter,
+    int32_t e[],
+    const int32_t d[],
+    const int32_t x[],
+    const unsigned adapt);
+
+/**
+ * @brief Process a single sample with a 32-bit NLMS adaptive FIR filter.
+ *
+ * This is filter_nlms_s32_block() for a filter with a `block_length` of 1.
+ *
+ * @param[inout]    filter          Filter to be processed
+ * @param[in]       new_sample      New input sample to be processed by `filter`
+ * @param[in]       desired         Desired output sample
+ * @param[in]       adapt           Whether the coefficients should be updated
+ *
+ * @returns     Error sample @math{d[t] - y[t]}
+ *
+ * @see filter_nlms_s32_t,
+ *      filter_nlms_s32_block
+ *
+ * @ingroup filter_api
+ */
+C_API
+int32_t filter_nlms_s32(
+    filter_nlms_s32_t* filter,
+    const int32_t new_sample,
+    const int32_t desired,
+    const unsigned adapt);
+
+
 /**
  * @brief 16-bit Discrete-Time Finite Impulse Response (FIR) Filter
  *
@@ -723,6 +932,682 @@ int32_t filter_biquads_sat_s32(
     const unsigned block_count,
     const int32_t new_sample);
 
+
+/**
+ * @brief Gradient constraint policy for a frequency-domain adaptive filter.
+ *
+ * @see filter_fdaf_s32_t
+ *
+ * @ingroup filter_api
+ */
+C_API
+typedef enum {
+    /**
+     * The gradient constraint is applied to every partition on every frame.
+     */
+    FDAF_CONSTRAIN_ALL = 0,
+
+    /**
+     * The gradient constraint is applied to a single partition on each frame, cycling through the
+     * partitions. The remaining partitions receive an unconstrained update. This removes
+     * @math{2(P-1)} FFTs per frame.
+     */
+    FDAF_CONSTRAIN_ALTERNATING = 1,
+} filter_fdaf_constraint_e;
+
+
+/**
+ * @brief Number of `int32_t` words required for the buffer of a `filter_fdaf_s32_t`.
+ *
+ * @param FRAME_ADVANCE   Number of new samples consumed per frame (@math{F})
+ * @param PARTITIONS      Number of filter partitions (@math{P})
+ *
+ * @see filter_fdaf_s32_init
+ *
+ * @ingroup filter_api
+ */
+#define FILTER_FDAF_S32_BUFFER_WORDS(FRAME_ADVANCE, PARTITIONS)   \
+    ((4*(PARTITIONS)+5)*((FRAME_ADVANCE)+1) + (FRAME_ADVANCE))
+
+
+/**
+ * @brief 32-bit Partitioned-Block Frequency-Domain Adaptive Filter (FDAF/MDF)
+ *
+ * @par Filter Model
+ * @parblock
+ *
+ * This struct represents a multi-delay (partitioned-block) frequency-domain adaptive filter with
+ * @math{P} partitions, each @math{F} taps long, for a total filter length of @math{PF} taps. The
+ * filter uses overlap-save with an FFT length of @math{N = 2F}, so @math{F} must be a power of 2.
+ *
+ * Each call to filter_fdaf_s32() consumes one frame of @math{F} reference samples @math{x} and
+ * @math{F} desired samples @math{d}, and produces @math{F} error samples @math{e = d - y}, where
+ * @math{y} is the output of the adaptive filter.
+ *
+ * Denoting the spectrum of the reference signal @math{p} frames ago as @math{X_p}, and the weights
+ * of partition @math{p} as @math{W_p}, the filter operates as follows:
+ *
+ * @operation{
+ * &     X_0 \leftarrow FFT\{ [ x_{prev}, x ] \}                                               \\
+ * &     Y \leftarrow \sum_{p=0}^{P-1} X_p \cdot W_p                                           \\
+ * &     e \leftarrow d - [IFFT\{Y\}]_{F:N}                                                    \\
+ * &     S_k \leftarrow \alpha S_k + (1-\alpha) \left| X_{0,k} \right|^2                      \\
+ * &     G_k \leftarrow \frac{\mu}{S_k + \delta} \cdot FFT\{ [ 0, e ] \}_k                     \\
+ * &     W_p \leftarrow W_p + \mathcal{C}\left\{ G \cdot X_p^* \right\}
+ * }
+ *
+ * where @math{\mathcal{C}} is the gradient constraint (see
+ * bfp_complex_s32_gradient_constraint_mono()), which zeroes the last @math{F} time-domain samples
+ * of the gradient. When `constraint` is `FDAF_CONSTRAIN_ALTERNATING`, @math{\mathcal{C}} is only
+ * applied to partition @math{(t \bmod P)} on frame @math{t}, and is skipped for the others.
+ * @endparblock
+ *
+ * @par Memory
+ * @parblock
+ *
+ * All state lives in a single caller-provided buffer of `FILTER_FDAF_S32_BUFFER_WORDS(F, P)` words
+ * plus two caller-provided arrays of @math{P} BFP vector headers. filter_fdaf_s32() does not
+ * allocate any memory. The fields of this struct other than `mu`, `delta` and `alpha` are
+ * considered to be opaque.
+ * @endparblock
+ *
+ * @see filter_fdaf_s32_init,
+ *      filter_fdaf_s32
+ *
+ * @ingroup filter_api
+ */
+C_API
+typedef struct {
+    /**
+     * Number of new samples consumed per frame (@math{F}). The FFT length is `2*frame_advance`.
+     */
+    unsigned frame_advance;
+
+    /**
+     * Number of filter partitions (@math{P}).
+     */
+    unsigned partitions;
+
+    /**
+     * Index into `X` of the most recent reference spectrum.
+     */
+    unsigned head;
+
+    /**
+     * Number of frames processed so far. Selects the constrained partition in alternating mode.
+     */
+    unsigned frame_count;
+
+    /**
+     * Gradient constraint policy.
+     */
+    filter_fdaf_constraint_e constraint;
+
+    /**
+     * Adaptation step size @math{\mu}. Because each partition is normalised by the power of a single
+     * reference spectrum, values around @math{1/(2P)} give fast, stable convergence.
+     */
+    float_s32_t mu;
+
+    /**
+     * Regularisation @math{\delta} added to the power estimate before normalisation.
+     */
+    float_s32_t delta;
+
+    /**
+     * Smoothing coefficient @math{\alpha} of the power estimate, in UQ2.30 format.
+     */
+    uq2_30 alpha;
+
+    /**
+     * Circular buffer of the `partitions` most recent reference spectra, each `frame_advance+1`
+     * bins long.
+     */
+    bfp_complex_s32_t* X;
+
+    /**
+     * Frequency-domain weights of each partition, each `frame_advance+1` bins long.
+     */
+    bfp_complex_s32_t* W;
+
+    /**
+     * Smoothed per-bin power of the reference signal @math{S}.
+     */
+    bfp_s32_t power;
+
+    /**
+     * The previous frame of reference samples.
+     */
+    bfp_s32_t x_prev;
+
+    /**
+     * Scratch space of `4*(frame_advance+1)` words.
+     */
+    int32_t* scratch;
+} filter_fdaf_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit frequency-domain adaptive filter.
+ *
+ * Before filter_fdaf_s32() can be used on a filter it must be initialized with a call to this
+ * function. The weights and all history are cleared.
+ *
+ * `buffer` must be `FILTER_FDAF_S32_BUFFER_WORDS(frame_advance, partitions)` words long and
+ * aligned to an 8-byte (double word) boundary. `X` and `W` must each have space for `partitions`
+ * BFP vector headers. After initialization, `W[p]` holds the weights of partition `p`.
+ *
+ * @param[out] filter           Filter struct to be initialized
+ * @param[in]  X                Array of `partitions` headers for the reference spectra
+ * @param[in]  W                Array of `partitions` headers for the weights
+ * @param[in]  buffer           Buffer used by the filter to contain all state information
+ * @param[in]  frame_advance    Number of new samples per frame. Must be a power of 2
+ * @param[in]  partitions       Number of filter partitions
+ * @param[in]  mu               Adaptation step size @math{\mu}
+ * @param[in]  delta            Regularisation @math{\delta}. Must be positive
+ * @param[in]  alpha            Power smoothing coefficient @math{\alpha}, in UQ2.30 format.
+ *                              Must not exceed `0x40000000`
+ * @param[in]  constraint       Gradient constraint policy
+ *
+ * @see filter_fdaf_s32_t,
+ *      filter_fdaf_s32
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_fdaf_s32_init(
+    filter_fdaf_s32_t* filter,
+    bfp_complex_s32_t X[],
+    bfp_complex_s32_t W[],
+    int32_t buffer[],
+    const unsigned frame_advance,
+    const unsigned partitions,
+    const float_s32_t mu,
+    const float_s32_t delta,
+    const uq2_30 alpha,
+    const filter_fdaf_constraint_e constraint);
+
+/**
+ * @brief Process one frame with a 32-bit frequency-domain adaptive filter.
+ *
+ * The `frame_advance` samples of reference signal `x` are added to the filter's history, the
+ * filter output is subtracted from desired signal `d`, and the result is placed in `e`. If `adapt`
+ * is non-zero, the weights are then updated using `e`.
+ *
+ * All of `e`, `d` and `x` must be `frame_advance` elements long. `e` may be the same vector as
+ * `d` for in-place processing.
+ *
+ * See `filter_fdaf_s32_t` for more information about the filter's operation.
+ *
+ * @param[inout]    filter      Filter to be processed
+ * @param[out]      e           Output error signal
+ * @param[in]       d           Desired signal
+ * @param[in]       x           Reference signal
+ * @param[in]       adapt       Whether the weights should be updated
+ *
+ * @see filter_fdaf_s32_t,
+ *      filter_fdaf_s32_init
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_fdaf_s32(
+    filter_fdaf_s32_t* filter,
+    bfp_s32_t* e,
+    const bfp_s32_t* d,
+    const bfp_s32_t* x,
+    const unsigned adapt);
+
+
+/**
+ * @brief Number of `int32_t` words required for the state buffer of a `filter_goertzel_s32_t`.
+ *
+ * @param BINS    Number of frequency bins (@math{K})
+ *
+ * @see filter_goertzel_s32_init
+ *
+ * @ingroup filter_api
+ */
+#define FILTER_GOERTZEL_S32_STATE_WORDS(BINS)    (5*(BINS))
+
+
+/**
+ * @brief 32-bit Goertzel filter bank
+ *
+ * @par Filter Model
+ * @parblock
+ *
+ * This struct represents a bank of @math{K} Goertzel filters, which together compute @math{K}
+ * selected bins of the @math{N}-point DFT of each block of @math{N} input samples,
+ *
+ * @math{ X_k = \sum_{n=0}^{N-1} x[n] e^{-j 2 \pi b_k n / N} }
+ *
+ * where @math{b_k} is the index of the @math{k}th bin. Each filter runs the second-order
+ * recurrence
+ *
+ * @math{ s_k[n] = x[n] + 2\cos(\omega_k) s_k[n-1] - s_k[n-2] }
+ *
+ * with @math{\omega_k = 2 \pi b_k / N}, and @math{X_k} is formed from the last two values of
+ * @math{s_k} at the end of the block. This costs @math{O(K)} operations per sample, rather than the
+ * @math{O(N \log N)} of an FFT per block, which is much cheaper when only a few bins are needed.
+ *
+ * The @math{K} recurrences are stored as vectors and advanced together, so all bins are processed
+ * across the lanes of the VPU.
+ * @endparblock
+ *
+ * @par Notes
+ * @parblock
+ *
+ * 1. The recurrence state grows to as much as @math{N / \sin(\omega_k)} times the input
+ *    amplitude, so input samples are shifted right by `input_shr` bits before entering the
+ *    recurrence. This shift is chosen by `filter_goertzel_s32_init()` to rule out saturation.
+ *
+ * 2. The fields of this struct are otherwise considered to be opaque.
+ * @endparblock
+ *
+ * @see filter_goertzel_s32_init,
+ *      filter_goertzel_s32_block
+ *
+ * @ingroup filter_api
+ */
+C_API
+typedef struct {
+    /**
+     * Number of bins @math{K}.
+     */
+    unsigned bin_count;
+
+    /**
+     * Number of samples @math{N} per block.
+     */
+    unsigned block_length;
+
+    /**
+     * Number of samples of the current block consumed so far.
+     */
+    unsigned count;
+
+    /**
+     * Rounding right-shift applied to input samples before they enter the recurrence.
+     */
+    right_shift_t input_shr;
+
+    /**
+     * Recurrence coefficients @math{2\cos(\omega_k)}, in Q2.30 format.
+     */
+    q2_30* coef;
+
+    /**
+     * @math{\sin(\omega_k)}, in Q2.30 format.
+     */
+    q2_30* sin;
+
+    /**
+     * Most recent recurrence state @math{s_k[n-1]}.
+     */
+    int32_t* s1;
+
+    /**
+     * Previous recurrence state @math{s_k[n-2]}.
+     */
+    int32_t* s2;
+
+    /**
+     * Space for the next recurrence state.
+     */
+    int32_t* s0;
+} filter_goertzel_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit Goertzel filter bank.
+ *
+ * `state_buffer` must be `FILTER_GOERTZEL_S32_STATE_WORDS(bin_count)` words long. Each element of
+ * `bins` is the index of a DFT bin @math{b_k}, and must satisfy @math{0 < b_k < N/2}.
+ *
+ * See `filter_goertzel_s32_t` for more information about Goertzel filter banks.
+ *
+ * @param[out]  filter          Filter struct to be initialized
+ * @param[in]   state_buffer    Buffer used by the filter to contain state information
+ * @param[in]   bins            DFT bin indices @math{b_k}
+ * @param[in]   bin_count       Number of bins @math{K}
+ * @param[in]   block_length    Block length @math{N}
+ *
+ * @see filter_goertzel_s32_t
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_goertzel_s32_init(
+    filter_goertzel_s32_t* filter,
+    int32_t state_buffer[],
+    const unsigned bins[],
+    const unsigned bin_count,
+    const unsigned block_length);
+
+/**
+ * @brief Compute selected DFT bins of a block of samples with a 32-bit Goertzel filter bank.
+ *
+ * The `block_length` samples `x` are processed, and the resulting @math{K} bins are placed in
+ * `X`, which must have space for `bin_count` elements. The exponent of `X` is relative to the
+ * input samples, i.e. if the samples of `x` have exponent @math{x\_exp}, the true values of the
+ * bins are the mantissas of `X` scaled by @math{2^{X.exp + x\_exp}}.
+ *
+ * The filter state is reset after each block, so blocks are independent.
+ *
+ * See `filter_goertzel_s32_t` for more information about Goertzel filter banks.
+ *
+ * @param[inout]    filter      Filter to be processed
+ * @param[out]      X           Output DFT bins @vector{X}
+ * @param[in]       x           Block of input samples
+ *
+ * @see filter_goertzel_s32_t,
+ *      filter_goertzel_s32_init
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_goertzel_s32_block(
+    filter_goertzel_s32_t* filter,
+    bfp_complex_s32_t* X,
+    const int32_t x[]);
+
+
+/**
+ * @brief Number of `int32_t` words required for the state buffer of a `filter_sdft_s32_t`.
+ *
+ * @param BINS            Number of frequency bins (@math{K})
+ * @param WINDOW_LENGTH   Length of the sliding window (@math{N})
+ *
+ * @see filter_sdft_s32_init
+ *
+ * @ingroup filter_api
+ */
+#define FILTER_SDFT_S32_STATE_WORDS(BINS, WINDOW_LENGTH)    \
+    ((WINDOW_LENGTH) + 4*(BINS) + FILTER_GOERTZEL_S32_STATE_WORDS(BINS))
+
+
+/**
+ * @brief 32-bit recursive sliding DFT
+ *
+ * @par Filter Model
+ * @parblock
+ *
+ * This struct represents a tracker of @math{K} selected bins of the @math{N}-point DFT of a
+ * window which slides forward by one sample with every new sample. After sample @math{x[t]}
+ *
+ * @math{ X_k[t] = \sum_{m=0}^{N-1} x[t-N+1+m] e^{-j 2 \pi b_k m / N} }
+ *
+ * Rather than computing the DFT anew, each bin is updated with the recursion
+ *
+ * @math{ X_k[t] = \left( X_k[t-1] + x[t] - x[t-N] \right) e^{j 2 \pi b_k / N} }
+ *
+ * which costs @math{O(K)} operations per sample.
+ * @endparblock
+ *
+ * @par Stability
+ * @parblock
+ *
+ * In fixed point, the twiddle factors @math{e^{j 2 \pi b_k / N}} cannot have a magnitude of
+ * exactly one, so errors in the recursion would otherwise accumulate indefinitely. To prevent
+ * this, a Goertzel filter bank (see `filter_goertzel_s32_t`) runs alongside the recursion on the
+ * same samples. Every @math{N} samples, when its block coincides with the sliding window, its
+ * (drift-free) output replaces the state of the recursion. This re-normalisation also costs only
+ * @math{O(K)} operations per sample.
+ * @endparblock
+ *
+ * @par Notes
+ * @parblock
+ *
+ * 1. Input samples are shifted right by `input_shr` bits before entering the recursion, so that
+ *    the bins cannot saturate.
+ *
+ * 2. The fields of this struct are otherwise considered to be opaque.
+ * @endparblock
+ *
+ * @see filter_sdft_s32_init,
+ *      filter_sdft_s32
+ *
+ * @ingroup filter_api
+ */
+C_API
+typedef struct {
+    /**
+     * Number of bins @math{K}.
+     */
+    unsigned bin_count;
+
+    /**
+     * Length of the sliding window @math{N}.
+     */
+    unsigned window_length;
+
+    /**
+     * Index into `history` of the oldest sample in the window.
+     */
+    unsigned head;
+
+    /**
+     * Rounding right-shift applied to input samples before they enter the recursion.
+     */
+    right_shift_t input_shr;
+
+    /**
+     * The most recent @math{N} input samples, as a circular buffer.
+     */
+    int32_t* history;
+
+    /**
+     * Current bins @math{X_k[t]}.
+     */
+    complex_s32_t* bin;
+
+    /**
+     * Twiddle factors @math{e^{j 2 \pi b_k / N}}, in Q2.30 format.
+     */
+    complex_s32_t* twiddle;
+
+    /**
+     * Goertzel filter bank used to re-normalise the recursion.
+     */
+    filter_goertzel_s32_t goertzel;
+} filter_sdft_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit recursive sliding DFT.
+ *
+ * `state_buffer` must be `FILTER_SDFT_S32_STATE_WORDS(bin_count, window_length)` words long. Each
+ * element of `bins` is the index of a DFT bin @math{b_k}, and must satisfy @math{0 < b_k < N/2}.
+ * The input history is cleared, so the window is initially all zeros.
+ *
+ * See `filter_sdft_s32_t` for more information about the sliding DFT.
+ *
+ * @param[out]  filter          Filter struct to be initialized
+ * @param[in]   state_buffer    Buffer used by the filter to contain state information
+ * @param[in]   bins            DFT bin indices @math{b_k}
+ * @param[in]   bin_count       Number of bins @math{K}
+ * @param[in]   window_length   Window length @math{N}
+ *
+ * @see filter_sdft_s32_t
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_sdft_s32_init(
+    filter_sdft_s32_t* filter,
+    int32_t state_buffer[],
+    const unsigned bins[],
+    const unsigned bin_count,
+    const unsigned window_length);
+
+/**
+ * @brief Add a new sample to a 32-bit recursive sliding DFT.
+ *
+ * `new_sample` enters the window (and the oldest sample leaves it), and the updated @math{K} bins
+ * are placed in `X`, which must have space for `bin_count` elements. As with
+ * `filter_goertzel_s32_block()`, the exponent of `X` is relative to that of the input samples.
+ *
+ * See `filter_sdft_s32_t` for more information about the sliding DFT.
+ *
+ * @param[inout]    filter      Filter to be processed
+ * @param[out]      X           Output DFT bins @vector{X}
+ * @param[in]       new_sample  New input sample
+ *
+ * @see filter_sdft_s32_t,
+ *      filter_sdft_s32_init
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_sdft_s32(
+    filter_sdft_s32_t* filter,
+    bfp_complex_s32_t* X,
+    const int32_t new_sample);
+
+
+/**
+ * @brief Number of `int32_t` words required for the state buffer of a `filter_hilbert_s32_t`.
+ *
+ * @param TAPS    Number of taps of the Hilbert transformer (@math{N})
+ *
+ * @see filter_hilbert_s32_init
+ *
+ * @ingroup filter_api
+ */
+#define FILTER_HILBERT_S32_STATE_WORDS(TAPS)    (5*((TAPS) + 1)/2)
+
+
+/**
+ * @brief 32-bit FIR Hilbert transformer
+ *
+ * @par Filter Model
+ * @parblock
+ *
+ * This struct represents an @math{N}-tap FIR Hilbert transformer, which converts a stream of real
+ * samples @math{x[t]} into the analytic signal
+ *
+ * @math{ z[t] = x[t-c] + j \sum_{k=0}^{N-1} h[k] x[t-k] }
+ *
+ * where @math{c = (N-1)/2} is the group delay of the filter. The coefficients are the ideal
+ * Hilbert transformer response @math{2 / (\pi (k-c))} for odd @math{k-c} (and zero for even
+ * @math{k-c}), tapered by a Blackman window. @math{N} must be one less than a multiple of 4.
+ *
+ * Because @math{c} is odd, only the taps at even @math{k} are non-zero, and they apply only to
+ * input samples of the same parity as @math{t}. The input is therefore split into two
+ * interleaved streams, and each output is a @math{(N+1)/2}-tap inner product over one of them.
+ * This skips the zero taps, so about half of the multiplies of an @math{N}-tap FIR filter are
+ * needed.
+ * @endparblock
+ *
+ * @par Notes
+ * @parblock
+ *
+ * 1. The gain of the filter to an arbitrary input can exceed one, so the outputs are shifted right
+ *    by `output_shr` bits, chosen by `filter_hilbert_s32_init()` to rule out saturation.
+ *
+ * 2. The fields of this struct are otherwise considered to be opaque.
+ * @endparblock
+ *
+ * @see filter_hilbert_s32_init,
+ *      filter_hilbert_s32_block,
+ *      bfp_fft_analytic_mono
+ *
+ * @ingroup filter_api
+ */
+C_API
+typedef struct {
+    /**
+     * Number of taps @math{N}.
+     */
+    unsigned num_taps;
+
+    /**
+     * Number of samples @math{(N+1)/2} in each of the two input streams.
+     */
+    unsigned stream_length;
+
+    /**
+     * Stream into which the next input sample will be added.
+     */
+    unsigned parity;
+
+    /**
+     * Index into each stream of its most recent sample.
+     */
+    unsigned head[2];
+
+    /**
+     * Rounding right-shift applied to the outputs.
+     */
+    right_shift_t output_shr;
+
+    /**
+     * The non-zero coefficients @math{h[0], h[2], ..., h[N-1]}, in Q2.30 format.
+     */
+    q2_30* coef;
+
+    /**
+     * The two input streams. Each sample is stored twice, so that the most recent
+     * `stream_length` samples of a stream are always contiguous.
+     */
+    int32_t* stream[2];
+} filter_hilbert_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit FIR Hilbert transformer.
+ *
+ * `state_buffer` must be `FILTER_HILBERT_S32_STATE_WORDS(tap_count)` words long. `tap_count` must
+ * be at least 3, and one less than a multiple of 4. The coefficients are computed here and kept
+ * in `state_buffer`, and the filter history is cleared.
+ *
+ * See `filter_hilbert_s32_t` for more information about Hilbert transformers.
+ *
+ * @param[out]  filter          Filter struct to be initialized
+ * @param[in]   state_buffer    Buffer used by the filter to contain state information
+ * @param[in]   tap_count       Number of taps @math{N}
+ *
+ * @see filter_hilbert_s32_t
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_hilbert_s32_init(
+    filter_hilbert_s32_t* filter,
+    int32_t state_buffer[],
+    const unsigned tap_count);
+
+/**
+ * @brief Compute the analytic signal of a block of samples with a 32-bit FIR Hilbert transformer.
+ *
+ * The `length` samples `x` are processed, and the corresponding analytic signal samples are placed
+ * in `z`, which must have space for `length` elements. The real part of each output is the input
+ * sample from @math{(N-1)/2} samples earlier, and the imaginary part is its Hilbert transform.
+ *
+ * The filter history carries over from one call to the next, so a stream may be processed in
+ * blocks of any length. As with `filter_goertzel_s32_block()`, the exponent of `z` is relative to
+ * that of the input samples, and it is the same for every block.
+ *
+ * See `filter_hilbert_s32_t` for more information about Hilbert transformers.
+ *
+ * @param[inout]    filter      Filter to be processed
+ * @param[out]      z           Output analytic signal @vector{z}
+ * @param[in]       x           Block of input samples
+ * @param[in]       length      Number of samples in the block
+ *
+ * @see filter_hilbert_s32_t,
+ *      filter_hilbert_s32_init
+ *
+ * @ingroup filter_api
+ */
+C_API
+void filter_hilbert_s32_block(
+    filter_hilbert_s32_t* filter,
+    bfp_complex_s32_t* z,
+    const int32_t x[],
+    const unsigned length);
+
 #ifdef __XC__
 } // extern "C"
 #endif
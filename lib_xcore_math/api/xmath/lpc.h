@@ -0,0 +1,162 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#pragma once
+
+#include "xmath/types.h"
+
+
+/**
+ * @defgroup lpc_api  XMath Linear Prediction API
+ */
+
+
+#ifdef __XC__
+extern "C" {
+#endif
+
+
+/**
+ * @brief Largest linear prediction order supported by `lpc_s32_levinson_durbin()`.
+ *
+ * @ingroup lpc_api
+ */
+#define LPC_MAX_ORDER   (32)
+
+
+/**
+ * @brief Number of grid points used by `lpc_s32_to_lsf()` to search for roots.
+ *
+ * @ingroup lpc_api
+ */
+#define LPC_LSF_GRID_POINTS   (256)
+
+
+/**
+ * @brief Number of `int32_t` words of scratch needed by the FFT path of `bfp_s32_autocorr()`.
+ *
+ * @param LENGTH      Number of samples in the input vector
+ * @param LAG_COUNT   Number of lags computed
+ *
+ * @see bfp_s32_autocorr
+ *
+ * @ingroup lpc_api
+ */
+#define AUTOCORR_S32_SCRATCH_WORDS(LENGTH, LAG_COUNT)   (2*((LENGTH) + (LAG_COUNT)))
+
+
+/**
+ * @brief Compute the autocorrelation of a 32-bit BFP vector.
+ *
+ * The autocorrelation of @vector{b} is computed for lags @math{0} to @math{K-1}, where @math{K} is
+ * `a->length`, and placed in @vector{a}. @math{K} must be no greater than @math{N}, the length of
+ * @vector{b}.
+ *
+ * @operation{
+ * &     a_k \leftarrow \sum_{n=0}^{N-1-k} b_n \cdot b_{n+k}              \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (K-1)
+ * }
+ *
+ * Two methods are available. The direct path computes one inner product per lag using
+ * `vect_s32_autocorr()`, at a cost proportional to @math{N \cdot K}. The FFT path zero-pads
+ * @vector{b} to a power-of-2 length @math{L \ge N + K - 1}, and takes the inverse FFT of its power
+ * spectrum, at a cost proportional to @math{L \log L}.
+ *
+ * The FFT path is used when `scratch` is not `NULL`, @math{K} is at least
+ * `XMATH_AUTOCORR_FFT_MIN_LAGS`, and @math{L} is no larger than `(1<<MAX_DIT_FFT_LOG2)`. `scratch`
+ * must then be `AUTOCORR_S32_SCRATCH_WORDS(N, K)` words long and 8-byte-aligned. Otherwise the
+ * direct path is used and `scratch` is unused.
+ *
+ * The result is scaled so that @math{a_0} (which is the largest element) has 1 bit of headroom.
+ *
+ * @param[out]  a         Output autocorrelation @vector{a}
+ * @param[in]   b         Input vector @vector{b}
+ * @param[in]   scratch   Scratch buffer for the FFT path, or `NULL`
+ *
+ * @see vect_s32_autocorr,
+ *      lpc_s32_levinson_durbin
+ *
+ * @ingroup lpc_api
+ */
+C_API
+void bfp_s32_autocorr(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    int32_t scratch[]);
+
+
+/**
+ * @brief Solve for linear prediction coefficients using the Levinson-Durbin recursion.
+ *
+ * Given the autocorrelation @math{r_0, r_1, ..., r_P} of a signal, this function finds the
+ * coefficients @math{a_1, ..., a_P} of the order-@math{P} linear predictor which minimizes the
+ * prediction error, i.e. it solves the Toeplitz normal equations. The prediction error filter is
+ *
+ * @math{ A(z) = 1 + \sum_{j=1}^{P} a_j z^{-j} }
+ *
+ * so that the prediction of @math{x[n]} is @math{-\sum_{j=1}^{P} a_j x[n-j]}.
+ *
+ * The order @math{P} is `lpc->length`, which must be no greater than `LPC_MAX_ORDER`, and `r` must
+ * have at least @math{P+1} elements (e.g. as computed by `bfp_s32_autocorr()`). The coefficients
+ * are placed in `lpc`, whose exponent is chosen by this function. The reflection (PARCOR)
+ * coefficients @math{k_1, ..., k_P} are placed in `refl` as Q2.30 values.
+ *
+ * The recursion is carried out with `float_s32_t` arithmetic. If @math{r_0} is zero, or rounding
+ * error would make the predictor unstable (@math{|k_i| \ge 1}), the recursion stops early and the
+ * remaining coefficients and reflection coefficients are zero.
+ *
+ * @param[out]  lpc     Linear prediction coefficients @math{a_1, ..., a_P}
+ * @param[out]  refl    Reflection coefficients @math{k_1, ..., k_P}, as Q2.30 values
+ * @param[in]   r       Autocorrelation @math{r_0, ..., r_P}
+ *
+ * @returns The energy of the prediction error of the order-@math{P} predictor
+ *
+ * @see bfp_s32_autocorr,
+ *      lpc_s32_to_lsf
+ *
+ * @ingroup lpc_api
+ */
+C_API
+float_s32_t lpc_s32_levinson_durbin(
+    bfp_s32_t* lpc,
+    q2_30 refl[],
+    const bfp_s32_t* r);
+
+
+/**
+ * @brief Convert linear prediction coefficients to line spectral frequencies.
+ *
+ * The prediction error filter @math{A(z)} of order @math{P} (see `lpc_s32_levinson_durbin()`)
+ * is split into the symmetric and antisymmetric polynomials
+ *
+ * @math{ P(z) = A(z) + z^{-(P+1)} A(z^{-1}) \qquad Q(z) = A(z) - z^{-(P+1)} A(z^{-1}) }
+ *
+ * For a minimum-phase @math{A(z)}, the roots of both lie on the unit circle and interlace. Their
+ * angles in @math{(0, \pi)} are the @math{P} line spectral frequencies @math{\omega_1 < \omega_2 <
+ * ... < \omega_P}, which are placed in `lsf` in radians.
+ *
+ * The roots are located by evaluating both polynomials (as Chebyshev series in @math{\cos\omega})
+ * on a grid of `LPC_LSF_GRID_POINTS` frequencies, and refined by bisection.
+ *
+ * The order @math{P} is `lpc->length`, which must be even.
+ *
+ * @param[out]  lsf   Line spectral frequencies @math{\omega_1, ..., \omega_P}
+ * @param[in]   lpc   Linear prediction coefficients @math{a_1, ..., a_P}
+ *
+ * @returns The number of line spectral frequencies found. This is less than @math{P} if
+ *          @math{A(z)} is not minimum-phase, or if two frequencies fall within one grid step, in
+ *          which case the contents of `lsf` should not be used.
+ *
+ * @see lpc_s32_levinson_durbin
+ *
+ * @ingroup lpc_api
+ */
+C_API
+unsigned lpc_s32_to_lsf(
+    radian_q24_t lsf[],
+    const bfp_s32_t* lpc);
+
+
+#ifdef __XC__
+} // extern "C"
+#endif
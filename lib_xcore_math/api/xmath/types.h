@@ -348,6 +348,102 @@ typedef struct {
 //! [bfp_complex_s16_t]
 
 
+/**
+ * @brief A block floating-point matrix of 32-bit elements.
+ *
+ * Initialized with the ``bfp_mat_s32_init()`` function.
+ *
+ * Elements are stored in row-major order, so that the element in row ``i`` and column ``j`` is
+ * ``data[i*cols + j]``. The logical quantity represented by that element is:
+ *      ``data[i*cols + j] * 2^(exp)``
+ *      where the multiplication and exponentiation are using real (non-modular) arithmetic.
+ *
+ * The BFP API keeps the ``hr`` field up-to-date with the current headroom of ``data[]`` so as to
+ * minimize precision loss as elements become small.
+ *
+ * @ingroup type_bfp
+ */
+C_TYPE
+typedef struct {
+    /** Pointer to the underlying element buffer (row-major).*/
+    int32_t* data;
+    /** Exponent associated with the matrix. */
+    exponent_t exp;
+    /** Current headroom in the ``data[]`` */
+    headroom_t hr;
+    /** Number of rows in the matrix */
+    unsigned rows;
+    /** Number of columns in the matrix */
+    unsigned cols;
+    /** BFP matrix flags. Users should not normally modify these manually. */
+    bfp_flags_e flags;
+} bfp_mat_s32_t;
+
+
+/**
+ * @brief A block floating-point matrix of complex 32-bit elements.
+ *
+ * Initialized with the ``bfp_mat_complex_s32_init()`` function.
+ *
+ * Elements are stored in row-major order, so that the element in row ``i`` and column ``j`` is
+ * ``data[i*cols + j]``. The logical quantity represented by that element is:
+ *      ``data[i*cols + j].re * 2^(exp) + i * data[i*cols + j].im * 2^(exp)``
+ *      where the multiplication and exponentiation are using real (non-modular) arithmetic, and
+ *      i is sqrt(-1)
+ *
+ * The BFP API keeps the ``hr`` field up-to-date with the current headroom of ``data[]`` so as to
+ * minimize precision loss as elements become small.
+ *
+ * @ingroup type_bfp
+ */
+C_TYPE
+typedef struct {
+    /** Pointer to the underlying element buffer (row-major).*/
+    complex_s32_t* data;
+    /** Exponent associated with the matrix. */
+    exponent_t exp;
+    /** Current headroom in the ``data[]`` */
+    headroom_t hr;
+    /** Number of rows in the matrix */
+    unsigned rows;
+    /** Number of columns in the matrix */
+    unsigned cols;
+    /** BFP matrix flags. Users should not normally modify these manually. */
+    bfp_flags_e flags;
+} bfp_mat_complex_s32_t;
+
+
+/**
+ * @brief A batch of equally-sized complex 32-bit block floating-point matrices.
+ *
+ * Initialized with the ``bfp_mat_complex_s32_batch_init()`` function.
+ *
+ * Each of the ``count`` matrices (e.g. one per frequency bin) has its own exponent. Elements are
+ * stored matrix-element-major (structure-of-arrays), so that element ``(i,j)`` of every matrix in
+ * the batch is contiguous in memory, and element ``(i,j)`` of matrix ``b`` is
+ * ``data[(i*cols + j)*count + b]``. The logical quantity represented by that element is:
+ *      ``data[(i*cols + j)*count + b] * 2^(exp[b])``
+ *
+ * This layout lets the vector kernels operate across the matrices of the batch rather than across
+ * the elements of a single (small) matrix.
+ *
+ * @ingroup type_bfp
+ */
+C_TYPE
+typedef struct {
+    /** Pointer to the underlying element buffer (``rows*cols*count`` elements).*/
+    complex_s32_t* data;
+    /** Pointer to the per-matrix exponents (``count`` elements). */
+    exponent_t* exp;
+    /** Number of rows in each matrix */
+    unsigned rows;
+    /** Number of columns in each matrix */
+    unsigned cols;
+    /** Number of matrices in the batch */
+    unsigned count;
+} bfp_mat_complex_s32_batch_t;
+
+
 /**
  * @brief A complex number with a single-precision floating-point real part and a single-precision
  * floating-point imaginary part.
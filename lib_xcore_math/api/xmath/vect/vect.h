@@ -12,3 +12,4 @@
 #include "xmath/vect/vect_s8.h"
 #include "xmath/vect/vect_s16.h"
 #include "xmath/vect/vect_s32.h"
+#include "xmath/vect/vect_s32_strided.h"
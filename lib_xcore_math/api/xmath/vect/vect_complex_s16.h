@@ -348,6 +348,62 @@ headroom_t vect_complex_s16_mag(
     const unsigned table_rows);
 
 
+/**
+ * @brief Compute the angle of each element of a complex 16-bit vector.
+ *
+ * `a[]` represents the output vector @vector{a} of angles, in radians (Q8.24). Each output lies
+ * within @math{[-\pi, \pi]}.
+ *
+ * `b_real[]` and `b_imag[]` together represent the complex 16-bit input mantissa vector
+ * @vector{b}. Because the angle of an element does not depend on its scale, no exponent or shift is
+ * required.
+ *
+ * `a[]`, `b_real[]` and `b_imag[]` must each begin at a word-aligned address.
+ *
+ * `length` is the number of elements in each of the vectors.
+ *
+ * `rot_table` and `table_rows` specify the rotation table. This is the same table used by
+ * vect_complex_s16_mag(). The default table may be used:
+ *
+ * @code
+ *     const extern unsigned rot_table16_rows;
+ *     const extern int16_t rot_table16[14][2][16];
+ * @endcode
+ *
+ * The precision of the 16-bit rotation table limits the accuracy of the result to about
+ * @math{10^{-4}} radians. vect_complex_s32_angle() should be used if more precision is required.
+ *
+ * The angle of a zero element is reported as @math{0}.
+ *
+ * @operation{
+ * &     a_k \leftarrow \arg\left(b_k\right) = atan2\left(Im\\{b_k\\}, Re\\{b_k\\}\right) \\
+ * &       \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @param[out]  a           Output vector @vector{a}, in radians (Q8.24)
+ * @param[in]   b_real      Real part of complex input vector @vector{b}
+ * @param[in]   b_imag      Imag part of complex input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   rot_table   Pre-computed rotation table
+ * @param[in]   table_rows  Number of rows in `rot_table`
+ *
+ * @exception ET_LOAD_STORE Raised if `a`, `b_real` or `b_imag` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @see vect_complex_s16_mag,
+ *      vect_complex_s32_angle
+ *
+ * @ingroup vect_complex_s16_api
+ */
+C_API
+void vect_complex_s16_angle(
+    radian_q24_t a[],
+    const int16_t b_real[],
+    const int16_t b_imag[],
+    const unsigned length,
+    const int16_t* rot_table,
+    const unsigned table_rows);
+
+
 /**
  * @brief Multiply one complex 16-bit vector element-wise by another, and add the result to an
  * accumulator.
@@ -626,6 +626,254 @@ headroom_t vect_complex_s32_mag(
     const unsigned table_rows);
 
 
+/**
+ * @brief Compute an approximate magnitude of each element of a complex 32-bit vector.
+ *
+ * This is a faster alternative to vect_complex_s32_mag() with the same input and output formats,
+ * which does not use a rotation table.
+ *
+ * `a[]` represents the real 32-bit output mantissa vector @vector{a}.
+ *
+ * `b[]` represents the complex 32-bit input mantissa vector @vector{b}.
+ *
+ * `a[]` and `b[]` must each begin at a word-aligned address.
+ *
+ * `length` is the number of elements in each of the vectors.
+ *
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b}.
+ *
+ * `iterations` selects the accuracy tier. With `iterations` of `0` the alpha-max-plus-beta-min
+ * estimate @math{\alpha \cdot max(|Re\\{v_k\\}|, |Im\\{v_k\\}|) + \beta \cdot
+ * min(|Re\\{v_k\\}|, |Im\\{v_k\\}|)} is used, with @math{\alpha \approx 0.9604} and
+ * @math{\beta \approx 0.3978}, which needs no multiplication of mantissas by each other.
+ * Otherwise the square root of the squared magnitude is computed as in vect_s32_sqrt_fast(), using
+ * `iterations` Newton-Raphson iterations. The error bounds are:
+ *
+ * * `0`: within 3.96% relative
+ * * `1`: within 0.01% (@math{2^{-13}}) relative
+ * * `2`: within @math{2^{-20}} relative
+ * * `3` or more: within 2 LSbs
+ *
+ * Results which exceed `INT32_MAX` saturate.
+ *
+ * @operation{
+ * &     v_k \leftarrow b_k \cdot 2^{-b\_shr}    \\
+ * &     a_k \leftarrow \sqrt { {\left( Re\\{v_k\\} \right)}^2 + {\left( Im\\{v_k\\} \right)}^2 } \\
+ * &       \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If @vector{b} are the complex 32-bit mantissas of a BFP vector @math{ \bar{b} \cdot 2^{b\_exp} },
+ * then the resulting vector @vector{a} are the real 32-bit mantissas of BFP vector @math{\bar{a}
+ * \cdot 2^{a\_exp}}, where @math{a\_exp = b\_exp + b\_shr}.
+ *
+ * The function vect_complex_s32_mag_prepare() can be used to obtain values for @math{a\_exp} and
+ * @math{b\_shr} based on the input exponent @math{b\_exp} and headroom @math{b\_hr}.
+ * @endparblock
+ *
+ * @param[out]  a           Real output vector @vector{a}
+ * @param[in]   b           Complex input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr       Right-shift appled to @vector{b}
+ * @param[in]   iterations  Accuracy tier, as described above
+ *
+ * @returns     Headroom of the output vector @vector{a}.
+ *
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @see vect_complex_s32_mag,
+ *      vect_complex_s32_mag_prepare
+ *
+ * @ingroup vect_complex_s32_api
+ */
+C_API
+headroom_t vect_complex_s32_mag_fast(
+    int32_t a[],
+    const complex_s32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const unsigned iterations);
+
+
+/**
+ * @brief Compute the angle of each element of a complex 32-bit vector.
+ *
+ * `a[]` represents the output vector @vector{a} of angles, in radians (Q8.24). Each output lies
+ * within @math{[-\pi, \pi]}.
+ *
+ * `b[]` represents the complex 32-bit input mantissa vector @vector{b}. Because the angle of an
+ * element does not depend on its scale, no exponent or shift is required.
+ *
+ * `a[]` and `b[]` must each begin at a word-aligned address.
+ *
+ * `length` is the number of elements in each of the vectors.
+ *
+ * `rot_table` and `table_rows` specify the rotation table. This is the same table used by
+ * vect_complex_s32_mag(); each element is rotated onto the positive real axis, and the angle is
+ * accumulated from the direction of each rotation. The default table may be used:
+ *
+ * @code
+ *     const extern unsigned rot_table32_rows;
+ *     const extern complex_s32_t rot_table32[30][4];
+ * @endcode
+ *
+ * Row @math{i} of the table rotates by @math{\frac{\pi}{4} \cdot 2^{-i}}, so using fewer rows gives
+ * a faster result with a resolution of roughly @math{\frac{\pi}{4} \cdot 2^{1-table\_rows}}.
+ *
+ * The angle of a zero element is reported as @math{0}.
+ *
+ * @operation{
+ * &     a_k \leftarrow \arg\left(b_k\right) = atan2\left(Im\\{b_k\\}, Re\\{b_k\\}\right) \\
+ * &       \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @param[out]  a           Output vector @vector{a}, in radians (Q8.24)
+ * @param[in]   b           Complex input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   rot_table   Pre-computed rotation table
+ * @param[in]   table_rows  Number of rows in `rot_table`
+ *
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @see vect_complex_s32_mag,
+ *      vect_s32_unwrap_phase
+ *
+ * @ingroup vect_complex_s32_api
+ */
+C_API
+void vect_complex_s32_angle(
+    radian_q24_t a[],
+    const complex_s32_t b[],
+    const unsigned length,
+    const complex_s32_t* rot_table,
+    const unsigned table_rows);
+
+
+/**
+ * @brief Convert a complex 32-bit vector to polar form.
+ *
+ * This function computes both the magnitude and the angle of each element of complex input vector
+ * @vector{b} in a single rotation pass. The magnitudes are identical in meaning to those produced
+ * by vect_complex_s32_mag(), and the angles to those produced by vect_complex_s32_angle().
+ *
+ * `a_mag[]` represents the real 32-bit output mantissa vector @vector{m}.
+ *
+ * `a_angle[]` represents the output vector @vector{\theta} of angles, in radians (Q8.24).
+ *
+ * `b[]` represents the complex 32-bit input mantissa vector @vector{b}.
+ *
+ * `a_mag[]`, `a_angle[]` and `b[]` must each begin at a word-aligned address.
+ *
+ * `length` is the number of elements in each of the vectors.
+ *
+ * `b_shr` is the signed arithmetic right-shift applied to the magnitudes.
+ *
+ * `rot_table` and `table_rows` specify the rotation table, as for vect_complex_s32_mag().
+ *
+ * @operation{
+ * &     m_k \leftarrow \left| b_k \right| \cdot 2^{-b\_shr}    \\
+ * &     \theta_k \leftarrow \arg\left(b_k\right)               \\
+ * &       \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If @vector{b} are the complex 32-bit mantissas of a BFP vector @math{ \bar{b} \cdot 2^{b\_exp} },
+ * then the resulting vector @vector{m} are the real 32-bit mantissas of BFP vector @math{\bar{m}
+ * \cdot 2^{m\_exp}}, where @math{m\_exp = b\_exp + b\_shr}.
+ *
+ * The function vect_complex_s32_mag_prepare() can be used to obtain values for @math{m\_exp} and
+ * @math{b\_shr} based on the input exponent @math{b\_exp} and headroom @math{b\_hr}.
+ * @endparblock
+ *
+ * @param[out]  a_mag       Real output vector @vector{m}
+ * @param[out]  a_angle     Output vector @vector{\theta}, in radians (Q8.24)
+ * @param[in]   b           Complex input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{m}, @vector{\theta} and @vector{b}
+ * @param[in]   b_shr       Right-shift appled to the magnitudes
+ * @param[in]   rot_table   Pre-computed rotation table
+ * @param[in]   table_rows  Number of rows in `rot_table`
+ *
+ * @returns     Headroom of the output vector @vector{m}.
+ *
+ * @exception ET_LOAD_STORE Raised if `a_mag`, `a_angle` or `b` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @see vect_complex_s32_mag_prepare,
+ *      vect_polar_to_complex_s32
+ *
+ * @ingroup vect_complex_s32_api
+ */
+C_API
+headroom_t vect_complex_s32_to_polar(
+    int32_t a_mag[],
+    radian_q24_t a_angle[],
+    const complex_s32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const complex_s32_t* rot_table,
+    const unsigned table_rows);
+
+
+/**
+ * @brief Convert a polar vector to a complex 32-bit vector.
+ *
+ * This function computes @math{m_k \cdot (cos(\theta_k) + j\,sin(\theta_k))} for each magnitude
+ * @math{m_k} of @vector{m} and angle @math{\theta_k} of @vector{\theta}. The sines and cosines are
+ * evaluated with vect_s32_sin() and vect_s32_cos().
+ *
+ * `a[]` represents the complex 32-bit output mantissa vector @vector{a}.
+ *
+ * `b_mag[]` represents the real 32-bit input mantissa vector @vector{m}.
+ *
+ * `b_angle[]` represents the input vector @vector{\theta} of angles, in radians (Q8.24).
+ *
+ * `a[]`, `b_mag[]` and `b_angle[]` must each begin at a word-aligned address. This operation
+ * cannot be performed in-place.
+ *
+ * `length` is the number of elements in each of the vectors.
+ *
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{m}.
+ *
+ * @operation{
+ * &     v_k \leftarrow m_k \cdot 2^{-b\_shr}    \\
+ * &     a_k \leftarrow v_k \cdot cos\left(\theta_k\right) + j\, v_k \cdot sin\left(\theta_k\right) \\
+ * &       \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If @vector{m} are the real 32-bit mantissas of a BFP vector @math{ \bar{m} \cdot 2^{m\_exp} },
+ * then the resulting vector @vector{a} are the complex 32-bit mantissas of BFP vector
+ * @math{\bar{a} \cdot 2^{a\_exp}}, where @math{a\_exp = m\_exp + b\_shr}.
+ * @endparblock
+ *
+ * @param[out]  a           Complex output vector @vector{a}
+ * @param[in]   b_mag       Input vector @vector{m}
+ * @param[in]   b_angle     Input vector @vector{\theta}, in radians (Q8.24)
+ * @param[in]   length      Number of elements in vectors @vector{a}, @vector{m} and @vector{\theta}
+ * @param[in]   b_shr       Right-shift appled to @vector{m}
+ *
+ * @returns     Headroom of the output vector @vector{a}.
+ *
+ * @exception ET_LOAD_STORE Raised if `a`, `b_mag` or `b_angle` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @see vect_complex_s32_to_polar
+ *
+ * @ingroup vect_complex_s32_api
+ */
+C_API
+headroom_t vect_polar_to_complex_s32(
+    complex_s32_t a[],
+    const int32_t b_mag[],
+    const radian_q24_t b_angle[],
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
 /**
  * @brief Multiply one complex 32-bit vector element-wise by another.
  *
@@ -111,6 +111,54 @@ void vect_f32_to_vect_s32(
     const unsigned length,
     const exponent_t a_exp);
 
+
+/**
+ * @brief Convert a vector of IEEE754 single-precision floats into a 32-bit BFP vector, choosing the
+ * exponent.
+ * 
+ * This function combines `vect_f32_max_exponent()` and `vect_f32_to_vect_s32()`. The output
+ * exponent @math{a\_exp} is chosen such that the mantissa vector @vector{a} has (at least) `a_hr`
+ * bits of headroom, and is returned. The result is identical to
+ * 
+ * @code{.c}
+ *  exponent_t a_exp = vect_f32_max_exponent(b, length) + a_hr;
+ *  vect_f32_to_vect_s32(a, b, length, a_exp);
+ * @endcode
+ * 
+ * Both passes extract exponents directly from the IEEE754 representation, so neither requires a
+ * per-element call to `frexpf()`.
+ * 
+ * @operation{ 
+ * &     a\_exp \leftarrow max\{ exponent(b_k) \} + a\_hr                  \\
+ * &     a_k \leftarrow round(\frac{b_k}{2^{a\_exp}})                     \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1) 
+ * }
+ * 
+ * `a[]` and `b[]` must each begin at a double-word-aligned address. `b[]` can be safely updated
+ * in-place.
+ * 
+ * @param[out]  a        Output vector @vector{a}
+ * @param[in]   b        Input vector @vector{b}
+ * @param[in]   length   Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   a_hr     Headroom to leave in @vector{a}
+ * 
+ * @returns Exponent @math{a\_exp} of output vector @vector{a}
+ * 
+ * @see vect_f32_max_exponent
+ * @see vect_f32_to_vect_s32
+ * 
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not double-word-aligned (See @ref note_vector_alignment)
+ * @exception ET_ARITHMETIC Raised if Any element of `b` is infinite or not-a-number.
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+exponent_t vect_f32_to_vect_s32_auto_exp(
+    int32_t a[],
+    const float b[], 
+    const unsigned length,
+    const headroom_t a_hr);
+
     
 /**
  * @brief Compute the inner product of two IEEE754 float vectors.
@@ -355,6 +403,891 @@ void vect_complex_f32_conj_macc(
   const complex_float_t c[],
   const unsigned length);
 
+
+/**
+ * @brief Set each element of an IEEE754 float vector to a specified value.
+ * 
+ * `a[]` is the output vector @vector{a}. `b` is the value to which each element is set.
+ * 
+ * @operation{ 
+ * &     a_k \gets b   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Value to set
+ * @param[in]   length  Number of elements in @vector{a}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_set(
+  float a[],
+  const float b,
+  const unsigned length);
+
+
+/**
+ * @brief Copy one IEEE754 float vector to another.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` is the input vector
+ * @vector{b}.
+ * 
+ * @operation{ 
+ * &     a_k \gets b_k   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_copy(
+  float a[],
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Subtract one IEEE754 float vector from another.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` and `c[]` are the
+ * input vectors @vector{b} and @vector{c} respectively.
+ * 
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k - c_k   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_sub(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length);
+
+
+/**
+ * @brief Multiply one IEEE754 float vector element-wise by another.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` and `c[]` are the
+ * input vectors @vector{b} and @vector{c} respectively.
+ * 
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k \cdot c_k   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_mul(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length);
+
+
+/**
+ * @brief Multiply an IEEE754 float vector by a scalar.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` is the input vector
+ * @vector{b}. `c` is the scalar @math{c}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k \cdot c   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   c       Scalar @math{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_scale(
+  float a[],
+  const float b[],
+  const unsigned length,
+  const float c);
+
+
+/**
+ * @brief Add a scalar to each element of an IEEE754 float vector.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` is the input vector
+ * @vector{b}. `c` is the scalar @math{c}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k + c   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   c       Scalar @math{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_add_scalar(
+  float a[],
+  const float b[],
+  const unsigned length,
+  const float c);
+
+
+/**
+ * @brief Multiply one IEEE754 float vector element-wise by another, and add the result to an accumulator vector.
+ * 
+ * `a[]` is accumulator vector @vector{a}, serving as both input and output. `b[]` and `c[]` are
+ * the input vectors @vector{b} and @vector{c} respectively.
+ * 
+ * The products are accumulated with the `FMACC` instruction on xcore.
+ * 
+ * @operation{ 
+ * &     a_k  \gets a_k + b_k \cdot c_k   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[inout]  a       Input/Output accumulator vector @vector{a}
+ * @param[in]     b       Input vector @vector{b}
+ * @param[in]     c       Input vector @vector{c}
+ * @param[in]     length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_macc(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length);
+
+
+/**
+ * @brief Multiply one IEEE754 float vector element-wise by another, and subtract the result from an accumulator vector.
+ * 
+ * `a[]` is accumulator vector @vector{a}, serving as both input and output. `b[]` and `c[]` are
+ * the input vectors @vector{b} and @vector{c} respectively.
+ * 
+ * @operation{ 
+ * &     a_k  \gets a_k - b_k \cdot c_k   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[inout]  a       Input/Output accumulator vector @vector{a}
+ * @param[in]     b       Input vector @vector{b}
+ * @param[in]     c       Input vector @vector{c}
+ * @param[in]     length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_nmacc(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length);
+
+
+/**
+ * @brief Compute the absolute value of each element of an IEEE754 float vector.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` is the input vector
+ * @vector{b}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets |b_k|   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_abs(
+  float a[],
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Rectify the elements of an IEEE754 float vector.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` is the input vector
+ * @vector{b}.
+ * 
+ * Negative elements are replaced with @math{0}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets max(b_k, 0)   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_rect(
+  float a[],
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Clamp the elements of an IEEE754 float vector to a specified range.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` is the input vector
+ * @vector{b}.
+ * `lower_bound` and `upper_bound` are the lower and upper bounds of the output range. It is
+ * assumed that `lower_bound <= upper_bound`.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets min(max(b_k, lower\_bound), upper\_bound)   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a            Output vector @vector{a}
+ * @param[in]   b            Input vector @vector{b}
+ * @param[in]   length       Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   lower_bound  Lower bound of output range
+ * @param[in]   upper_bound  Upper bound of output range
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_clip(
+  float a[],
+  const float b[],
+  const unsigned length,
+  const float lower_bound,
+  const float upper_bound);
+
+
+/**
+ * @brief Find the maximum value in an IEEE754 float vector.
+ * 
+ * `b[]` is the input vector @vector{b}. `length` must be at least 1.
+ * 
+ * @operation{ 
+ * &     a \gets max\{ b_0, b_1, ..., b_{length-1} \}
+ * }
+ * 
+ * @param[in]  b       Input vector @vector{b}
+ * @param[in]  length  Number of elements in @vector{b}
+ * 
+ * @returns Maximum value from @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+float vect_f32_max(
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Find the minimum value in an IEEE754 float vector.
+ * 
+ * `b[]` is the input vector @vector{b}. `length` must be at least 1.
+ * 
+ * @operation{ 
+ * &     a \gets min\{ b_0, b_1, ..., b_{length-1} \}
+ * }
+ * 
+ * @param[in]  b       Input vector @vector{b}
+ * @param[in]  length  Number of elements in @vector{b}
+ * 
+ * @returns Minimum value from @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+float vect_f32_min(
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Find the index of the maximum value in an IEEE754 float vector.
+ * 
+ * `b[]` is the input vector @vector{b}. `length` must be at least 1.
+ * 
+ * In the case of a tie, the lowest index is returned.
+ * 
+ * @operation{ 
+ * &     a \gets argmax_k\{ b_k \}
+ * }
+ * 
+ * @param[in]  b       Input vector @vector{b}
+ * @param[in]  length  Number of elements in @vector{b}
+ * 
+ * @returns Index of the maximum value in @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+unsigned vect_f32_argmax(
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Find the index of the minimum value in an IEEE754 float vector.
+ * 
+ * `b[]` is the input vector @vector{b}. `length` must be at least 1.
+ * 
+ * In the case of a tie, the lowest index is returned.
+ * 
+ * @operation{ 
+ * &     a \gets argmin_k\{ b_k \}
+ * }
+ * 
+ * @param[in]  b       Input vector @vector{b}
+ * @param[in]  length  Number of elements in @vector{b}
+ * 
+ * @returns Index of the minimum value in @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+unsigned vect_f32_argmin(
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Get the element-wise maximum of two IEEE754 float vectors.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` and `c[]` are the
+ * input vectors @vector{b} and @vector{c} respectively.
+ * 
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets max(b_k, c_k)   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_max_elementwise(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length);
+
+
+/**
+ * @brief Get the element-wise minimum of two IEEE754 float vectors.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` and `c[]` are the
+ * input vectors @vector{b} and @vector{c} respectively.
+ * 
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets min(b_k, c_k)   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_min_elementwise(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length);
+
+
+/**
+ * @brief Compute the sum of the elements of an IEEE754 float vector.
+ * 
+ * `b[]` is the input vector @vector{b}.
+ * 
+ * @operation{ 
+ * &     a \gets \sum_{k=0}^{length-1} b_k
+ * }
+ * 
+ * @param[in]  b       Input vector @vector{b}
+ * @param[in]  length  Number of elements in @vector{b}
+ * 
+ * @returns The sum
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+float vect_f32_sum(
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Compute the sum of the absolute values of the elements of an IEEE754 float vector.
+ * 
+ * `b[]` is the input vector @vector{b}.
+ * 
+ * @operation{ 
+ * &     a \gets \sum_{k=0}^{length-1} |b_k|
+ * }
+ * 
+ * @param[in]  b       Input vector @vector{b}
+ * @param[in]  length  Number of elements in @vector{b}
+ * 
+ * @returns The sum of absolute values
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+float vect_f32_abs_sum(
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Compute the energy (sum of squares) of an IEEE754 float vector.
+ * 
+ * `b[]` is the input vector @vector{b}.
+ * 
+ * The products are accumulated with the `FMACC` instruction on xcore.
+ * 
+ * @operation{ 
+ * &     a \gets \sum_{k=0}^{length-1} b_k^2
+ * }
+ * 
+ * @param[in]  b       Input vector @vector{b}
+ * @param[in]  length  Number of elements in @vector{b}
+ * 
+ * @returns The energy of @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+float vect_f32_energy(
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Compute the square root of each element of an IEEE754 float vector.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` is the input vector
+ * @vector{b}.
+ * 
+ * This function only computes real roots. For any @math{b_k < 0}, the corresponding output
+ * @math{a_k} is set to @math{0}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets \sqrt{b_k}   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_sqrt(
+  float a[],
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Compute the inverse of each element of an IEEE754 float vector.
+ * 
+ * `a[]` is the output vector @vector{a} into which results are placed. `b[]` is the input vector
+ * @vector{b}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k^{-1}   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_f32_inverse(
+  float a[],
+  const float b[],
+  const unsigned length);
+
+
+/**
+ * @brief Set each element of a complex IEEE754 float vector to a specified value.
+ * 
+ * `a[]` is the complex output vector @vector{a}. `b_real` and `b_imag` are the real and imaginary
+ * parts of the value to which each element is set.
+ * 
+ * @operation{ 
+ * &     Re\\{a_k\\} \gets b\_real   \\
+ * &     Im\\{a_k\\} \gets b\_imag   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Complex output vector @vector{a}
+ * @param[in]   b_real  Real part of the value to set
+ * @param[in]   b_imag  Imaginary part of the value to set
+ * @param[in]   length  Number of elements in @vector{a}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_set(
+  complex_float_t a[],
+  const float b_real,
+  const float b_imag,
+  const unsigned length);
+
+
+/**
+ * @brief Subtract one complex IEEE754 float vector from another.
+ * 
+ * `a[]` is the complex output vector @vector{a} into which results are placed. `b[]` and `c[]`
+ * are the complex input vectors @vector{b} and @vector{c} respectively.
+ * 
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k - c_k   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Complex output vector @vector{a}
+ * @param[in]   b       Complex input vector @vector{b}
+ * @param[in]   c       Complex input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_sub(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const complex_float_t c[],
+  const unsigned length);
+
+
+/**
+ * @brief Add a complex scalar to each element of a complex IEEE754 float vector.
+ * 
+ * `a[]` is the complex output vector @vector{a} into which results are placed. `b[]` is the
+ * complex input vector @vector{b}. `c` is the complex scalar @math{c}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k + c   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Complex output vector @vector{a}
+ * @param[in]   b       Complex input vector @vector{b}
+ * @param[in]   c       Complex scalar @math{c}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_add_scalar(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const complex_float_t c,
+  const unsigned length);
+
+
+/**
+ * @brief Multiply a complex IEEE754 float vector element-wise by a real IEEE754 float vector.
+ * 
+ * `a[]` is the complex output vector @vector{a} into which results are placed. `b[]` is the
+ * complex input vector @vector{b}. `c[]` is the real input vector @vector{c}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k \cdot c_k   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Complex output vector @vector{a}
+ * @param[in]   b       Complex input vector @vector{b}
+ * @param[in]   c       Real input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_real_mul(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const float c[],
+  const unsigned length);
+
+
+/**
+ * @brief Multiply a complex IEEE754 float vector by a real scalar.
+ * 
+ * `a[]` is the complex output vector @vector{a} into which results are placed. `b[]` is the
+ * complex input vector @vector{b}. `c` is the real scalar @math{c}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k \cdot c   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Complex output vector @vector{a}
+ * @param[in]   b       Complex input vector @vector{b}
+ * @param[in]   c       Real scalar @math{c}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_real_scale(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const float c,
+  const unsigned length);
+
+
+/**
+ * @brief Multiply a complex IEEE754 float vector by a complex scalar.
+ * 
+ * `a[]` is the complex output vector @vector{a} into which results are placed. `b[]` is the
+ * complex input vector @vector{b}. `c_real` and `c_imag` are the real and imaginary parts of the complex scalar @math{c}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k \cdot c   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Complex output vector @vector{a}
+ * @param[in]   b       Complex input vector @vector{b}
+ * @param[in]   c_real  Real part of @math{c}
+ * @param[in]   c_imag  Imaginary part of @math{c}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_scale(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const float c_real,
+  const float c_imag,
+  const unsigned length);
+
+
+/**
+ * @brief Subtract the product of two complex IEEE754 float vectors from a third.
+ * 
+ * `a[]` is accumulator vector @vector{a}, serving as both input and output. `b[]` and `c[]` are
+ * the complex input vectors @vector{b} and @vector{c} respectively.
+ * 
+ * @operation{ 
+ * &     a_k  \gets a_k - b_k \cdot c_k   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[inout]  a       Input/Output accumulator vector @vector{a}
+ * @param[in]     b       Complex input vector @vector{b}
+ * @param[in]     c       Complex input vector @vector{c}
+ * @param[in]     length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_nmacc(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const complex_float_t c[],
+  const unsigned length);
+
+
+/**
+ * @brief Subtract the product of a complex IEEE754 float vector and the conjugate of another from a third.
+ * 
+ * `a[]` is accumulator vector @vector{a}, serving as both input and output. `b[]` and `c[]` are
+ * the complex input vectors @vector{b} and @vector{c} respectively.
+ * 
+ * @operation{ 
+ * &     a_k  \gets a_k - b_k \cdot (c_k^*)   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[inout]  a       Input/Output accumulator vector @vector{a}
+ * @param[in]     b       Complex input vector @vector{b}
+ * @param[in]     c       Complex input vector @vector{c}
+ * @param[in]     length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_conj_nmacc(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const complex_float_t c[],
+  const unsigned length);
+
+
+/**
+ * @brief Get the complex conjugate of each element of a complex IEEE754 float vector.
+ * 
+ * `a[]` is the complex output vector @vector{a} into which results are placed. `b[]` is the
+ * complex input vector @vector{b}.
+ * 
+ * This operation can be performed safely in-place on `b[]`.
+ * 
+ * @operation{ 
+ * &     a_k  \gets b_k^*   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Complex output vector @vector{a}
+ * @param[in]   b       Complex input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_conjugate(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const unsigned length);
+
+
+/**
+ * @brief Compute the squared magnitude of each element of a complex IEEE754 float vector.
+ * 
+ * `a[]` is the real output vector @vector{a}. `b[]` is the complex input vector @vector{b}.
+ * 
+ * @operation{ 
+ * &     a_k  \gets {Re\\{b_k\\}}^2 + {Im\\{b_k\\}}^2   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Real output vector @vector{a}
+ * @param[in]   b       Complex input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_squared_mag(
+  float a[],
+  const complex_float_t b[],
+  const unsigned length);
+
+
+/**
+ * @brief Compute the magnitude of each element of a complex IEEE754 float vector.
+ * 
+ * `a[]` is the real output vector @vector{a}. `b[]` is the complex input vector @vector{b}.
+ * 
+ * @operation{ 
+ * &     a_k  \gets \sqrt{ {Re\\{b_k\\}}^2 + {Im\\{b_k\\}}^2 }   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Real output vector @vector{a}
+ * @param[in]   b       Complex input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+void vect_complex_f32_mag(
+  float a[],
+  const complex_float_t b[],
+  const unsigned length);
+
+
+/**
+ * @brief Compute the sum of the elements of a complex IEEE754 float vector.
+ * 
+ * `b[]` is the complex input vector @vector{b}.
+ * 
+ * @operation{ 
+ * &     a \gets \sum_{k=0}^{length-1} b_k
+ * }
+ * 
+ * @param[in]  b       Complex input vector @vector{b}
+ * @param[in]  length  Number of elements in @vector{b}
+ * 
+ * @returns The complex sum
+ * 
+ * @ingroup vect_f32_api
+ */
+C_API
+complex_float_t vect_complex_f32_sum(
+  const complex_float_t b[],
+  const unsigned length);
+
 #ifdef __XC__
 }   //extern "C"
 #endif
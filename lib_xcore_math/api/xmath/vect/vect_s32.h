@@ -552,6 +552,71 @@ int64_t vect_s32_energy(
     const right_shift_t b_shr);
 
 
+/**
+ * @brief Compute the autocorrelation of a 32-bit vector at a number of lags.
+ *
+ * `a[]` represents the 32-bit output mantissa vector @vector{a}, with one element per lag.
+ *
+ * `b[]` represents the 32-bit input mantissa vector @vector{b}.
+ *
+ * `a[]` and `b[]` must each begin at a word-aligned address, and may not overlap.
+ *
+ * `length` is the number of elements in @vector{b}, and `lag_count` the number of elements in
+ * @vector{a}. `lag_count` must not be greater than `length`.
+ *
+ * `b_shr` is the signed arithmetic right-shift applied to each element of @vector{b}, as for
+ * vect_s32_dot(). `a_shr` is the signed arithmetic right-shift applied to each (64-bit) inner
+ * product to produce the 32-bit outputs.
+ *
+ * Each lag is computed as an inner product using vect_s32_dot(), so the cost is proportional to
+ * @math{length \cdot lag\_count}. For many lags, bfp_s32_autocorr() can instead use an FFT.
+ *
+ * @operation{
+ * &     b_k' \leftarrow sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)                     \\
+ * &     a_k \leftarrow sat_{32}\left( round\left( 2^{-a\_shr} \sum_{n=0}^{length-1-k}
+ *                  round( b_n' \cdot b_{n+k}' \cdot 2^{-30} ) \right) \right)                \\
+ * &     \qquad\text{ for }k\in 0\ ...\ (lag\_count-1)
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If @vector{b} are the mantissas of the BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then
+ * @vector{a} are the mantissas of the BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, where
+ * @math{a\_exp = 2 \cdot (b\_exp + b\_shr) + 30 + a\_shr}.
+ *
+ * The function vect_s32_energy_prepare() can be used to obtain a value for `b_shr`. Because no
+ * lag has a larger magnitude than lag 0, `a_shr` can be chosen from @math{a_0}, i.e. from the
+ * result of vect_s32_energy().
+ * @endparblock
+ *
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in vector @vector{b}
+ * @param[in]   lag_count   Number of elements in vector @vector{a}
+ * @param[in]   b_shr       Right-shift applied to @vector{b}
+ * @param[in]   a_shr       Right-shift applied to the inner products
+ *
+ * @returns     Headroom of the output vector @vector{a}
+ *
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @see vect_s32_dot,
+ *      vect_s32_energy_prepare,
+ *      bfp_s32_autocorr
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+headroom_t vect_s32_autocorr(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const unsigned lag_count,
+    const right_shift_t b_shr,
+    const right_shift_t a_shr);
+
+
 /**
  * @brief Calculate the headroom of a 32-bit vector.
  *
@@ -640,6 +705,64 @@ headroom_t vect_s32_inverse(
     const unsigned scale);
 
 
+/**
+ * @brief Divide one 32-bit vector by another, elementwise.
+ *
+ * `a[]`, `b[]` and `c[]` represent the 32-bit mantissa vectors @vector{a}, @vector{b} and
+ * @vector{c} respectively. Each vector must begin at a word-aligned address. This operation can be
+ * performed safely in-place on `b[]` or `c[]`.
+ *
+ * `length` is the number of elements in each of the vectors.
+ *
+ * `scale` is the power of 2 by which the dividend is multiplied, and is used to maximize the
+ * precision of the result. It may be negative.
+ *
+ * Each quotient is correctly rounded, with ties rounded away from zero, and saturates to the
+ * 32-bit range. Division by zero gives `INT32_MAX` or `INT32_MIN` according to the sign of
+ * @math{b_k}, or @math{0} where @math{b_k} is also @math{0}. The quotient is computed without a
+ * hardware divide: a reciprocal of each divisor is estimated with Newton-Raphson iterations from
+ * a linear seed, and the resulting quotient is corrected using its remainder.
+ *
+ * @operation{
+ * &     a_k \leftarrow sat_{32}\left( round\left( \frac{b_k \cdot 2^{scale}}{c_k} \right) \right)  \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If @vector{b} and @vector{c} are the mantissas of BFP vectors @math{\bar{b} \cdot 2^{b\_exp}}
+ * and @math{\bar{c} \cdot 2^{c\_exp}}, then the resulting vector @vector{a} are the mantissas of
+ * BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, where @math{a\_exp = b\_exp - c\_exp - scale}.
+ *
+ * The function vect_s32_divide_prepare() can be used to obtain values for @math{a\_exp} and
+ * @math{scale}.
+ * @endparblock
+ *
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Dividend vector @vector{b}
+ * @param[in]   c           Divisor vector @vector{c}
+ * @param[in]   length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]   scale       Power of 2 applied to the dividend
+ *
+ * @returns     Headroom of output vector @vector{a}
+ *
+ * @exception ET_LOAD_STORE Raised if `a`, `b` or `c` is not word-aligned (See @ref
+ * note_vector_alignment)
+ *
+ * @see vect_s32_divide_prepare
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+headroom_t vect_s32_divide(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const left_shift_t scale);
+
+
 /**
  * @brief Find the maximum value in a 32-bit vector.
  *
@@ -1297,6 +1420,72 @@ headroom_t vect_s32_sqrt(
     const unsigned depth);
 
 
+/**
+ * @brief Compute an approximate square root of elements of a 32-bit vector.
+ *
+ * This is a faster alternative to vect_s32_sqrt() with the same input and output formats. Rather
+ * than computing the result one bit at a time, an estimate of @math{1/\sqrt{b_k'}} is taken from
+ * a small table and refined with Newton-Raphson iterations, each of which roughly doubles the
+ * number of correct bits. No division is required.
+ *
+ * `a[]` and `b[]` represent the 32-bit mantissa vectors @vector{a} and @vector{b} respectively.
+ * Each vector must begin at a word-aligned address. This operation can be performed safely in-place
+ * on `b[]`.
+ *
+ * `length` is the number of elements in each of the vectors.
+ *
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b}.
+ *
+ * `iterations` is the number of Newton-Raphson iterations applied, and selects the accuracy tier.
+ * Non-positive @math{b_k'} give @math{0}. Otherwise the error bounds are:
+ *
+ * * `0`: within 0.8% (@math{2^{-7}}) relative
+ * * `1`: within 0.01% (@math{2^{-13}}) relative
+ * * `2`: within @math{2^{-20}} relative
+ * * `3` or more: within 2 LSbs
+ *
+ * @operation{
+ * &     b_k' \leftarrow sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)     \\
+ * &     a_k \leftarrow \sqrt{ b_k' }                                        \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If @vector{b} are the mantissas of BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the resulting
+ * vector @vector{a} are the mantissas of BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, where
+ * @math{a\_exp = (b\_exp + b\_shr - 30)/2}.
+ *
+ * Note that because exponents must be integers, that means @math{b\_exp + b\_shr} **must be even**.
+ *
+ * The function vect_s32_sqrt_prepare() can be used to obtain values for @math{a\_exp} and
+ * @math{b\_shr} based on the input exponent @math{b\_exp} and headroom @math{b\_hr}.
+ * @endparblock
+ *
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr       Right-shift appled to @vector{b}
+ * @param[in]   iterations  Number of Newton-Raphson iterations
+ *
+ * @returns     Headroom of output vector @vector{a}
+ *
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @see vect_s32_sqrt
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+headroom_t vect_s32_sqrt_fast(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const unsigned iterations);
+
+
 /**
  * @brief Subtract one 32-bit vector from another.
  *
@@ -2113,61 +2302,714 @@ void vect_q30_exp_small(
 
 
 /**
- * @brief Convert a 32-bit vector to a 16-bit vector.
+ * @brief Compute @math{e^x} for each element of a 32-bit BFP vector.
  *
- * This function converts a 32-bit mantissa vector @vector{b} into a 16-bit mantissa vector
- * @vector{a}. Conceptually, the output BFP vector @math{\bar{a}\cdot 2^{a\_exp}} represents the
- * same values as the input BFP vector @math{\bar{b}\cdot 2^{b\_exp}}, only with a reduced
- * bit-depth.
+ * This function computes @math{e^{b_k \cdot 2^{b\_exp}}} for each element @math{b_k} of input
+ * vector @vector{b}. Unlike vect_q30_exp_small(), the input may take any value. The results are
+ * placed in output vector @vector{a} with a common exponent @math{a\_exp}, which is chosen by this
+ * function to suit the largest result.
  *
- * In most cases @math{b\_shr} should be @math{16 - b\_hr}, where @math{b\_hr} is the headroom of
- * the 32-bit input mantissa vector @vector{b}.
+ * Each element is range-reduced to @math{2^n \cdot e^z}, with @math{\left|z\right| \le ln(2)/2},
+ * and @math{e^z} is evaluated over whole blocks of the vector with vect_q30_exp_small().
  *
- * The output exponent @math{a\_exp} will be given by
+ * `a[]` and `b[]` must begin at a word-aligned address. This operation can be performed safely
+ * in-place on `b[]`.
  *
- * @math{ a\_exp = b\_exp + b\_shr }
+ * @operation{
+ * &  a_k \cdot 2^{a\_exp} \leftarrow  e^{b_k \cdot 2^{b\_exp}} \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
  *
- * @par Parameter Details
- * @parblock
+ * @param[out]  a       Output vector @vector{a}
+ * @param[out]  a_exp   Output exponent @math{a\_exp}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   b_exp   Exponent associated with @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
  *
- * `a[]` represents the 16-bit output mantissa vector @vector{a}.
+ * @returns Headroom of output vector @vector{a}
  *
- * `b[]` represents the 32-bit input mantissa vector @vector{b}.
+ * @see vect_float_s32_exp,
+ *      float_s32_exp
  *
- * `a[]` and `b[]` must each begin at a word-aligned address.
+ * @ingroup vect_s32_api
+ */
+C_API
+headroom_t vect_s32_exp(
+    int32_t a[],
+    exponent_t* a_exp,
+    const int32_t b[],
+    const exponent_t b_exp,
+    const unsigned length);
+
+
+/**
+ * @brief Compute @math{e^x} for each element of a vector of `float_s32_t`.
  *
- * `length` is the number of elements in each of the vectors.
+ * This function computes @math{e^{b_k}} for each element @math{b_k} of input vector @vector{b}.
+ * This is the vector equivalent of float_s32_exp(); each output element has its own exponent.
  *
- * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b}.
- * @endparblock
+ * This operation can be performed safely in-place on `b[]`.
  *
  * @operation{
- * &     a_k \leftarrow sat_{16}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)      \\
- * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * &  a_k \leftarrow  e^{b_k} \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
  * }
  *
- * @par Block Floating-Point
- * @parblock
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
  *
- * If @vector{b} are the 32-bit mantissas of a BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the
- * resulting vector @vector{a} are the 16-bit mantissas of BFP vector @math{\bar{a} \cdot
- * 2^{a\_exp}}, where @math{a\_exp = b\_exp + b\_shr}.
- * @endparblock
+ * @see vect_s32_exp,
+ *      float_s32_exp
  *
- * @param[out]  a        Output vector @vector{a}
- * @param[in]   b        Input vector @vector{b}
- * @param[in]   length   Number of elements in vectors @vector{a} and @vector{b}
- * @param[in]   b_shr    Right-shift appled to @vector{b}
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_float_s32_exp(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const unsigned length);
+
+
+/**
+ * @brief Multiply two vectors of `float_s32_t` element-wise.
  *
- * @see vect_s16_to_vect_s32
+ * This is the vector equivalent of float_s32_mul(). Each element has its own exponent, and the
+ * results are identical to applying float_s32_mul() to each element in turn.
  *
- * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  b_k \cdot c_k \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ *
+ * @see float_s32_mul
  *
  * @ingroup vect_s32_api
  */
 C_API
-void vect_s32_to_vect_s16(
-    int16_t a[],
+void vect_float_s32_mul(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length);
+
+
+/**
+ * @brief Multiply a vector of `float_s32_t` by a `float_s32_t` scalar.
+ *
+ * This is the vector equivalent of float_s32_mul() with a common second operand; each element has
+ * its own exponent, and the results are identical to applying float_s32_mul() to each element in
+ * turn.
+ *
+ * This operation can be performed safely in-place on `b[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  b_k \cdot c \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Scalar @math{c}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ *
+ * @see float_s32_mul
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_float_s32_scale(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c,
+    const unsigned length);
+
+
+/**
+ * @brief Add two vectors of `float_s32_t` element-wise.
+ *
+ * This is the vector equivalent of float_s32_add(). Each element has its own exponent, and the
+ * results are identical to applying float_s32_add() to each element in turn.
+ *
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  b_k + c_k \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ *
+ * @see float_s32_add
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_float_s32_add(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length);
+
+
+/**
+ * @brief Subtract one vector of `float_s32_t` from another element-wise.
+ *
+ * This is the vector equivalent of float_s32_sub(). Each element has its own exponent, and the
+ * results are identical to applying float_s32_sub() to each element in turn.
+ *
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  b_k - c_k \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ *
+ * @see float_s32_sub
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_float_s32_sub(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length);
+
+
+/**
+ * @brief Multiply two vectors of `float_s32_t` element-wise and add the products to an accumulator.
+ *
+ * Each element @math{acc_k} of the accumulator vector is updated with the product of
+ * @math{b_k} and @math{c_k}. Each element has its own exponent; the results are identical to
+ * `acc[k] = float_s32_add(acc[k], float_s32_mul(b[k], c[k]))`.
+ *
+ * @operation{
+ * &  acc_k \leftarrow  acc_k + b_k \cdot c_k \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[inout]  acc     Accumulator vector @vector{acc}
+ * @param[in]     b       Input vector @vector{b}
+ * @param[in]     c       Input vector @vector{c}
+ * @param[in]     length  Number of elements in vectors @vector{acc}, @vector{b} and @vector{c}
+ *
+ * @see float_s32_mul,
+ *      float_s32_add
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_float_s32_macc(
+    float_s32_t acc[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length);
+
+
+/**
+ * @brief Update a vector of exponential moving averages.
+ *
+ * This is the vector equivalent of float_s32_ema(). Each element @math{acc_k} is the state of an
+ * exponential moving average, and is updated with the new sample @math{b_k}. A typical use is
+ * tracking per-bin power spectra whose elements span a wide dynamic range.
+ *
+ * `coef` is a fixed-point value in a UQ2.30 format (i.e. has an implied exponent of @math{-30}),
+ * and should be in the range @math{0 \leq \alpha \leq 1}.
+ *
+ * @operation{
+ * &  acc_k \leftarrow  \alpha \cdot acc_k + (1 - \alpha) \cdot b_k \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[inout]  acc     EMA state vector @vector{acc}
+ * @param[in]     b       New samples @vector{b}
+ * @param[in]     coef    EMA coefficient @math{\alpha} encoded in UQ2.30 format
+ * @param[in]     length  Number of elements in vectors @vector{acc} and @vector{b}
+ *
+ * @see float_s32_ema
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_float_s32_ema(
+    float_s32_t acc[],
+    const float_s32_t b[],
+    const uq2_30 coef,
+    const unsigned length);
+
+
+/**
+ * @brief Compare two vectors of `float_s32_t` element-wise.
+ *
+ * Each output element @math{a_k} is set to 1 if @math{b_k > c_k}, and to 0 otherwise. The
+ * comparison is exact, including for values which differ only in the least significant bit of
+ * their mantissas.
+ *
+ * @operation{
+ * &  a_k \leftarrow  \begin{cases}
+ *           1  &   b_k > c_k             \\
+ *           0  &   otherwise
+ *       \end{cases} \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ *
+ * @see float_s32_gt
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_float_s32_gt(
+    int8_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length);
+
+
+/**
+ * @brief Get the element-wise maximum of two vectors of `float_s32_t`.
+ *
+ * Each output element is a copy of the larger of @math{b_k} and @math{c_k}, including its exponent.
+ * The comparison is exact, and @math{b_k} is chosen if the two are equal.
+ *
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  max(b_k, c_k) \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ *
+ * @see float_s32_gte
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_float_s32_max_elementwise(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length);
+
+
+/**
+ * @brief Get the element-wise minimum of two vectors of `float_s32_t`.
+ *
+ * Each output element is a copy of the smaller of @math{b_k} and @math{c_k}, including its
+ * exponent. The comparison is exact, and @math{b_k} is chosen if the two are equal.
+ *
+ * This operation can be performed safely in-place on `b[]` or `c[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  min(b_k, c_k) \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}
+ * @param[in]   c       Input vector @vector{c}
+ * @param[in]   length  Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ *
+ * @see float_s32_gte
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_float_s32_min_elementwise(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length);
+
+
+/**
+ * @brief Compute the sine of a vector of angles in sbrads.
+ *
+ * This function computes @math{sin(\frac{\pi}{2}b_k)} for each element @math{b_k} of input vector
+ * @vector{b}, which holds angles in sbrads (see @ref sbrad_t), and places the results in output
+ * vector @vector{a} as Q2.30 values. This is the vector equivalent of sbrad_sin(), and accepts the
+ * full sbrad range.
+ *
+ * `a[]` and `b[]` must begin at a word-aligned address. This operation can be performed safely
+ * in-place on `b[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  sin\left(\frac{\pi}{2}b_k\right) \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output Q2.30 vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}, in sbrads
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ *
+ * @see sbrad_sin,
+ *      radians_to_sbrads
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_sbrad_sin(
+    q2_30 a[],
+    const sbrad_t b[],
+    const unsigned length);
+
+
+/**
+ * @brief Compute the sine of a vector of angles in radians.
+ *
+ * This function computes @math{sin(b_k)} for each element @math{b_k} of input vector @vector{b},
+ * which holds angles in radians as Q8.24 values. The results are placed in output vector
+ * @vector{a} as Q2.30 values. This is the vector equivalent of q24_sin().
+ *
+ * `a[]` and `b[]` must begin at a word-aligned address. This operation can be performed safely
+ * in-place on `b[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  sin\left(b_k\right) \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output Q2.30 vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}, in radians (Q8.24)
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ *
+ * @see q24_sin,
+ *      vect_sbrad_sin
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_s32_sin(
+    q2_30 a[],
+    const radian_q24_t b[],
+    const unsigned length);
+
+
+/**
+ * @brief Compute the cosine of a vector of angles in radians.
+ *
+ * This function computes @math{cos(b_k)} for each element @math{b_k} of input vector @vector{b},
+ * which holds angles in radians as Q8.24 values. The results are placed in output vector
+ * @vector{a} as Q2.30 values. This is the vector equivalent of q24_cos().
+ *
+ * `a[]` and `b[]` must begin at a word-aligned address. This operation can be performed safely
+ * in-place on `b[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  cos\left(b_k\right) \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output Q2.30 vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}, in radians (Q8.24)
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ *
+ * @see q24_cos,
+ *      vect_sbrad_sin
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_s32_cos(
+    q2_30 a[],
+    const radian_q24_t b[],
+    const unsigned length);
+
+
+/**
+ * @brief Compute the tangent of a vector of angles in radians.
+ *
+ * This function computes @math{tan(b_k)} for each element @math{b_k} of input vector @vector{b},
+ * which holds angles in radians as Q8.24 values. The results are placed in output vector
+ * @vector{a} as `float_s32_t` values. This is the vector equivalent of q24_tan().
+ *
+ * The value of @math{tan(\theta)} is undefined where @math{\theta=\frac{\pi}{2}+k\pi} for any
+ * integer @math{k}. For such inputs a very large value is produced.
+ *
+ * @operation{
+ * &  a_k \leftarrow  tan\left(b_k\right) \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output vector @vector{a}
+ * @param[in]   b       Input vector @vector{b}, in radians (Q8.24)
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ *
+ * @see q24_tan
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_s32_tan(
+    float_s32_t a[],
+    const radian_q24_t b[],
+    const unsigned length);
+
+
+/**
+ * @brief Evaluate the logistic function for each element of a vector.
+ *
+ * This function computes the logistic function @math{\frac{1}{1+e^{-b_k}}} for each element
+ * @math{b_k} of input vector @vector{b}, and places the results in output vector @vector{a}. Both
+ * input and output are Q8.24 values. This is the vector equivalent of q24_logistic().
+ *
+ * @math{e^{-\left|b_k\right|}} is computed with vect_s32_exp() and the denominator is inverted with
+ * vect_s32_inverse(), so no scalar function is called per element.
+ *
+ * `a[]` and `b[]` must begin at a word-aligned address. This operation can be performed safely
+ * in-place on `b[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  \frac{1}{1+e^{-b_k}} \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output Q8.24 vector @vector{a}
+ * @param[in]   b       Input Q8.24 vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ *
+ * @see q24_logistic,
+ *      vect_s32_tanh
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_s32_logistic(
+    q8_24 a[],
+    const q8_24 b[],
+    const unsigned length);
+
+
+/**
+ * @brief Evaluate the hyperbolic tangent for each element of a vector.
+ *
+ * This function computes @math{tanh(b_k)} for each element @math{b_k} of input vector @vector{b},
+ * which holds Q8.24 values. The results are placed in output vector @vector{a} as Q2.30 values.
+ *
+ * `a[]` and `b[]` must begin at a word-aligned address. This operation can be performed safely
+ * in-place on `b[]`.
+ *
+ * @operation{
+ * &  a_k \leftarrow  tanh\left(b_k\right) \\
+ * &      \qquad\text{for }k \in \{0..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output Q2.30 vector @vector{a}
+ * @param[in]   b       Input Q8.24 vector @vector{b}
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ *
+ * @see vect_s32_logistic
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_s32_tanh(
+    q2_30 a[],
+    const q8_24 b[],
+    const unsigned length);
+
+
+/**
+ * @brief Unwrap a sequence of phase angles.
+ *
+ * Input vector @vector{b} is a sequence of angles in radians (Q8.24), such as those produced by
+ * vect_complex_s32_angle(), which are only known modulo @math{2\pi}. This function produces output
+ * vector @vector{a} by adding multiples of @math{2\pi} so that no step between consecutive elements
+ * exceeds @math{\pi} in magnitude.
+ *
+ * The first element is unchanged. Results which would exceed the range of Q8.24 saturate, so the
+ * total phase change over the vector should be less than @math{\pm128} radians.
+ *
+ * `a[]` and `b[]` must begin at a word-aligned address. This operation can be performed safely
+ * in-place on `b[]`.
+ *
+ * @operation{
+ * &  a_0 \leftarrow b_0 \\
+ * &  a_k \leftarrow a_{k-1} + \left( \left(b_k - b_{k-1} + \pi\right) \bmod 2\pi \right) - \pi \\
+ * &      \qquad\text{for }k \in \{1..(\mathtt{length}-1)\}
+ * }
+ *
+ * @param[out]  a       Output vector @vector{a}, in radians (Q8.24)
+ * @param[in]   b       Input vector @vector{b}, in radians (Q8.24)
+ * @param[in]   length  Number of elements in vectors @vector{a} and @vector{b}
+ *
+ * @see vect_complex_s32_angle,
+ *      vect_complex_s16_angle
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_s32_unwrap_phase(
+    radian_q24_t a[],
+    const radian_q24_t b[],
+    const unsigned length);
+
+
+/**
+ * @brief Convert a 32-bit vector to a 16-bit vector.
+ *
+ * This function converts a 32-bit mantissa vector @vector{b} into a 16-bit mantissa vector
+ * @vector{a}. Conceptually, the output BFP vector @math{\bar{a}\cdot 2^{a\_exp}} represents the
+ * same values as the input BFP vector @math{\bar{b}\cdot 2^{b\_exp}}, only with a reduced
+ * bit-depth.
+ *
+ * In most cases @math{b\_shr} should be @math{16 - b\_hr}, where @math{b\_hr} is the headroom of
+ * the 32-bit input mantissa vector @vector{b}.
+ *
+ * The output exponent @math{a\_exp} will be given by
+ *
+ * @math{ a\_exp = b\_exp + b\_shr }
+ *
+ * @par Parameter Details
+ * @parblock
+ *
+ * `a[]` represents the 16-bit output mantissa vector @vector{a}.
+ *
+ * `b[]` represents the 32-bit input mantissa vector @vector{b}.
+ *
+ * `a[]` and `b[]` must each begin at a word-aligned address.
+ *
+ * `length` is the number of elements in each of the vectors.
+ *
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b}.
+ * @endparblock
+ *
+ * @operation{
+ * &     a_k \leftarrow sat_{16}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)      \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If @vector{b} are the 32-bit mantissas of a BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the
+ * resulting vector @vector{a} are the 16-bit mantissas of BFP vector @math{\bar{a} \cdot
+ * 2^{a\_exp}}, where @math{a\_exp = b\_exp + b\_shr}.
+ * @endparblock
+ *
+ * @param[out]  a        Output vector @vector{a}
+ * @param[in]   b        Input vector @vector{b}
+ * @param[in]   length   Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr    Right-shift appled to @vector{b}
+ *
+ * @see vect_s16_to_vect_s32
+ *
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_s32_to_vect_s16(
+    int16_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Apply a rectified linear unit to a 32-bit vector and requantize to 16 bits.
+ *
+ * This function rectifies each element of 32-bit input vector @vector{b}, as vect_s32_rect() does,
+ * and then converts the result to a 16-bit value as vect_s32_to_vect_s16() does. This is the usual
+ * activation step following a layer computed with 32-bit accumulators.
+ *
+ * `a[]` and `b[]` must begin at a word-aligned address.
+ *
+ * @operation{
+ * &     a_k \leftarrow sat_{16}(round(max(b_k, 0) \cdot 2^{-b\_shr}))      \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If @vector{b} are the 32-bit mantissas of a BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the
+ * resulting vector @vector{a} are the 16-bit mantissas of BFP vector @math{\bar{a} \cdot
+ * 2^{a\_exp}}, where @math{a\_exp = b\_exp + b\_shr}.
+ * @endparblock
+ *
+ * @param[out]  a        Output vector @vector{a}
+ * @param[in]   b        Input vector @vector{b}
+ * @param[in]   length   Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr    Right-shift appled to @vector{b}
+ *
+ * @see vect_s32_rect,
+ *      vect_s32_to_vect_s16,
+ *      vect_s32_relu_to_vect_s8
+ *
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_s32_relu_to_vect_s16(
+    int16_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Apply a rectified linear unit to a 32-bit vector and requantize to 8 bits.
+ *
+ * This function rectifies each element of 32-bit input vector @vector{b} and then converts the
+ * result to a saturated 8-bit value, for example to feed the next layer of a network through
+ * mat_mul_s8_x_s8_yield_s32().
+ *
+ * `a[]` and `b[]` must begin at a word-aligned address.
+ *
+ * @operation{
+ * &     a_k \leftarrow sat_{8}(round(max(b_k, 0) \cdot 2^{-b\_shr}))      \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If @vector{b} are the 32-bit mantissas of a BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the
+ * resulting vector @vector{a} are the 8-bit mantissas of BFP vector @math{\bar{a} \cdot
+ * 2^{a\_exp}}, where @math{a\_exp = b\_exp + b\_shr}.
+ * @endparblock
+ *
+ * @param[out]  a        Output vector @vector{a}
+ * @param[in]   b        Input vector @vector{b}
+ * @param[in]   length   Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr    Right-shift appled to @vector{b}
+ *
+ * @see vect_s32_rect,
+ *      vect_s32_relu_to_vect_s16
+ *
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @ingroup vect_s32_api
+ */
+C_API
+void vect_s32_relu_to_vect_s8(
+    int8_t a[],
     const int32_t b[],
     const unsigned length,
     const right_shift_t b_shr);
@@ -355,6 +355,50 @@ void vect_s32_inverse_prepare(
     const unsigned length);
 
 
+/**
+ * @brief Obtain the output exponent and scale used by vect_s32_divide().
+ *
+ * This function is used in conjunction with vect_s32_divide() to compute the elementwise quotient
+ * of two 32-bit BFP vectors.
+ *
+ * This function computes `a_exp` and `scale`.
+ *
+ * `a_exp` is the exponent associated with output mantissa vector @vector{a}. The largest quotient
+ * is produced by the largest possible dividend and the smallest divisor, so this function chooses
+ * `a_exp` based on the headroom of @vector{b} and the smallest magnitude non-zero element of
+ * @vector{c}. It is the smallest exponent known to avoid saturation.
+ *
+ * `scale` is a scaling parameter used by vect_s32_divide() to achieve the chosen output exponent.
+ *
+ * `b_exp` and `b_hr` are the exponent and headroom of the dividend mantissa vector @vector{b}.
+ *
+ * `c[]` is the divisor mantissa vector @vector{c}, and `c_exp` is its exponent.
+ *
+ * `length` is the number of elements in @vector{c}.
+ *
+ * @param[out]  a_exp       Exponent of output vector @vector{a}
+ * @param[out]  scale       Scale factor to be applied to the dividend
+ * @param[in]   b_exp       Exponent of @vector{b}
+ * @param[in]   b_hr        Headroom of @vector{b}
+ * @param[in]   c           Divisor vector @vector{c}
+ * @param[in]   c_exp       Exponent of @vector{c}
+ * @param[in]   length      Number of elements in vector @vector{c}
+ *
+ * @see vect_s32_divide
+ *
+ * @ingroup vect_s32_prepare_api
+ */
+C_API
+void vect_s32_divide_prepare(
+    exponent_t* a_exp,
+    left_shift_t* scale,
+    const exponent_t b_exp,
+    const headroom_t b_hr,
+    const int32_t c[],
+    const exponent_t c_exp,
+    const unsigned length);
+
+
 /**
  * @brief Obtain the output exponent and shifts needed by vect_s32_macc().
  *
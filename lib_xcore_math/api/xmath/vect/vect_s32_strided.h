@@ -0,0 +1,351 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#pragma once
+
+#include "xmath/xmath_conf.h"
+#include "xmath/types.h"
+#include "xmath/util.h"
+
+/**
+ * @defgroup vect_s32_strided_api   32-bit Strided Vector Functions
+ *
+ * These functions operate on 32-bit vectors whose elements are not necessarily contiguous in
+ * memory. Each vector operand @vector{x} is described by a pointer `x[]` and a stride `x_stride`,
+ * such that element @math{x_k} is found at `x[k * x_stride]`. A stride of @math{1} describes an
+ * ordinary contiguous vector, and a stride of @math{C} can be used to address a single channel of
+ * a buffer holding @math{C} interleaved channels.
+ *
+ * Strides are expressed in elements, not bytes. Each function produces exactly the same results as
+ * the corresponding contiguous function (e.g. vect_s32_mul_strided() and vect_s32_mul()), so the
+ * usual `*_prepare()` functions can be used to choose shifts and output exponents.
+ *
+ * Internally, strided operands are processed in blocks of @ref VECT_S32_STRIDED_BLOCK elements,
+ * which are gathered into word-aligned scratch buffers on the stack, processed by the contiguous
+ * (VPU-accelerated) function and scattered back. When all strides are @math{1}, the contiguous
+ * function is called directly.
+ */
+
+#ifdef __XC__
+extern "C" {
+#endif
+
+
+/**
+ * Number of elements gathered from each strided operand per block.
+ *
+ * Each strided function uses up to three stack buffers of this many `int32_t`s.
+ *
+ * @ingroup vect_s32_strided_api
+ */
+#define VECT_S32_STRIDED_BLOCK    (32)
+
+
+/**
+ * @brief Copy one (strided) 32-bit vector to another (strided) 32-bit vector.
+ *
+ * Copies `length` elements from @vector{b} into @vector{a}. This can be used to gather a channel
+ * out of an interleaved buffer (`a_stride = 1`), to scatter a vector into an interleaved buffer
+ * (`b_stride = 1`), or both.
+ *
+ * `a[]` and `b[]` must not overlap unless `a == b` and `a_stride == b_stride`.
+ *
+ * Unlike vect_s32_copy(), `length` need not be a multiple of @math{8}.
+ *
+ * @operation{
+ * &    a_{k \cdot a\_stride} \leftarrow b_{k \cdot b\_stride}        \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ *
+ * @param[out]  a         Output vector @vector{a}
+ * @param[in]   a_stride  Stride of @vector{a} (in elements)
+ * @param[in]   b         Input vector @vector{b}
+ * @param[in]   b_stride  Stride of @vector{b} (in elements)
+ * @param[in]   length    Number of elements in @vector{a} and @vector{b}
+ *
+ * @returns   Headroom of output vector @vector{a}
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+headroom_t vect_s32_copy_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length);
+
+
+/**
+ * @brief Calculate the headroom of a strided 32-bit vector.
+ *
+ * Equivalent to vect_s32_headroom() applied to the elements @math{x_{k \cdot x\_stride}}.
+ *
+ * @param[in] x         Input vector @vector{x}
+ * @param[in] x_stride  Stride of @vector{x} (in elements)
+ * @param[in] length    Number of elements in @vector{x}
+ *
+ * @returns Headroom of vector @vector{x}
+ *
+ * @see vect_s32_headroom
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+headroom_t vect_s32_headroom_strided(
+    const int32_t x[],
+    const unsigned x_stride,
+    const unsigned length);
+
+
+/**
+ * @brief Left-shift the elements of a strided 32-bit vector by a specified number of bits.
+ *
+ * Equivalent to vect_s32_shl() applied to strided vectors. This operation can be performed safely
+ * in-place on `b[]` if `a_stride == b_stride`.
+ *
+ * @param[out]  a         Output vector @vector{a}
+ * @param[in]   a_stride  Stride of @vector{a} (in elements)
+ * @param[in]   b         Input vector @vector{b}
+ * @param[in]   b_stride  Stride of @vector{b} (in elements)
+ * @param[in]   length    Number of elements in @vector{a} and @vector{b}
+ * @param[in]   b_shl     Signed arithmetic left-shift applied to elements of @vector{b}
+ *
+ * @returns Headroom of output vector @vector{a}
+ *
+ * @see vect_s32_shl
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+headroom_t vect_s32_shl_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length,
+    const left_shift_t b_shl);
+
+
+/**
+ * @brief Add together two strided 32-bit vectors.
+ *
+ * Equivalent to vect_s32_add() applied to strided vectors. Use vect_s32_add_prepare() to obtain
+ * `b_shr`, `c_shr` and the output exponent.
+ *
+ * @param[out]  a         Output vector @vector{a}
+ * @param[in]   a_stride  Stride of @vector{a} (in elements)
+ * @param[in]   b         Input vector @vector{b}
+ * @param[in]   b_stride  Stride of @vector{b} (in elements)
+ * @param[in]   c         Input vector @vector{c}
+ * @param[in]   c_stride  Stride of @vector{c} (in elements)
+ * @param[in]   length    Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]   b_shr     Right-shift appled to @vector{b}
+ * @param[in]   c_shr     Right-shift appled to @vector{c}
+ *
+ * @returns Headroom of output vector @vector{a}
+ *
+ * @see vect_s32_add, vect_s32_add_prepare
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+headroom_t vect_s32_add_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const int32_t c[],
+    const unsigned c_stride,
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Multiply one strided 32-bit vector element-wise by another.
+ *
+ * Equivalent to vect_s32_mul() applied to strided vectors. Use vect_s32_mul_prepare() to obtain
+ * `b_shr`, `c_shr` and the output exponent.
+ *
+ * @param[out]  a         Output vector @vector{a}
+ * @param[in]   a_stride  Stride of @vector{a} (in elements)
+ * @param[in]   b         Input vector @vector{b}
+ * @param[in]   b_stride  Stride of @vector{b} (in elements)
+ * @param[in]   c         Input vector @vector{c}
+ * @param[in]   c_stride  Stride of @vector{c} (in elements)
+ * @param[in]   length    Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]   b_shr     Right-shift appled to @vector{b}
+ * @param[in]   c_shr     Right-shift appled to @vector{c}
+ *
+ * @returns Headroom of output vector @vector{a}
+ *
+ * @see vect_s32_mul, vect_s32_mul_prepare
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+headroom_t vect_s32_mul_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const int32_t c[],
+    const unsigned c_stride,
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Multiply a strided 32-bit vector by a scalar.
+ *
+ * Equivalent to vect_s32_scale() applied to strided vectors. Use vect_s32_scale_prepare() to obtain
+ * `b_shr`, `c_shr` and the output exponent.
+ *
+ * @param[out]  a         Output vector @vector{a}
+ * @param[in]   a_stride  Stride of @vector{a} (in elements)
+ * @param[in]   b         Input vector @vector{b}
+ * @param[in]   b_stride  Stride of @vector{b} (in elements)
+ * @param[in]   length    Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   c         Scalar to be multiplied by elements of @vector{b}
+ * @param[in]   b_shr     Right-shift appled to @vector{b}
+ * @param[in]   c_shr     Right-shift applied to @math{c}
+ *
+ * @returns Headroom of output vector @vector{a}
+ *
+ * @see vect_s32_scale, vect_s32_scale_prepare
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+headroom_t vect_s32_scale_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length,
+    const int32_t c,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Multiply one strided 32-bit vector element-wise by another, and add the result to a
+ * strided accumulator vector.
+ *
+ * Equivalent to vect_s32_macc() applied to strided vectors. Use vect_s32_macc_prepare() to obtain
+ * `acc_shr`, `b_shr`, `c_shr` and the output exponent.
+ *
+ * @param[inout]  acc         Input/Output accumulator vector @vector{a}
+ * @param[in]     acc_stride  Stride of @vector{a} (in elements)
+ * @param[in]     b           Input vector @vector{b}
+ * @param[in]     b_stride    Stride of @vector{b} (in elements)
+ * @param[in]     c           Input vector @vector{c}
+ * @param[in]     c_stride    Stride of @vector{c} (in elements)
+ * @param[in]     length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]     acc_shr     Signed arithmetic right-shift applied to accumulator elements
+ * @param[in]     b_shr       Signed arithmetic right-shift applied to elements of @vector{b}
+ * @param[in]     c_shr       Signed arithmetic right-shift applied to elements of @vector{c}
+ *
+ * @returns Headroom of the output accumulator vector @vector{a}
+ *
+ * @see vect_s32_macc, vect_s32_macc_prepare
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+headroom_t vect_s32_macc_strided(
+    int32_t acc[],
+    const unsigned acc_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const int32_t c[],
+    const unsigned c_stride,
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Compute the inner product between two strided 32-bit vectors.
+ *
+ * Equivalent to vect_s32_dot() applied to strided vectors. Use vect_s32_dot_prepare() to obtain
+ * `b_shr`, `c_shr` and the output exponent.
+ *
+ * @param[in] b         Input vector @vector{b}
+ * @param[in] b_stride  Stride of @vector{b} (in elements)
+ * @param[in] c         Input vector @vector{c}
+ * @param[in] c_stride  Stride of @vector{c} (in elements)
+ * @param[in] length    Number of elements in vectors @vector{b} and @vector{c}
+ * @param[in] b_shr     Right-shift appled to @vector{b}
+ * @param[in] c_shr     Right-shift appled to @vector{c}
+ *
+ * @returns The inner product of vectors @vector{b} and @vector{c}, scaled as indicated.
+ *
+ * @see vect_s32_dot, vect_s32_dot_prepare
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+int64_t vect_s32_dot_strided(
+    const int32_t b[],
+    const unsigned b_stride,
+    const int32_t c[],
+    const unsigned c_stride,
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Calculate the energy (sum of squares of elements) of a strided 32-bit vector.
+ *
+ * Equivalent to vect_s32_energy() applied to a strided vector. Use vect_s32_energy_prepare() to
+ * obtain `b_shr` and the output exponent.
+ *
+ * @param[in] b         Input vector @vector{b}
+ * @param[in] b_stride  Stride of @vector{b} (in elements)
+ * @param[in] length    Number of elements in vector @vector{b}
+ * @param[in] b_shr     Right-shift appled to @vector{b}
+ *
+ * @returns 64-bit energy of vector @vector{b}
+ *
+ * @see vect_s32_energy, vect_s32_energy_prepare
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+int64_t vect_s32_energy_strided(
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Sum the elements of a strided 32-bit vector.
+ *
+ * Equivalent to vect_s32_sum() applied to a strided vector.
+ *
+ * @param[in] b         Input vector @vector{b}
+ * @param[in] b_stride  Stride of @vector{b} (in elements)
+ * @param[in] length    Number of elements in vector @vector{b}
+ *
+ * @returns 64-bit sum of elements of @vector{b}
+ *
+ * @see vect_s32_sum
+ *
+ * @ingroup vect_s32_strided_api
+ */
+C_API
+int64_t vect_s32_sum_strided(
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length);
+
+
+#ifdef __XC__
+}   //extern "C"
+#endif
@@ -14,8 +14,11 @@
 #include "xmath/bfp/bfp.h"
 
 #include "xmath/dct.h"
+#include "xmath/dwt.h"
 #include "xmath/fft.h"
 #include "xmath/filter.h"
+#include "xmath/lpc.h"
+#include "xmath/feature.h"
 
 #include "xmath/util.h"
 #include "xmath/q_format.h"
@@ -68,6 +68,47 @@
 #define XMATH_BFP_SQRT_DEPTH_S32 (VECT_SQRT_S32_MAX_DEPTH)
 #endif
 
+#ifndef XMATH_FFT_F32_NATIVE
+/**
+ * @brief Indicates whether fft_f32_forward() and fft_f32_inverse() use floating-point butterflies.
+ * 
+ * Iff true, fft_f32_forward() and fft_f32_inverse() compute the FFT directly on the `float` data
+ * using a radix-4 decimation-in-time FFT. Otherwise the data is converted to a block
+ * floating-point vector, transformed using the VPU-accelerated fixed-point FFT, and converted back.
+ * 
+ * The floating-point path avoids the two conversion passes and retains the precision of the input,
+ * while the fixed-point path makes use of the xcore VPU.
+ * 
+ * Defaults to false (`0`) on xcore targets and true (`1`) otherwise.
+ * 
+ * @see fft_f32_forward, fft_f32_inverse
+ * 
+ * @ingroup config_options
+ */
+#if defined(__XS3A__) || defined(__VX4B__)
+# define XMATH_FFT_F32_NATIVE (0)
+#else
+# define XMATH_FFT_F32_NATIVE (1)
+#endif
+#endif
+
+#ifndef XMATH_AUTOCORR_FFT_MIN_LAGS
+/**
+ * @brief The smallest number of lags for which bfp_s32_autocorr() uses its FFT path.
+ * 
+ * The direct path of bfp_s32_autocorr() costs one inner product per lag, whereas the FFT path
+ * costs a forward and an inverse FFT of (at least) the signal length plus the number of lags,
+ * independent of the number of lags. The FFT path is only taken when a scratch buffer is supplied.
+ * 
+ * Defaults to `32`.
+ * 
+ * @see bfp_s32_autocorr
+ * 
+ * @ingroup config_options
+ */
+#define XMATH_AUTOCORR_FFT_MIN_LAGS (32)
+#endif
+
 #ifdef _WIN32
 #include <stdlib.h> // needed for malloc() and free()
 #endif
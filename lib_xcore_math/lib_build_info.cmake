@@ -16,8 +16,11 @@ file( GLOB_RECURSE SOURCES_C RELATIVE ${CMAKE_CURRENT_LIST_DIR}
                                   "${CMAKE_CURRENT_LIST_DIR}/src/vect/*.c"
                                   "${CMAKE_CURRENT_LIST_DIR}/src/bfp/*.c"
                                   "${CMAKE_CURRENT_LIST_DIR}/src/dct/*.c"
+                                  "${CMAKE_CURRENT_LIST_DIR}/src/dwt/*.c"
                                   "${CMAKE_CURRENT_LIST_DIR}/src/fft/*.c"
+                                  "${CMAKE_CURRENT_LIST_DIR}/src/lpc/*.c"
                                   "${CMAKE_CURRENT_LIST_DIR}/src/filter/*.c"
+                                  "${CMAKE_CURRENT_LIST_DIR}/src/feature/*.c"
                                   "${CMAKE_CURRENT_LIST_DIR}/src/scalar/*.c")
 
 
@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <math.h>
+#include <string.h>
 
 #include "xmath/xmath.h"
 #include "vpu_helper.h"
@@ -24,19 +25,61 @@ float vect_f32_dot(
 }
 
 
+// IEEE754 single-precision fields
+#define F32_EXP_MASK    (0x7F800000)
+#define F32_MANT_MASK   (0x007FFFFF)
+#define F32_HIDDEN_BIT  (0x00800000)
+
+static inline uint32_t f32_bits(
+    const float x)
+{
+  uint32_t res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+
+/*
+ * The exponent and mantissa are taken directly from the bits of each IEEE754 word rather than
+ * through frexpf(), which keeps the loops free of library calls so the compiler can vectorize
+ * them. Results are identical to f32_unpack_s32() followed by vlashr32(). Only zero and subnormal
+ * elements, which have no hidden bit, need special treatment.
+ */
+
 exponent_t vect_f32_max_exponent(
     const float b[],
     const unsigned length)
 {
-  exponent_t res = INT32_MIN;
+  // Max biased exponent field, and whether any element is exactly zero
+  uint32_t max_field = 0;
+  uint32_t any_zero = 0;
+
   for(unsigned k = 0; k < length; k++){
-    int tmp;
-    frexpf(b[k], &tmp);
-    tmp -= 31;
-    res = (tmp > res)? tmp : res;
+    const uint32_t bits = f32_bits(b[k]);
+    const uint32_t field = bits & F32_EXP_MASK;
+    max_field = (field > max_field)? field : max_field;
+    any_zero |= ((bits << 1) == 0);
   }
 
-  return res;
+  // For a normal float frexpf() gives an exponent of (E - 126)
+  exponent_t res = (max_field)? ((exponent_t) (max_field >> 23)) - 126 : INT32_MIN;
+
+  // frexpf() reports an exponent of 0 for zero
+  if(any_zero && res < 0)
+    res = 0;
+
+  // Subnormals can only matter if every element is zero or subnormal
+  if(max_field == 0){
+    for(unsigned k = 0; k < length; k++){
+      const uint32_t mant = f32_bits(b[k]) & F32_MANT_MASK;
+      if(mant){
+        const exponent_t tmp = -117 - (exponent_t) cls((int32_t) mant);
+        res = (tmp > res)? tmp : res;
+      }
+    }
+  }
+
+  return (res == INT32_MIN)? res : res - 31;
 }
 
 
@@ -47,9 +90,24 @@ void vect_f32_to_vect_s32(
     const exponent_t exp)
 {
   for(unsigned k = 0; k < length; k++){
-    const float B = b[k];
-    const float_s32_t C = f32_to_float_s32(B);
-    a[k] = vlashr32(C.mant, exp - C.exp);
+    const uint32_t bits = f32_bits(b[k]);
+    const int32_t field = (bits >> 23) & 0xFF;
+
+    if(field == 0){
+      // Zero or subnormal
+      const float_s32_t C = f32_to_float_s32(b[k]);
+      a[k] = vlashr32(C.mant, exp - C.exp);
+      continue;
+    }
+
+    // f32_unpack_s32() gives a mantissa of (significand << 7) with exponent (E - 157)
+    const int32_t mag = (int32_t) (((bits & F32_MANT_MASK) | F32_HIDDEN_BIT) << 7);
+    const int32_t mant = (bits >> 31)? -mag : mag;
+    const right_shift_t shr = exp - (field - 157);
+
+    if(shr >= 32)       a[k] = (mant >= 0)? 0 : -1;
+    else if(shr >= 0)   a[k] = mant >> shr;
+    else                a[k] = vlashr32(mant, shr);
   }
 }
 
@@ -60,6 +118,16 @@ void vect_s32_to_vect_f32(
     const unsigned length,
     const exponent_t b_exp)
 {
+  // With |b[k]| < 2^31, scaling by a power of 2 in this range can neither overflow nor produce a
+  // subnormal result, so it is exact and matches the ldexp() path bit-for-bit.
+  if(b_exp >= -126 && b_exp <= 96){
+    const float scale = ldexpf(1.0f, b_exp);
+    for(unsigned k = 0; k < length; k++){
+      a[k] = ((float) b[k]) * scale;
+    }
+    return;
+  }
+
   for(unsigned k = 0; k < length; k++){
     a[k] = (float) ldexp(b[k], b_exp);
   }
@@ -42,6 +42,61 @@ void bfp_complex_s32_use_exponent(
 }
 
 
+void bfp_complex_s32_slice(
+    bfp_complex_s32_t* a,
+    const bfp_complex_s32_t* b,
+    const unsigned start,
+    const unsigned length)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(length != 0);
+  assert(start + length <= b->length);
+#endif
+
+  a->data = &b->data[start];
+  a->exp = b->exp;
+  a->hr = b->hr; // not necessarily correct, but safe
+  a->length = length;
+  a->flags = 0;
+}
+
+
+void bfp_complex_s32_merge_slice(
+    bfp_complex_s32_t* a,
+    bfp_complex_s32_t* b)
+{
+  const unsigned start = (unsigned) (b->data - a->data);
+  const unsigned end = start + b->length;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(b->data >= a->data);
+  assert(end <= a->length);
+  assert(b->length != 0);
+#endif
+
+  if(b->exp > a->exp){
+    // The slice's exponent grew, so shift the rest of the parent to match it.
+    const right_shift_t shr = b->exp - a->exp;
+    headroom_t hr = b->hr;
+    if(start){
+      const headroom_t lo_hr = vect_complex_s32_shr(&a->data[0], &a->data[0], start, shr);
+      hr = MIN(hr, lo_hr);
+    }
+    if(end < a->length){
+      const headroom_t hi_hr = vect_complex_s32_shr(&a->data[end], &a->data[end], a->length - end, shr);
+      hr = MIN(hr, hi_hr);
+    }
+    a->exp = b->exp;
+    a->hr = hr;
+  } else {
+    if(b->exp < a->exp)
+      b->hr = vect_complex_s32_shr(b->data, b->data, b->length, a->exp - b->exp);
+    b->exp = a->exp;
+    a->hr = MIN(a->hr, b->hr);
+  }
+}
+
+
 void bfp_complex_s32_shl(
     bfp_complex_s32_t* a,
     const bfp_complex_s32_t* b,
@@ -259,6 +314,49 @@ void bfp_complex_s32_mag(
 }
 
 
+void bfp_complex_s32_to_polar(
+    bfp_s32_t* a_mag,
+    bfp_s32_t* a_angle,
+    const bfp_complex_s32_t* b)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+    assert(b->length == a_mag->length);
+    assert(b->length == a_angle->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr;
+
+    vect_complex_s32_mag_prepare(&a_mag->exp, &b_shr, b->exp, b->hr);
+
+    a_mag->hr = vect_complex_s32_to_polar(a_mag->data, a_angle->data, b->data, b->length, b_shr,
+                                          (complex_s32_t*) rot_table32, rot_table32_rows);
+
+    a_angle->exp = -24;
+    a_angle->hr = vect_s32_headroom(a_angle->data, a_angle->length);
+}
+
+
+void bfp_polar_to_complex_s32(
+    bfp_complex_s32_t* a,
+    const bfp_s32_t* b_mag,
+    const bfp_s32_t* b_angle)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+    assert(b_mag->length == a->length);
+    assert(b_angle->length == a->length);
+    assert(b_angle->exp == -24);
+    assert(b_mag->length != 0);
+#endif
+
+    // The magnitude of each output element cannot exceed that of its input.
+    const right_shift_t b_shr = -((right_shift_t) b_mag->hr);
+
+    a->exp = b_mag->exp + b_shr;
+    a->hr = vect_polar_to_complex_s32(a->data, b_mag->data, b_angle->data, a->length, b_shr);
+}
+
+
 float_complex_s64_t bfp_complex_s32_sum(
     const bfp_complex_s32_t* b)
 {
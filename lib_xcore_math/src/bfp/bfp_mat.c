@@ -0,0 +1,668 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <assert.h>
+#include <stdio.h>
+
+#include "xmath/xmath.h"
+
+
+/*
+ * The matrix products are built on vect_s32_dot(). Output rows are computed BFP_MAT_ROW_BLOCK at a
+ * time with one 64-bit accumulator per row, so that each COL_BLOCK-element block of the right-hand
+ * operand is gathered (or, for complex matrices, packed) once and then reused for every row in the
+ * group.
+ */
+
+#define ROW_BLOCK   BFP_MAT_ROW_BLOCK
+#define COL_BLOCK   VECT_S32_STRIDED_BLOCK
+#define TILE        (8)
+
+
+/*
+ * Chooses the shifts for vect_s32_dot() and the shift used to reduce the 64-bit sums to 32 bits.
+ *
+ * After the shifts chosen by vect_s32_dot_prepare() each product contributes at most
+ * 2^(32 - (b_hr+b_shr) - (c_hr+c_shr)), so a sum of `length` products is bounded by 2^bits, with
+ * bits as below. Reducing by (bits - 30) guarantees the 32-bit output cannot saturate.
+ */
+static void mat_s32_prepare(
+    exponent_t* a_exp,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    right_shift_t* acc_shr,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t b_hr,
+    const headroom_t c_hr,
+    const unsigned length)
+{
+  exponent_t dot_exp;
+  vect_s32_dot_prepare(&dot_exp, b_shr, c_shr, b_exp, c_exp, b_hr, c_hr, length);
+
+  const int bits = (int) u32_ceil_log2(length) + 32
+                 - ((int) b_hr + *b_shr) - ((int) c_hr + *c_shr);
+
+  *acc_shr = bits - 30;
+  *a_exp = dot_exp + *acc_shr;
+}
+
+
+static inline int32_t acc_to_s32(
+    const int64_t acc,
+    const right_shift_t shr)
+{
+  if(shr <= 0)
+    return (int32_t) s64_ashr(acc, shr);
+  return (int32_t) ((acc + (((int64_t)1) << (shr-1))) >> shr);
+}
+
+
+/*
+ * acc[r] = sum_k b[r*b_cols + k] * c[k*c_stride]   for r in [0, rows)
+ */
+static void mat_s32_block_dot(
+    int64_t acc[],
+    const int32_t b[],
+    const unsigned rows,
+    const unsigned b_cols,
+    const int32_t c[],
+    const unsigned c_stride,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+  int32_t DWORD_ALIGNED buff_c[COL_BLOCK];
+
+  for(unsigned r = 0; r < rows; r++)
+    acc[r] = 0;
+
+  for(unsigned k = 0; k < b_cols; k += COL_BLOCK){
+    const unsigned count = MIN(COL_BLOCK, b_cols - k);
+    const int32_t* c_blk = &c[k * c_stride];
+
+    if(c_stride != 1){
+      for(unsigned n = 0; n < count; n++)
+        buff_c[n] = c_blk[n * c_stride];
+      c_blk = buff_c;
+    }
+
+    for(unsigned r = 0; r < rows; r++)
+      acc[r] += vect_s32_dot(&b[r * b_cols + k], c_blk, count, b_shr, c_shr);
+  }
+}
+
+
+/*
+ * acc[r] = sum_k b[r*b_cols + k] * c[k*c_stride]   for r in [0, rows)   (complex)
+ *
+ * Each COL_BLOCK-element block of c is packed as (re, -im) pairs and as (im, re) pairs. The real
+ * and imaginary parts of each output are then real dot products of those with the rows of b,
+ * which are used as they are (interleaved).
+ */
+static void mat_complex_s32_block_dot(
+    complex_s64_t acc[],
+    const complex_s32_t b[],
+    const unsigned rows,
+    const unsigned b_cols,
+    const complex_s32_t c[],
+    const unsigned c_stride,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+  int32_t DWORD_ALIGNED c_conj[2 * COL_BLOCK];
+  int32_t DWORD_ALIGNED c_swap[2 * COL_BLOCK];
+
+  for(unsigned r = 0; r < rows; r++){
+    acc[r].re = 0;
+    acc[r].im = 0;
+  }
+
+  for(unsigned k = 0; k < b_cols; k += COL_BLOCK){
+    const unsigned count = MIN(COL_BLOCK, b_cols - k);
+
+    for(unsigned n = 0; n < count; n++){
+      const complex_s32_t v = c[(k + n) * c_stride];
+      c_conj[2*n] = v.re;
+      c_conj[2*n + 1] = (v.im == INT32_MIN)? INT32_MAX : -v.im;
+      c_swap[2*n] = v.im;
+      c_swap[2*n + 1] = v.re;
+    }
+
+    for(unsigned r = 0; r < rows; r++){
+      const int32_t* b_row = (const int32_t*) &b[r * b_cols + k];
+      acc[r].re += vect_s32_dot(b_row, c_conj, 2 * count, b_shr, c_shr);
+      acc[r].im += vect_s32_dot(b_row, c_swap, 2 * count, b_shr, c_shr);
+    }
+  }
+}
+
+
+void bfp_mat_s32_init(
+    bfp_mat_s32_t* a,
+    int32_t* data,
+    const exponent_t exp,
+    const unsigned rows,
+    const unsigned cols,
+    const unsigned calc_hr)
+{
+  a->data = data;
+  a->rows = rows;
+  a->cols = cols;
+  a->exp = exp;
+  a->flags = 0;
+
+  if(calc_hr) bfp_mat_s32_headroom(a);
+  else        a->hr = 0;
+}
+
+
+void bfp_mat_complex_s32_init(
+    bfp_mat_complex_s32_t* a,
+    complex_s32_t* data,
+    const exponent_t exp,
+    const unsigned rows,
+    const unsigned cols,
+    const unsigned calc_hr)
+{
+  a->data = data;
+  a->rows = rows;
+  a->cols = cols;
+  a->exp = exp;
+  a->flags = 0;
+
+  if(calc_hr) bfp_mat_complex_s32_headroom(a);
+  else        a->hr = 0;
+}
+
+
+headroom_t bfp_mat_s32_headroom(
+    bfp_mat_s32_t* a)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(a->rows != 0);
+  assert(a->cols != 0);
+#endif
+
+  a->hr = vect_s32_headroom(a->data, a->rows * a->cols);
+  return a->hr;
+}
+
+
+headroom_t bfp_mat_complex_s32_headroom(
+    bfp_mat_complex_s32_t* a)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(a->rows != 0);
+  assert(a->cols != 0);
+#endif
+
+  a->hr = vect_complex_s32_headroom(a->data, a->rows * a->cols);
+  return a->hr;
+}
+
+
+void bfp_mat_s32_transpose(
+    bfp_mat_s32_t* a,
+    const bfp_mat_s32_t* b)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(a->rows == b->cols);
+  assert(a->cols == b->rows);
+  assert(a->data != b->data);
+#endif
+
+  const unsigned M = b->rows;
+  const unsigned N = b->cols;
+
+  for(unsigned i0 = 0; i0 < M; i0 += TILE){
+    const unsigned i1 = MIN(M, i0 + TILE);
+    for(unsigned j0 = 0; j0 < N; j0 += TILE){
+      const unsigned j1 = MIN(N, j0 + TILE);
+      for(unsigned i = i0; i < i1; i++)
+        for(unsigned j = j0; j < j1; j++)
+          a->data[j * M + i] = b->data[i * N + j];
+    }
+  }
+
+  a->exp = b->exp;
+  a->hr = b->hr;
+}
+
+
+void bfp_mat_complex_s32_transpose(
+    bfp_mat_complex_s32_t* a,
+    const bfp_mat_complex_s32_t* b)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(a->rows == b->cols);
+  assert(a->cols == b->rows);
+  assert(a->data != b->data);
+#endif
+
+  const unsigned M = b->rows;
+  const unsigned N = b->cols;
+
+  for(unsigned i0 = 0; i0 < M; i0 += TILE){
+    const unsigned i1 = MIN(M, i0 + TILE);
+    for(unsigned j0 = 0; j0 < N; j0 += TILE){
+      const unsigned j1 = MIN(N, j0 + TILE);
+      for(unsigned i = i0; i < i1; i++)
+        for(unsigned j = j0; j < j1; j++)
+          a->data[j * M + i] = b->data[i * N + j];
+    }
+  }
+
+  a->exp = b->exp;
+  a->hr = b->hr;
+}
+
+
+void bfp_mat_complex_s32_hermitian(
+    bfp_mat_complex_s32_t* a,
+    const bfp_mat_complex_s32_t* b)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(a->rows == b->cols);
+  assert(a->cols == b->rows);
+  assert(a->data != b->data);
+#endif
+
+  const unsigned M = b->rows;
+  const unsigned N = b->cols;
+
+  for(unsigned i0 = 0; i0 < M; i0 += TILE){
+    const unsigned i1 = MIN(M, i0 + TILE);
+    for(unsigned j0 = 0; j0 < N; j0 += TILE){
+      const unsigned j1 = MIN(N, j0 + TILE);
+      for(unsigned i = i0; i < i1; i++){
+        for(unsigned j = j0; j < j1; j++){
+          const complex_s32_t v = b->data[i * N + j];
+          a->data[j * M + i].re = v.re;
+          a->data[j * M + i].im = (v.im == INT32_MIN)? INT32_MAX : -v.im;
+        }
+      }
+    }
+  }
+
+  a->exp = b->exp;
+  // Negation can remove a bit of headroom from an element (-2^k -> 2^k)
+  bfp_mat_complex_s32_headroom(a);
+}
+
+
+void bfp_mat_s32_mul_vect(
+    bfp_s32_t* a,
+    const bfp_mat_s32_t* b,
+    const bfp_s32_t* c)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(b->cols == c->length);
+  assert(b->rows == a->length);
+  assert(c->length != 0);
+  assert(a->data != c->data);
+#endif
+
+  right_shift_t b_shr, c_shr, acc_shr;
+  mat_s32_prepare(&a->exp, &b_shr, &c_shr, &acc_shr, b->exp, c->exp, b->hr, c->hr, b->cols);
+
+  int64_t acc[ROW_BLOCK];
+
+  for(unsigned i = 0; i < b->rows; i += ROW_BLOCK){
+    const unsigned rows = MIN(ROW_BLOCK, b->rows - i);
+
+    mat_s32_block_dot(acc, &b->data[i * b->cols], rows, b->cols, c->data, 1, b_shr, c_shr);
+
+    for(unsigned r = 0; r < rows; r++)
+      a->data[i + r] = acc_to_s32(acc[r], acc_shr);
+  }
+
+  a->hr = vect_s32_headroom(a->data, a->length);
+}
+
+
+void bfp_mat_complex_s32_mul_vect(
+    bfp_complex_s32_t* a,
+    const bfp_mat_complex_s32_t* b,
+    const bfp_complex_s32_t* c)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(b->cols == c->length);
+  assert(b->rows == a->length);
+  assert(c->length != 0);
+  assert(a->data != c->data);
+#endif
+
+  // Each part of the output is a sum of 2*N real products.
+  right_shift_t b_shr, c_shr, acc_shr;
+  mat_s32_prepare(&a->exp, &b_shr, &c_shr, &acc_shr, b->exp, c->exp, b->hr, c->hr, 2 * b->cols);
+
+  complex_s64_t acc[ROW_BLOCK];
+
+  for(unsigned i = 0; i < b->rows; i += ROW_BLOCK){
+    const unsigned rows = MIN(ROW_BLOCK, b->rows - i);
+
+    mat_complex_s32_block_dot(acc, &b->data[i * b->cols], rows, b->cols, c->data, 1,
+                              b_shr, c_shr);
+
+    for(unsigned r = 0; r < rows; r++){
+      a->data[i + r].re = acc_to_s32(acc[r].re, acc_shr);
+      a->data[i + r].im = acc_to_s32(acc[r].im, acc_shr);
+    }
+  }
+
+  a->hr = vect_complex_s32_headroom(a->data, a->length);
+}
+
+
+void bfp_mat_s32_mul(
+    bfp_mat_s32_t* a,
+    const bfp_mat_s32_t* b,
+    const bfp_mat_s32_t* c)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(b->cols == c->rows);
+  assert(a->rows == b->rows);
+  assert(a->cols == c->cols);
+  assert(b->cols != 0);
+  assert(a->data != b->data);
+  assert(a->data != c->data);
+#endif
+
+  right_shift_t b_shr, c_shr, acc_shr;
+  mat_s32_prepare(&a->exp, &b_shr, &c_shr, &acc_shr, b->exp, c->exp, b->hr, c->hr, b->cols);
+
+  const unsigned N = c->cols;
+  int64_t acc[ROW_BLOCK];
+
+  for(unsigned i = 0; i < b->rows; i += ROW_BLOCK){
+    const unsigned rows = MIN(ROW_BLOCK, b->rows - i);
+
+    for(unsigned j = 0; j < N; j++){
+      mat_s32_block_dot(acc, &b->data[i * b->cols], rows, b->cols, &c->data[j], N, b_shr, c_shr);
+
+      for(unsigned r = 0; r < rows; r++)
+        a->data[(i + r) * N + j] = acc_to_s32(acc[r], acc_shr);
+    }
+  }
+
+  bfp_mat_s32_headroom(a);
+}
+
+
+void bfp_mat_complex_s32_mul(
+    bfp_mat_complex_s32_t* a,
+    const bfp_mat_complex_s32_t* b,
+    const bfp_mat_complex_s32_t* c)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(b->cols == c->rows);
+  assert(a->rows == b->rows);
+  assert(a->cols == c->cols);
+  assert(b->cols != 0);
+  assert(a->data != b->data);
+  assert(a->data != c->data);
+#endif
+
+  // Each part of the output is a sum of 2*K real products.
+  right_shift_t b_shr, c_shr, acc_shr;
+  mat_s32_prepare(&a->exp, &b_shr, &c_shr, &acc_shr, b->exp, c->exp, b->hr, c->hr, 2 * b->cols);
+
+  const unsigned N = c->cols;
+  complex_s64_t acc[ROW_BLOCK];
+
+  for(unsigned i = 0; i < b->rows; i += ROW_BLOCK){
+    const unsigned rows = MIN(ROW_BLOCK, b->rows - i);
+
+    for(unsigned j = 0; j < N; j++){
+      mat_complex_s32_block_dot(acc, &b->data[i * b->cols], rows, b->cols, &c->data[j], N,
+                                b_shr, c_shr);
+
+      for(unsigned r = 0; r < rows; r++){
+        a->data[(i + r) * N + j].re = acc_to_s32(acc[r].re, acc_shr);
+        a->data[(i + r) * N + j].im = acc_to_s32(acc[r].im, acc_shr);
+      }
+    }
+  }
+
+  bfp_mat_complex_s32_headroom(a);
+}
+
+
+void bfp_mat_complex_s32_batch_init(
+    bfp_mat_complex_s32_batch_t* a,
+    complex_s32_t* data,
+    exponent_t* exp,
+    const unsigned rows,
+    const unsigned cols,
+    const unsigned count)
+{
+  a->data = data;
+  a->exp = exp;
+  a->rows = rows;
+  a->cols = cols;
+  a->count = count;
+}
+
+
+/*
+ * The Cholesky factorization works on each matrix as a Q2.30 fraction whose largest diagonal
+ * element lies in [0.125, 0.5]. With that normalization |L_ij| <= sqrt(R_ii) <= 0.71, and by
+ * Cauchy-Schwarz every partial inner product stays within (-1, 1), so the same shifts (all zero)
+ * are valid for every matrix in the batch and the updates can be done with the vector kernels.
+ */
+
+// Input normalization leaves the largest diagonal element below 2^29 (0.5 in Q2.30)
+#define CHOL_DIAG_HR    (2)
+
+
+static inline int32_t s64_round_shr_sat32(
+    const int64_t x,
+    const right_shift_t shr)
+{
+  int64_t y = (shr > 0)? ((x + (((int64_t)1) << (shr-1))) >> shr) : s64_ashr(x, shr);
+  if(y > INT32_MAX) return INT32_MAX;
+  if(y < INT32_MIN) return INT32_MIN;
+  return (int32_t) y;
+}
+
+
+static void batch_vect_shr(
+    complex_s32_t x[],
+    const unsigned rows,
+    const unsigned count,
+    const unsigned b,
+    const right_shift_t shr)
+{
+  for(unsigned i = 0; i < rows; i++){
+    x[i * count + b].re = s32_ashr(x[i * count + b].re, shr);
+    x[i * count + b].im = s32_ashr(x[i * count + b].im, shr);
+  }
+}
+
+
+void bfp_mat_complex_s32_cholesky_batch(
+    bfp_mat_complex_s32_batch_t* l,
+    const bfp_mat_complex_s32_batch_t* r)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(r->rows == r->cols);
+  assert(l->rows == r->rows);
+  assert(l->cols == r->cols);
+  assert(l->count == r->count);
+  assert(r->count != 0);
+#endif
+
+  const unsigned N = r->rows;
+  const unsigned count = r->count;
+
+#define ELM(M, I, J)   (&(M)->data[((I) * N + (J)) * count])
+
+  // Normalize each matrix so that its largest diagonal element is in [2^27, 2^29] and its exponent
+  // is even, which makes the exponent of its square root exact.
+  for(unsigned b = 0; b < count; b++){
+    int32_t diag_max = 0;
+    for(unsigned i = 0; i < N; i++)
+      diag_max = MAX(diag_max, ELM(r, i, i)[b].re);
+
+    left_shift_t shl = (int) HR_S32(diag_max) - CHOL_DIAG_HR;
+    exponent_t exp = r->exp[b] - shl;
+    if(exp & 1){
+      shl -= 1;
+      exp += 1;
+    }
+
+    for(unsigned i = 0; i < N; i++){
+      for(unsigned j = 0; j <= i; j++){
+        ELM(l, i, j)[b].re = s32_ashr(ELM(r, i, j)[b].re, -shl);
+        ELM(l, i, j)[b].im = s32_ashr(ELM(r, i, j)[b].im, -shl);
+      }
+    }
+
+    // sqrt( R * 2^exp ) = sqrt( (R * 2^-30) * 2^(exp+30) ) = (L * 2^-30) * 2^((exp+30)/2)
+    l->exp[b] = (exp / 2) - 15;
+  }
+
+  for(unsigned i = 0; i < N; i++)
+    for(unsigned j = i + 1; j < N; j++)
+      vect_complex_s32_set(ELM(l, i, j), 0, 0, count);
+
+  for(unsigned j = 0; j < N; j++){
+    complex_s32_t* l_jj = ELM(l, j, j);
+
+    // R_ij - sum_{k<j} L_ik * conj(L_jk),  for i >= j
+    for(unsigned i = j; i < N; i++)
+      for(unsigned k = 0; k < j; k++)
+        vect_complex_s32_conj_nmacc(ELM(l, i, j), ELM(l, i, k), ELM(l, j, k), count, 0, 0, 0);
+
+    for(unsigned b = 0; b < count; b++){
+      const int32_t pivot = MAX(1, l_jj[b].re);
+
+      exponent_t sqrt_exp;
+      int32_t diag = s32_sqrt(&sqrt_exp, pivot, -30, XMATH_BFP_SQRT_DEPTH_S32);
+      diag = MAX(1, s32_ashr(diag, -(sqrt_exp + 30)));
+
+      l_jj[b].re = diag;
+      l_jj[b].im = 0;
+
+      // 1/(diag * 2^-30) = inv * 2^(inv_exp + 30)
+      exponent_t inv_exp;
+      const int32_t inv = s32_inverse(&inv_exp, diag);
+      const right_shift_t inv_shr = -(inv_exp + 30);
+
+      for(unsigned i = j + 1; i < N; i++){
+        complex_s32_t* l_ij = &ELM(l, i, j)[b];
+        l_ij->re = s64_round_shr_sat32(((int64_t) l_ij->re) * inv, inv_shr);
+        l_ij->im = s64_round_shr_sat32(((int64_t) l_ij->im) * inv, inv_shr);
+      }
+    }
+  }
+
+#undef ELM
+}
+
+
+/*
+ * Divides element `i` of vector `b` in the batch by the (real, Q2.30) diagonal element `diag`,
+ * shifting the whole vector down when the quotient would exceed the headroom reserved for the
+ * substitution updates.
+ */
+static void batch_solve_divide(
+    bfp_mat_complex_s32_batch_t* x,
+    const unsigned i,
+    const unsigned b,
+    const int32_t diag,
+    const headroom_t guard_hr)
+{
+  const unsigned N = x->rows;
+  const unsigned count = x->count;
+  complex_s32_t* x_ib = &x->data[i * count + b];
+
+  exponent_t inv_exp;
+  const int32_t inv = s32_inverse(&inv_exp, diag);
+  const right_shift_t inv_shr = -(inv_exp + 30);
+
+  int64_t q_re = ((int64_t) x_ib->re) * inv;
+  int64_t q_im = ((int64_t) x_ib->im) * inv;
+  q_re = (inv_shr > 0)? ((q_re + (((int64_t)1) << (inv_shr-1))) >> inv_shr) : s64_ashr(q_re, inv_shr);
+  q_im = (inv_shr > 0)? ((q_im + (((int64_t)1) << (inv_shr-1))) >> inv_shr) : s64_ashr(q_im, inv_shr);
+
+  // Significant bits needed by the quotient vs. the bits available with `guard_hr` headroom
+  const headroom_t q_hr = MIN(HR_S64(q_re), HR_S64(q_im));
+  const right_shift_t shr = MAX(0, (int)(64 - q_hr) - (int)(32 - guard_hr));
+
+  if(shr){
+    batch_vect_shr(x->data, N, count, b, shr);
+    x->exp[b] += shr;
+  }
+
+  x_ib->re = s64_round_shr_sat32(q_re, shr);
+  x_ib->im = s64_round_shr_sat32(q_im, shr);
+}
+
+
+void bfp_mat_complex_s32_cholesky_solve_batch(
+    bfp_mat_complex_s32_batch_t* x,
+    const bfp_mat_complex_s32_batch_t* l,
+    const bfp_mat_complex_s32_batch_t* y)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(l->rows == l->cols);
+  assert(y->rows == l->rows);
+  assert(x->rows == l->rows);
+  assert(y->cols == 1);
+  assert(x->cols == 1);
+  assert(y->count == l->count);
+  assert(x->count == l->count);
+  assert(l->count != 0);
+#endif
+
+  const unsigned N = l->rows;
+  const unsigned count = l->count;
+
+  // Each update subtracts at most N-1 terms of magnitude below 0.71 * max|x|, so keeping
+  // ceil(log2(N))+1 bits of headroom in every vector prevents the updates from saturating.
+  const headroom_t guard_hr = u32_ceil_log2(N) + 1;
+
+#define ELM(M, I, J)   (&(M)->data[((I) * N + (J)) * count])
+#define VEC(V, I)      (&(V)->data[(I) * count])
+
+  if(x->data != y->data)
+    vect_s32_copy((int32_t*) x->data, (int32_t*) y->data, 2 * N * count);
+
+  for(unsigned b = 0; b < count; b++){
+    headroom_t hr = 32;
+    for(unsigned i = 0; i < N; i++){
+      const headroom_t elm_hr = HR_C32(x->data[i * count + b]);
+      hr = MIN(hr, elm_hr);
+    }
+    const left_shift_t shl = (int) hr - (int) guard_hr;
+    batch_vect_shr(x->data, N, count, b, -shl);
+    x->exp[b] = y->exp[b] - shl;
+  }
+
+  // Forward substitution:  L * z = y
+  for(unsigned i = 0; i < N; i++){
+    for(unsigned k = 0; k < i; k++)
+      vect_complex_s32_nmacc(VEC(x, i), ELM(l, i, k), VEC(x, k), count, 0, 0, 0);
+
+    for(unsigned b = 0; b < count; b++)
+      batch_solve_divide(x, i, b, ELM(l, i, i)[b].re, guard_hr);
+  }
+
+  // Back substitution:  L^H * x = z
+  for(int i = N - 1; i >= 0; i--){
+    for(unsigned k = i + 1; k < N; k++)
+      vect_complex_s32_conj_nmacc(VEC(x, i), VEC(x, k), ELM(l, k, i), count, 0, 0, 0);
+
+    for(unsigned b = 0; b < count; b++)
+      batch_solve_divide(x, i, b, ELM(l, i, i)[b].re, guard_hr);
+  }
+
+  // The substitutions used L * 2^-30, so scale back by the factor's exponent twice.
+  for(unsigned b = 0; b < count; b++)
+    x->exp[b] -= 2 * (l->exp[b] + 30);
+
+#undef ELM
+#undef VEC
+}
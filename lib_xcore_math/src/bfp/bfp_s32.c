@@ -37,6 +37,61 @@ void bfp_s32_use_exponent(
 }
 
 
+void bfp_s32_slice(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const unsigned start,
+    const unsigned length)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(length != 0);
+  assert(start + length <= b->length);
+#endif
+
+  a->data = &b->data[start];
+  a->exp = b->exp;
+  a->hr = b->hr; // not necessarily correct, but safe
+  a->length = length;
+  a->flags = 0;
+}
+
+
+void bfp_s32_merge_slice(
+    bfp_s32_t* a,
+    bfp_s32_t* b)
+{
+  const unsigned start = (unsigned) (b->data - a->data);
+  const unsigned end = start + b->length;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(b->data >= a->data);
+  assert(end <= a->length);
+  assert(b->length != 0);
+#endif
+
+  if(b->exp > a->exp){
+    // The slice's exponent grew, so shift the rest of the parent to match it.
+    const right_shift_t shr = b->exp - a->exp;
+    headroom_t hr = b->hr;
+    if(start){
+      const headroom_t lo_hr = vect_s32_shr(&a->data[0], &a->data[0], start, shr);
+      hr = MIN(hr, lo_hr);
+    }
+    if(end < a->length){
+      const headroom_t hi_hr = vect_s32_shr(&a->data[end], &a->data[end], a->length - end, shr);
+      hr = MIN(hr, hi_hr);
+    }
+    a->exp = b->exp;
+    a->hr = hr;
+  } else {
+    if(b->exp < a->exp)
+      b->hr = vect_s32_shr(b->data, b->data, b->length, a->exp - b->exp);
+    b->exp = a->exp;
+    a->hr = MIN(a->hr, b->hr);
+  }
+}
+
+
 void bfp_s32_shl(
     bfp_s32_t* a,
     const bfp_s32_t* b,
@@ -289,6 +344,57 @@ void bfp_s32_inverse(
 }
 
 
+void bfp_s32_divide(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+    assert(b->length == a->length);
+    assert(c->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    left_shift_t scale;
+
+    vect_s32_divide_prepare(&a->exp, &scale, b->exp, b->hr, c->data, c->exp, b->length);
+
+    a->hr = vect_s32_divide(a->data, b->data, c->data, b->length, scale);
+}
+
+
+void bfp_s32_softmax(
+    bfp_s32_t* a,
+    const bfp_s32_t* b)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    // Subtract the maximum so that every exponent is at most 1. (Halving the maximum's mantissa
+    // keeps its negation representable.)
+    float_s32_t b_max = bfp_s32_max(b);
+    b_max.mant = -(b_max.mant >> 1);
+    b_max.exp += 1;
+    bfp_s32_add_scalar(a, b, b_max);
+
+    exponent_t exp_exp;
+    a->hr = vect_s32_exp(a->data, &exp_exp, a->data, a->exp, a->length);
+
+    // The common exponent cancels in the normalization.
+    const float_s64_t sum = { vect_s32_sum(a->data, b->length), 0 };
+    const float_s32_t total = float_s64_to_float_s32(sum);
+
+    float_s32_t scale;
+    scale.mant = s32_inverse(&scale.exp, total.mant);
+    scale.exp -= total.exp;
+
+    a->exp = 0;
+    bfp_s32_scale(a, a, scale);
+}
+
+
 float_s64_t bfp_s32_abs_sum(
     const bfp_s32_t* b)
 {
@@ -0,0 +1,401 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+#include "xmath_fft_lut.h"
+#include "xmath_internal.h"
+
+
+static inline unsigned dct_is_pow2(
+    const unsigned N)
+{
+  return (N & (N-1)) == 0;
+}
+
+
+// Whether the N-point DCT can use the radix-2 FFT with the look-up table twiddles directly
+static inline unsigned dct_is_radix2(
+    const unsigned N)
+{
+  return dct_is_pow2(N) && (N >= 16) && (4*N <= (1 << MAX_DIT_FFT_LOG2));
+}
+
+
+// exp(-j*2*pi*t/T) for 0 <= t < T, as a Q2.30
+static complex_s32_t dct_rotation(
+    const unsigned t,
+    const unsigned T)
+{
+  return xmath_turn_phasor((uint32_t) (((((uint64_t) t) << 32) + T/2) / T));
+}
+
+
+// W_{4N}^k. For the radix-2 lengths this is taken from the final pass of the (Q2.30) DIT look-up
+// table, which holds W_{2^MAX_DIT_FFT_LOG2}^q for 0 <= q < 2^(MAX_DIT_FFT_LOG2-1) in blocks of 4
+// stored in descending order.
+static inline complex_s32_t dct_twiddle(
+    const unsigned k,
+    const unsigned N)
+{
+  if(!dct_is_radix2(N))
+    return dct_rotation(k, 4*N);
+
+  const unsigned q = k * ((1 << MAX_DIT_FFT_LOG2) / (4*N));
+  return xmath_dit_fft_lut[(1 << MAX_DIT_FFT_LOG2) - 8 - (q & ~3u) + (q & 3u)];
+}
+
+
+static inline int32_t dct_q30_mul(
+    const int32_t b,
+    const int32_t c)
+{
+  return (int32_t) ((((int64_t) b) * c + (1 << 29)) >> 30);
+}
+
+
+// Whether the length is handled by one of the fixed-size implementations.
+static unsigned dct_is_fixed_length(
+    const unsigned N)
+{
+  switch(N){
+    case 6: case 8: case 12: case 16: case 24: case 32: case 48: case 64:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS)
+static void dct_check_length(
+    const unsigned N)
+{
+  if(dct_is_fixed_length(N))
+    return;
+  // Otherwise, must be even, with the power of 2 part of N/2 no longer than the largest FFT
+  assert(N >= 2);
+  assert((N & 1) == 0);
+  assert((((N >> 1) & -(N >> 1))) <= (1 << MAX_DIT_FFT_LOG2));
+}
+#endif
+
+
+/*
+ * M-point DFT (or, if inverse, IDFT including the factor of 1/M) of X[], in-place, for any M.
+ * 
+ * Writing M = P*m with P the largest power of 2 factor of M (or 1 if that is less than 4), and
+ * taking n = p + P*r and k = s + m*q (with p,q < P and r,s < m), the DFT is
+ * 
+ *   X[s + m*q] = sum_p W_P^{pq} Y_s[p],    where   Y_s[p] = sum_r W_M^{s(p + P*r)} x[p + P*r]
+ * 
+ * The m-point sums Y_s[] are computed directly into work[], and then each is transformed with the
+ * P-point radix-2 FFT. The cost is O(M*(m + log2(P))). work[] must have space for M elements.
+ * 
+ * X[] may have any headroom, and the result has the headroom written to *hr.
+ */
+static void dct_dft(
+    complex_s32_t X[],
+    complex_s32_t work[],
+    const unsigned M,
+    const unsigned inverse,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+  unsigned P = M & -M;
+  if(P < 4)
+    P = 1;
+  const unsigned m = M / P;
+
+  // Each sum grows by less than a factor of m, i.e. 2^c, and a factor of sqrt(2) from the rotation
+  unsigned c = 0;
+  while((1u << c) < m)
+    c++;
+
+  // For the inverse, the factor of 1/m is applied as a multiplication by 2^c/m (a Q2.30 in the
+  // interval [1,2)) and a shift of c bits.
+  const int64_t recip = ((((int64_t) 1) << (30 + c)) + m/2) / m;
+
+  for(unsigned s = 0; s < m; s++){
+    for(unsigned p = 0; p < P; p++){
+      int64_t acc_re = 0;
+      int64_t acc_im = 0;
+      for(unsigned r = 0; r < m; r++){
+        const unsigned n = p + P*r;
+        complex_s32_t W = dct_rotation((unsigned) ((((uint64_t) s) * n) % M), M);
+        if(inverse)
+          W.im = -W.im;
+        acc_re += (((int64_t) X[n].re) * W.re - ((int64_t) X[n].im) * W.im + (1 << 29)) >> 30;
+        acc_im += (((int64_t) X[n].re) * W.im + ((int64_t) X[n].im) * W.re + (1 << 29)) >> 30;
+      }
+      acc_re = (acc_re + (((int64_t) 1) << c)) >> (c + 1);
+      acc_im = (acc_im + (((int64_t) 1) << c)) >> (c + 1);
+      if(inverse){
+        acc_re = (acc_re * recip + (1 << 29)) >> 30;
+        acc_im = (acc_im * recip + (1 << 29)) >> 30;
+      }
+      work[s*P + p].re = (int32_t) acc_re;
+      work[s*P + p].im = (int32_t) acc_im;
+    }
+  }
+  *exp += inverse? 1 : (c + 1);
+
+  if(P == 1){
+    memcpy(X, work, M * sizeof(complex_s32_t));
+    *hr = vect_complex_s32_headroom(X, M);
+    return;
+  }
+
+  // fft_dit_forward() and fft_dit_inverse() require 2 bits of headroom
+  const left_shift_t work_shl = vect_complex_s32_headroom(work, M) - 2;
+  vect_s32_shl((int32_t*) work, (int32_t*) work, 2*M, work_shl);
+  *exp -= work_shl;
+
+  // The P-point FFTs may each end up with a different exponent. X[] is free at this point, so
+  // it holds those exponents until the blocks have been aligned.
+  exponent_t* block_exp = (exponent_t*) X;
+  exponent_t max_exp = INT32_MIN;
+  for(unsigned s = 0; s < m; s++){
+    headroom_t block_hr = 2;
+    block_exp[s] = *exp;
+    fft_index_bit_reversal(&work[s*P], P);
+    if(inverse)
+      fft_dit_inverse(&work[s*P], P, &block_hr, &block_exp[s]);
+    else
+      fft_dit_forward(&work[s*P], P, &block_hr, &block_exp[s]);
+    max_exp = MAX(max_exp, block_exp[s]);
+  }
+
+  for(unsigned s = 0; s < m; s++)
+    vect_s32_shr((int32_t*) &work[s*P], (int32_t*) &work[s*P], 2*P, max_exp - block_exp[s]);
+
+  for(unsigned s = 0; s < m; s++)
+    for(unsigned q = 0; q < P; q++)
+      X[s + m*q] = work[s*P + q];
+
+  *exp = max_exp;
+  *hr = vect_complex_s32_headroom(X, M);
+}
+
+
+/*
+ * Equivalent of fft_mono_adjust() for any even N = 2M, with W = W_N^k. X[] must have 2 bits of
+ * headroom.
+ * 
+ * Forward:  Turns the M-point DFT Z[] of z[n] = v[2n] + j*v[2n+1] into the N-point DFT V[] of v[],
+ *           with V[0] and V[M] packed into X[0].
+ *             V[k] = (Z[k] + Z*[M-k])/2 - j*W*(Z[k] - Z*[M-k])/2
+ * Inverse:  The reverse, including a factor of 1/2.
+ *             Z[k] = (V[k] + V*[M-k])/2 + j*(V[k] - V*[M-k])/(2*W)
+ */
+static void dct_mono_adjust(
+    complex_s32_t X[],
+    const unsigned M,
+    const unsigned inverse)
+{
+  const complex_s32_t X0 = X[0];
+  X[0].re = inverse? ((X0.re + X0.im + 1) >> 1) : X0.re + X0.im;
+  X[0].im = inverse? ((X0.re - X0.im + 1) >> 1) : X0.re - X0.im;
+
+  for(unsigned k = 1; 2*k <= M; k++){
+    const complex_s32_t a = X[k];
+    const complex_s32_t b = X[M-k];
+
+    for(int i = 0; i < 2; i++){
+      // First X[k] from (a,b) and then X[M-k] from (b,a)
+      const complex_s32_t u = i? b : a;
+      const complex_s32_t v = i? a : b;
+      const complex_s32_t W = dct_rotation(i? (M-k) : k, 2*M);
+
+      const int64_t sum_re = ((int64_t) u.re) + v.re;
+      const int64_t sum_im = ((int64_t) u.im) + v.im;
+      const int64_t dif_re = ((int64_t) u.re) - v.re;
+      const int64_t dif_im = ((int64_t) u.im) - v.im;
+
+      int64_t re, im;
+      if(inverse){
+        re = (sum_re << 30) - W.re * sum_im + W.im * dif_re;
+        im = (dif_im << 30) + W.re * dif_re + W.im * sum_im;
+      } else {
+        re = (sum_re << 30) + W.re * sum_im + W.im * dif_re;
+        im = (dif_im << 30) - W.re * dif_re + W.im * sum_im;
+      }
+      X[i? (M-k) : k].re = (int32_t) ((re + (1 << 30)) >> 31);
+      X[i? (M-k) : k].im = (int32_t) ((im + (1 << 30)) >> 31);
+    }
+  }
+}
+
+
+void dct_forward(
+    int32_t x[],
+    int32_t scratch[],
+    const unsigned dct_length,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  dct_check_length(dct_length);
+#endif
+
+  const unsigned N = dct_length;
+
+  if(dct_is_fixed_length(N)){
+    // The fixed-length DCTs cannot saturate, so use all available headroom for precision
+    vect_s32_shl(x, x, N, *hr);
+    *exp -= *hr;
+
+    switch(N){
+      case 6:  dct6_forward(x, x);  *exp += dct6_exp;  break;
+      case 8:  dct8_forward(x, x);  *exp += dct8_exp;  break;
+      case 12: dct12_forward(x, x); *exp += dct12_exp; break;
+      case 16: dct16_forward(x, x); *exp += dct16_exp; break;
+      case 24: dct24_forward(x, x); *exp += dct24_exp; break;
+      case 32: dct32_forward(x, x); *exp += dct32_exp; break;
+      case 48: dct48_forward(x, x); *exp += dct48_exp; break;
+      case 64: dct64_forward(x, x); *exp += dct64_exp; break;
+    }
+    *hr = vect_s32_headroom(x, N);
+    return;
+  }
+
+  // Makhoul's algorithm: reorder x[] into v[] with v[n] = x[2n] and v[N-1-n] = x[2n+1], take the
+  // real N-point DFT V[k] of v[] using an N/2-point complex DFT, and then
+  //   y[k]   =  2 Re{ W_{4N}^k V[k] }
+  //   y[N-k] = -2 Im{ W_{4N}^k V[k] }
+  const unsigned M = N >> 1;
+  complex_s32_t* X = (complex_s32_t*) scratch;
+
+  // fft_dit_forward() requires 2 bits of headroom
+  const left_shift_t x_shl = *hr - 2;
+  vect_s32_shl(x, x, N, x_shl);
+  *exp -= x_shl;
+
+  for(unsigned n = 0; n < M; n++){
+    scratch[n] = x[2*n];
+    scratch[N-1-n] = x[2*n+1];
+  }
+
+  headroom_t X_hr = 2;
+  if(dct_is_radix2(N)){
+    fft_index_bit_reversal(X, M);
+    fft_dit_forward(X, M, &X_hr, exp);
+    fft_mono_adjust(X, N, 0);
+  } else {
+    // x[] is no longer needed, so it is the work buffer for the DFT
+    dct_dft(X, (complex_s32_t*) x, M, 0, &X_hr, exp);
+    const left_shift_t X_shl = X_hr - 2;
+    vect_s32_shl(scratch, scratch, N, X_shl);
+    *exp -= X_shl;
+    dct_mono_adjust(X, M, 0);
+  }
+
+  // Rotating by W_{4N}^k can grow the real or imaginary part by up to sqrt(2)
+  X_hr = vect_complex_s32_headroom(X, M);
+  if(X_hr == 0){
+    vect_s32_shr(scratch, scratch, N, 1);
+    *exp += 1;
+  }
+
+  // X[0] holds V[0] + j*V[N/2]
+  x[0] = X[0].re;
+  x[M] = dct_q30_mul(X[0].im, dct_twiddle(M, N).re);
+
+  for(unsigned k = 1; k < M; k++){
+    const complex_s32_t W = dct_twiddle(k, N);
+    const int64_t re = ((int64_t) W.re) * X[k].re - ((int64_t) W.im) * X[k].im;
+    const int64_t im = ((int64_t) W.re) * X[k].im + ((int64_t) W.im) * X[k].re;
+    x[k]   =  (int32_t) ((re + (1 << 29)) >> 30);
+    x[N-k] = -(int32_t) ((im + (1 << 29)) >> 30);
+  }
+
+  // The factor of 2 is applied through the exponent
+  *exp += 1;
+  *hr = vect_s32_headroom(x, N);
+}
+
+
+void dct_inverse(
+    int32_t x[],
+    int32_t scratch[],
+    const unsigned dct_length,
+    headroom_t* hr,
+    exponent_t* exp)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  dct_check_length(dct_length);
+#endif
+
+  const unsigned N = dct_length;
+
+  if(dct_is_fixed_length(N)){
+    // The fixed-length DCTs cannot saturate, so use all available headroom for precision
+    vect_s32_shl(x, x, N, *hr);
+    *exp -= *hr;
+
+    switch(N){
+      case 6:  dct6_inverse(x, x);  break;
+      case 8:  dct8_inverse(x, x);  break;
+      case 12: dct12_inverse(x, x); break;
+      case 16: dct16_inverse(x, x); break;
+      case 24: dct24_inverse(x, x); break;
+      case 32: dct32_inverse(x, x); break;
+      case 48: dct48_inverse(x, x); break;
+      case 64: dct64_inverse(x, x); break;
+    }
+    *hr = vect_s32_headroom(x, N);
+    return;
+  }
+
+  // Reverses the steps of dct_forward(). With P[k] = (y[k] - j*y[N-k]) / 2, the real DFT of the
+  // reordered output is V[k] = W_{4N}^{-k} P[k], whose inverse gives v[] and hence x[].
+  const unsigned M = N >> 1;
+  complex_s32_t* X = (complex_s32_t*) scratch;
+
+  // Rotating by W_{4N}^{-k} can grow the real or imaginary part by up to sqrt(2)
+  const left_shift_t x_shl = *hr - 1;
+  vect_s32_shl(x, x, N, x_shl);
+  *exp -= x_shl;
+
+  // X[0] holds V[0] + j*V[N/2]. The factor of 1/2 is applied through the exponent.
+  X[0].re = x[0];
+  X[0].im = (int32_t) ((((int64_t) x[M]) * dct_twiddle(M, N).re + (1 << 28)) >> 29);
+
+  for(unsigned k = 1; k < M; k++){
+    const complex_s32_t W = dct_twiddle(k, N);
+    // conj(W) * (x[k] - j*x[N-k])
+    const int64_t re = ((int64_t) W.re) * x[k] - ((int64_t) W.im) * x[N-k];
+    const int64_t im = -((int64_t) W.re) * x[N-k] - ((int64_t) W.im) * x[k];
+    X[k].re = (int32_t) ((re + (1 << 29)) >> 30);
+    X[k].im = (int32_t) ((im + (1 << 29)) >> 30);
+  }
+  *exp -= 1;
+
+  // fft_mono_adjust() and fft_dit_inverse() (and their equivalents here) require 2 bits of headroom
+  headroom_t X_hr = vect_complex_s32_headroom(X, M);
+  const left_shift_t X_shl = X_hr - 2;
+  vect_s32_shl(scratch, scratch, N, X_shl);
+  *exp -= X_shl;
+  X_hr = 2;
+
+  if(dct_is_radix2(N)){
+    fft_mono_adjust(X, N, 1);
+    fft_index_bit_reversal(X, M);
+    fft_dit_inverse(X, M, &X_hr, exp);
+  } else {
+    // x[] is no longer needed, so it is the work buffer for the IDFT
+    dct_mono_adjust(X, M, 1);
+    dct_dft(X, (complex_s32_t*) x, M, 1, &X_hr, exp);
+  }
+
+  for(unsigned n = 0; n < M; n++){
+    x[2*n] = scratch[n];
+    x[2*n+1] = scratch[N-1-n];
+  }
+
+  *hr = vect_s32_headroom(x, N);
+}
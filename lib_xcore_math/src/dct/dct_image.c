@@ -0,0 +1,322 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+#include "vpu_helper.h"
+
+
+// 16-point equivalents of dct8_matrix_16bit[][] and idct8_matrix_16bit[][]
+static const int16_t DWORD_ALIGNED dct16_matrix_16bit[16][16] = {
+{ 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000 },
+{ 0x3FB1, 0x3D3F, 0x3871, 0x3179, 0x289A, 0x1E2B, 0x1294, 0x646, 0xF9BA, 0xED6C, 0xE1D5, 0xD766, 0xCE87, 0xC78F, 0xC2C1, 0xC04F },
+{ 0x3EC5, 0x3537, 0x238E, 0xC7C, 0xF384, 0xDC72, 0xCAC9, 0xC13B, 0xC13B, 0xCAC9, 0xDC72, 0xF384, 0xC7C, 0x238E, 0x3537, 0x3EC5 },
+{ 0x3D3F, 0x289A, 0x646, 0xE1D5, 0xC78F, 0xC04F, 0xCE87, 0xED6C, 0x1294, 0x3179, 0x3FB1, 0x3871, 0x1E2B, 0xF9BA, 0xD766, 0xC2C1 },
+{ 0x3B21, 0x187E, 0xE782, 0xC4DF, 0xC4DF, 0xE782, 0x187E, 0x3B21, 0x3B21, 0x187E, 0xE782, 0xC4DF, 0xC4DF, 0xE782, 0x187E, 0x3B21 },
+{ 0x3871, 0x646, 0xCE87, 0xC2C1, 0xED6C, 0x289A, 0x3FB1, 0x1E2B, 0xE1D5, 0xC04F, 0xD766, 0x1294, 0x3D3F, 0x3179, 0xF9BA, 0xC78F },
+{ 0x3537, 0xF384, 0xC13B, 0xDC72, 0x238E, 0x3EC5, 0xC7C, 0xCAC9, 0xCAC9, 0xC7C, 0x3EC5, 0x238E, 0xDC72, 0xC13B, 0xF384, 0x3537 },
+{ 0x3179, 0xE1D5, 0xC2C1, 0x646, 0x3FB1, 0x1294, 0xC78F, 0xD766, 0x289A, 0x3871, 0xED6C, 0xC04F, 0xF9BA, 0x3D3F, 0x1E2B, 0xCE87 },
+{ 0x2D41, 0xD2BF, 0xD2BF, 0x2D41, 0x2D41, 0xD2BF, 0xD2BF, 0x2D41, 0x2D41, 0xD2BF, 0xD2BF, 0x2D41, 0x2D41, 0xD2BF, 0xD2BF, 0x2D41 },
+{ 0x289A, 0xC78F, 0xED6C, 0x3FB1, 0xF9BA, 0xC2C1, 0x1E2B, 0x3179, 0xCE87, 0xE1D5, 0x3D3F, 0x646, 0xC04F, 0x1294, 0x3871, 0xD766 },
+{ 0x238E, 0xC13B, 0xC7C, 0x3537, 0xCAC9, 0xF384, 0x3EC5, 0xDC72, 0xDC72, 0x3EC5, 0xF384, 0xCAC9, 0x3537, 0xC7C, 0xC13B, 0x238E },
+{ 0x1E2B, 0xC04F, 0x289A, 0x1294, 0xC2C1, 0x3179, 0x646, 0xC78F, 0x3871, 0xF9BA, 0xCE87, 0x3D3F, 0xED6C, 0xD766, 0x3FB1, 0xE1D5 },
+{ 0x187E, 0xC4DF, 0x3B21, 0xE782, 0xE782, 0x3B21, 0xC4DF, 0x187E, 0x187E, 0xC4DF, 0x3B21, 0xE782, 0xE782, 0x3B21, 0xC4DF, 0x187E },
+{ 0x1294, 0xCE87, 0x3FB1, 0xC78F, 0x1E2B, 0x646, 0xD766, 0x3D3F, 0xC2C1, 0x289A, 0xF9BA, 0xE1D5, 0x3871, 0xC04F, 0x3179, 0xED6C },
+{ 0xC7C, 0xDC72, 0x3537, 0xC13B, 0x3EC5, 0xCAC9, 0x238E, 0xF384, 0xF384, 0x238E, 0xCAC9, 0x3EC5, 0xC13B, 0x3537, 0xDC72, 0xC7C },
+{ 0x646, 0xED6C, 0x1E2B, 0xD766, 0x3179, 0xC78F, 0x3D3F, 0xC04F, 0x3FB1, 0xC2C1, 0x3871, 0xCE87, 0x289A, 0xE1D5, 0x1294, 0xF9BA },
+};
+
+
+static const int16_t DWORD_ALIGNED idct16_matrix_16bit[16][16] = {
+{ 0x2000, 0x3FB1, 0x3EC5, 0x3D3F, 0x3B21, 0x3871, 0x3537, 0x3179, 0x2D41, 0x289A, 0x238E, 0x1E2B, 0x187E, 0x1294, 0xC7C, 0x646 },
+{ 0x2000, 0x3D3F, 0x3537, 0x289A, 0x187E, 0x646, 0xF384, 0xE1D5, 0xD2BF, 0xC78F, 0xC13B, 0xC04F, 0xC4DF, 0xCE87, 0xDC72, 0xED6C },
+{ 0x2000, 0x3871, 0x238E, 0x646, 0xE782, 0xCE87, 0xC13B, 0xC2C1, 0xD2BF, 0xED6C, 0xC7C, 0x289A, 0x3B21, 0x3FB1, 0x3537, 0x1E2B },
+{ 0x2000, 0x3179, 0xC7C, 0xE1D5, 0xC4DF, 0xC2C1, 0xDC72, 0x646, 0x2D41, 0x3FB1, 0x3537, 0x1294, 0xE782, 0xC78F, 0xC13B, 0xD766 },
+{ 0x2000, 0x289A, 0xF384, 0xC78F, 0xC4DF, 0xED6C, 0x238E, 0x3FB1, 0x2D41, 0xF9BA, 0xCAC9, 0xC2C1, 0xE782, 0x1E2B, 0x3EC5, 0x3179 },
+{ 0x2000, 0x1E2B, 0xDC72, 0xC04F, 0xE782, 0x289A, 0x3EC5, 0x1294, 0xD2BF, 0xC2C1, 0xF384, 0x3179, 0x3B21, 0x646, 0xCAC9, 0xC78F },
+{ 0x2000, 0x1294, 0xCAC9, 0xCE87, 0x187E, 0x3FB1, 0xC7C, 0xC78F, 0xD2BF, 0x1E2B, 0x3EC5, 0x646, 0xC4DF, 0xD766, 0x238E, 0x3D3F },
+{ 0x2000, 0x646, 0xC13B, 0xED6C, 0x3B21, 0x1E2B, 0xCAC9, 0xD766, 0x2D41, 0x3179, 0xDC72, 0xC78F, 0x187E, 0x3D3F, 0xF384, 0xC04F },
+{ 0x2000, 0xF9BA, 0xC13B, 0x1294, 0x3B21, 0xE1D5, 0xCAC9, 0x289A, 0x2D41, 0xCE87, 0xDC72, 0x3871, 0x187E, 0xC2C1, 0xF384, 0x3FB1 },
+{ 0x2000, 0xED6C, 0xCAC9, 0x3179, 0x187E, 0xC04F, 0xC7C, 0x3871, 0xD2BF, 0xE1D5, 0x3EC5, 0xF9BA, 0xC4DF, 0x289A, 0x238E, 0xC2C1 },
+{ 0x2000, 0xE1D5, 0xDC72, 0x3FB1, 0xE782, 0xD766, 0x3EC5, 0xED6C, 0xD2BF, 0x3D3F, 0xF384, 0xCE87, 0x3B21, 0xF9BA, 0xCAC9, 0x3871 },
+{ 0x2000, 0xD766, 0xF384, 0x3871, 0xC4DF, 0x1294, 0x238E, 0xC04F, 0x2D41, 0x646, 0xCAC9, 0x3D3F, 0xE782, 0xE1D5, 0x3EC5, 0xCE87 },
+{ 0x2000, 0xCE87, 0xC7C, 0x1E2B, 0xC4DF, 0x3D3F, 0xDC72, 0xF9BA, 0x2D41, 0xC04F, 0x3537, 0xED6C, 0xE782, 0x3871, 0xC13B, 0x289A },
+{ 0x2000, 0xC78F, 0x238E, 0xF9BA, 0xE782, 0x3179, 0xC13B, 0x3D3F, 0xD2BF, 0x1294, 0xC7C, 0xD766, 0x3B21, 0xC04F, 0x3537, 0xE1D5 },
+{ 0x2000, 0xC2C1, 0x3537, 0xD766, 0x187E, 0xF9BA, 0xF384, 0x1E2B, 0xD2BF, 0x3871, 0xC13B, 0x3FB1, 0xC4DF, 0x3179, 0xDC72, 0x1294 },
+{ 0x2000, 0xC04F, 0x3EC5, 0xC2C1, 0x3B21, 0xC78F, 0x3537, 0xCE87, 0x2D41, 0xD766, 0x238E, 0xE1D5, 0x187E, 0xED6C, 0xC7C, 0xF9BA },
+};
+
+
+/*
+ * First step in the 16-by-16 DCT. Does a 16-point DCT of each row of the block at x[] (whose rows
+ * are x_stride elements apart), and populates y[][] with the *transpose* of that. Relative to
+ * dct8x8_stageA() the result is scaled down by a further 2 bits, so that the 16-term accumulations
+ * in the second stage cannot overflow.
+ */
+static void dct16x16_stageA(
+    int16_t y[16][16],
+    const int8_t x[],
+    const unsigned x_stride,
+    const int16_t matrix[16][16])
+{
+  int16_t DWORD_ALIGNED row[16];
+
+  for(int r = 0; r < 16; r++){
+    for(int c = 0; c < 16; c++)
+      row[c] = x[r * x_stride + c];
+
+    for(int k = 0; k < 16; k++)
+      y[k][r] = vlsat16(vlmaccr16(0, row, matrix[k]), 12);
+  }
+}
+
+
+/*
+ * Second step in the 16-by-16 DCT. Does a 16-point DCT of each row of x[][], and populates the
+ * block at y[] (whose rows are y_stride elements apart) with the *transpose* of that, returning its
+ * headroom.
+ */
+static headroom_t dct16x16_stageB(
+    int8_t y[],
+    const unsigned y_stride,
+    const int16_t x[16][16],
+    const int16_t matrix[16][16],
+    const right_shift_t sat)
+{
+  const right_shift_t shr = 16 + sat;
+  int32_t bits = 0;
+
+  for(int c = 0; c < 16; c++){
+    for(int k = 0; k < 16; k++){
+      const int8_t v = vdepth8_16(vlsat16(vlmaccr16(0, x[c], matrix[k]), shr));
+      y[k * y_stride + c] = v;
+      bits |= v ^ (v >> 7);
+    }
+  }
+
+  return HR_S8(bits);
+}
+
+
+/*
+ * Quantising second step of the forward DCT (either size), with N-by-N output y[][]. Each output
+ * is multiplied by the Q16 reciprocal of its quantiser step before a single rounding and
+ * saturation to 8 bits.
+ */
+static headroom_t dct_stageB_quant(
+    int8_t y[],
+    const int16_t x[],
+    const int16_t matrix[][16],
+    const unsigned N,
+    const right_shift_t sat,
+    const int32_t recip[])
+{
+  // Both DCT sizes accumulate 24 bits above the output scale (see dct16x16_stageA())
+  const right_shift_t shr = 24 + sat + 16;
+  int16_t DWORD_ALIGNED row[16] = { 0 };
+  int32_t bits = 0;
+
+  for(unsigned c = 0; c < N; c++){
+    memcpy(row, &x[c * N], N * sizeof(int16_t));
+
+    for(unsigned k = 0; k < N; k++){
+      const int64_t p = ((int64_t) vlmaccr16(0, row, matrix[k])) * recip[k * N + c];
+      const int64_t q = (p + (((int64_t) 1) << (shr - 1))) >> shr;
+      const int8_t v = SAT(8)(q);
+      y[k * N + c] = v;
+      bits |= v ^ (v >> 7);
+    }
+  }
+
+  return HR_S8(bits);
+}
+
+
+static void dct_quant_reciprocals(
+    int32_t recip[],
+    const uint8_t quant[],
+    const unsigned count)
+{
+  for(unsigned k = 0; k < count; k++){
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+    assert(quant[k] != 0);
+#endif
+    recip[k] = ((1 << 16) + (quant[k] >> 1)) / quant[k];
+  }
+}
+
+
+headroom_t dct16x16_forward(
+    int8_t y[16][16],
+    const int8_t x[16][16],
+    const right_shift_t sat)
+{
+  int16_t DWORD_ALIGNED buff[16][16];
+  dct16x16_stageA(buff, &x[0][0], 16, dct16_matrix_16bit);
+  return dct16x16_stageB(&y[0][0], 16, (const int16_t (*)[16]) buff, dct16_matrix_16bit, sat);
+}
+
+
+headroom_t dct16x16_inverse(
+    int8_t y[16][16],
+    const int8_t x[16][16],
+    const right_shift_t sat)
+{
+  int16_t DWORD_ALIGNED buff[16][16];
+  dct16x16_stageA(buff, &x[0][0], 16, idct16_matrix_16bit);
+  return dct16x16_stageB(&y[0][0], 16, (const int16_t (*)[16]) buff, idct16_matrix_16bit, sat);
+}
+
+
+headroom_t dct8x8_forward_image(
+    int8_t y[][8][8],
+    const int8_t x[],
+    const unsigned width,
+    const unsigned height,
+    const unsigned x_stride,
+    const right_shift_t sat,
+    const uint8_t quant[8][8])
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert((width % 8) == 0);
+  assert((height % 8) == 0);
+  assert(x_stride >= width);
+#endif
+
+  int8_t DWORD_ALIGNED block[8][8];
+  int16_t DWORD_ALIGNED buff[8][8];
+  int32_t recip[8*8];
+  headroom_t hr = 8;
+
+  if(quant != NULL)
+    dct_quant_reciprocals(recip, &quant[0][0], 8*8);
+
+  // Blocks are taken in raster order
+  for(unsigned row = 0; row < height; row += 8){
+    for(unsigned col = 0; col < width; col += 8){
+      for(int r = 0; r < 8; r++)
+        memcpy(block[r], &x[(row + r) * x_stride + col], 8);
+
+      dct8x8_stageA(buff, (const int8_t (*)[8]) block, dct8_matrix_16bit);
+
+      const headroom_t blk_hr = (quant == NULL)?
+          dct8x8_stageB(y[0], (const int16_t (*)[8]) buff, dct8_matrix_16bit, sat)
+        : dct_stageB_quant(&y[0][0][0], &buff[0][0], (const int16_t (*)[16]) dct8_matrix_16bit,
+                           8, sat, recip);
+      hr = MIN(hr, blk_hr);
+      y++;
+    }
+  }
+
+  return hr;
+}
+
+
+headroom_t dct8x8_inverse_image(
+    int8_t y[],
+    const int8_t x[][8][8],
+    const unsigned width,
+    const unsigned height,
+    const unsigned y_stride,
+    const right_shift_t sat)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert((width % 8) == 0);
+  assert((height % 8) == 0);
+  assert(y_stride >= width);
+#endif
+
+  int8_t DWORD_ALIGNED block[8][8];
+  int16_t DWORD_ALIGNED buff[8][8];
+  headroom_t hr = 8;
+
+  for(unsigned row = 0; row < height; row += 8){
+    for(unsigned col = 0; col < width; col += 8){
+      dct8x8_stageA(buff, x[0], idct8_matrix_16bit);
+      const headroom_t blk_hr = dct8x8_stageB(block, (const int16_t (*)[8]) buff,
+                                              idct8_matrix_16bit, sat);
+      hr = MIN(hr, blk_hr);
+      x++;
+
+      for(int r = 0; r < 8; r++)
+        memcpy(&y[(row + r) * y_stride + col], block[r], 8);
+    }
+  }
+
+  return hr;
+}
+
+
+headroom_t dct16x16_forward_image(
+    int8_t y[][16][16],
+    const int8_t x[],
+    const unsigned width,
+    const unsigned height,
+    const unsigned x_stride,
+    const right_shift_t sat,
+    const uint8_t quant[16][16])
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert((width % 16) == 0);
+  assert((height % 16) == 0);
+  assert(x_stride >= width);
+#endif
+
+  int16_t DWORD_ALIGNED buff[16][16];
+  int32_t recip[16*16];
+  headroom_t hr = 8;
+
+  if(quant != NULL)
+    dct_quant_reciprocals(recip, &quant[0][0], 16*16);
+
+  // Blocks are taken in raster order
+  for(unsigned row = 0; row < height; row += 16){
+    for(unsigned col = 0; col < width; col += 16){
+      dct16x16_stageA(buff, &x[row * x_stride + col], x_stride, dct16_matrix_16bit);
+
+      const headroom_t blk_hr = (quant == NULL)?
+          dct16x16_stageB(&y[0][0][0], 16, (const int16_t (*)[16]) buff, dct16_matrix_16bit, sat)
+        : dct_stageB_quant(&y[0][0][0], &buff[0][0], dct16_matrix_16bit, 16, sat, recip);
+      hr = MIN(hr, blk_hr);
+      y++;
+    }
+  }
+
+  return hr;
+}
+
+
+headroom_t dct16x16_inverse_image(
+    int8_t y[],
+    const int8_t x[][16][16],
+    const unsigned width,
+    const unsigned height,
+    const unsigned y_stride,
+    const right_shift_t sat)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert((width % 16) == 0);
+  assert((height % 16) == 0);
+  assert(y_stride >= width);
+#endif
+
+  int16_t DWORD_ALIGNED buff[16][16];
+  headroom_t hr = 8;
+
+  for(unsigned row = 0; row < height; row += 16){
+    for(unsigned col = 0; col < width; col += 16){
+      dct16x16_stageA(buff, &x[0][0][0], 16, idct16_matrix_16bit);
+      const headroom_t blk_hr = dct16x16_stageB(&y[row * y_stride + col], y_stride,
+                                                (const int16_t (*)[16]) buff,
+                                                idct16_matrix_16bit, sat);
+      hr = MIN(hr, blk_hr);
+      x++;
+    }
+  }
+
+  return hr;
+}
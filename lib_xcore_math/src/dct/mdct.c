@@ -0,0 +1,384 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+#include "xmath_fft_lut.h"
+#include "xmath_internal.h"
+
+
+// 2/3 and sqrt(3)/2 as Q2.30
+#define Q30_TWO_THIRDS      (0x2AAAAAAB)
+#define Q30_HALF_SQRT3      (0x376CF5D1)
+
+
+// (b * c) >> shr with rounding. shr must be non-negative.
+static inline int32_t mdct_mul(
+    const int32_t b,
+    const int32_t c,
+    const right_shift_t shr)
+{
+  const int64_t p = ((int64_t) b) * c;
+  if(shr == 0)
+    return (int32_t) p;
+  if(shr > 62)
+    return 0;
+  return (int32_t) ((p + (((int64_t) 1) << (shr - 1))) >> shr);
+}
+
+
+// (p >> shr) with rounding, for a 64-bit product. shr must be non-negative.
+static inline int32_t mdct_round(
+    const int64_t p,
+    const right_shift_t shr)
+{
+  if(shr == 0)
+    return (int32_t) p;
+  if(shr > 62)
+    return 0;
+  return (int32_t) ((p + (((int64_t) 1) << (shr - 1))) >> shr);
+}
+
+
+static inline int32_t mdct_shr(
+    const int32_t x,
+    const right_shift_t shr)
+{
+  if(shr >= 32)
+    return (x < 0)? -1 : 0;
+  return (shr >= 0)? (x >> shr) : (int32_t) (((int64_t) x) * (((int64_t) 1) << -shr));
+}
+
+
+// exp(-j*2*pi*num/den) as a Q2.30
+static inline complex_s32_t mdct_twiddle(
+    const unsigned num,
+    const unsigned den)
+{
+  return xmath_turn_phasor((uint32_t) (((((uint64_t) num) << 32) + den/2) / den));
+}
+
+
+static unsigned mdct_log2(
+    unsigned x)
+{
+  unsigned res = 0;
+  while(x >>= 1)
+    res++;
+  return res;
+}
+
+
+void mdct_init(
+    mdct_s32_t* mdct,
+    int32_t buffer[],
+    const q2_30 window[],
+    const unsigned frame_length)
+{
+  const unsigned F = frame_length;
+  const unsigned Q = F >> 1;
+  const unsigned radix3 = (F % 3) == 0;
+  const unsigned M = radix3? (Q / 3) : Q;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  // The FFT length (or each of the three sub-FFT lengths) must be a power of 2 of at least 4
+  assert(M >= 4);
+  assert((M & (M-1)) == 0);
+  assert(M <= (1 << MAX_DIT_FFT_LOG2));
+#endif
+
+  mdct->frame_length = F;
+  mdct->window = window;
+  mdct->scratch = (complex_s32_t*) &buffer[0];
+  mdct->pre_twiddle = (complex_s32_t*) &buffer[F];
+  mdct->post_twiddle = (complex_s32_t*) &buffer[2*F];
+
+  for(unsigned k = 0; k < Q; k++){
+    mdct->pre_twiddle[k] = mdct_twiddle(4*k + 1, 8*F);
+    mdct->post_twiddle[k] = mdct_twiddle(k, 2*F);
+  }
+
+  unsigned state_offset = 3*F;
+
+  if(radix3){
+    mdct->radix3_twiddle = (complex_s32_t*) &buffer[3*F];
+    for(unsigned k = 0; k < M; k++){
+      mdct->radix3_twiddle[2*k] = mdct_twiddle(k, Q);
+      mdct->radix3_twiddle[2*k+1] = mdct_twiddle(2*k, Q);
+    }
+    state_offset += 4*M;
+  } else {
+    mdct->radix3_twiddle = NULL;
+  }
+
+  memset(&buffer[state_offset], 0, F * sizeof(int32_t));
+  bfp_s32_init(&mdct->state, &buffer[state_offset], -31, F, 0);
+  mdct->state.hr = 31;
+}
+
+
+// Position in the scratch buffer of element m of the FFT input. With a radix-3 first stage, the
+// input is split into three interleaved sub-sequences, each of which is transformed separately.
+static inline unsigned mdct_fft_index(
+    const mdct_s32_t* mdct,
+    const unsigned m)
+{
+  if(mdct->radix3_twiddle == NULL)
+    return m;
+  const unsigned M = mdct->frame_length / 6;
+  return (m % 3) * M + (m / 3);
+}
+
+
+// In-place forward DFT of the (frame_length/2)-element scratch buffer
+static void mdct_fft(
+    mdct_s32_t* mdct,
+    exponent_t* exp,
+    headroom_t* hr)
+{
+  const unsigned Q = mdct->frame_length >> 1;
+  complex_s32_t* Z = mdct->scratch;
+
+  if(mdct->radix3_twiddle == NULL){
+    bfp_complex_s32_t Z_bfp;
+    bfp_complex_s32_init(&Z_bfp, Z, *exp, Q, 0);
+    Z_bfp.hr = *hr;
+    bfp_fft_forward_complex(&Z_bfp);
+    *exp = Z_bfp.exp;
+    *hr = Z_bfp.hr;
+    return;
+  }
+
+  const unsigned M = Q / 3;
+  bfp_complex_s32_t sub[3];
+  exponent_t max_exp = INT32_MIN;
+
+  for(int s = 0; s < 3; s++){
+    bfp_complex_s32_init(&sub[s], &Z[s*M], *exp, M, 0);
+    sub[s].hr = *hr;
+    bfp_fft_forward_complex(&sub[s]);
+    sub[s].hr = vect_complex_s32_headroom(sub[s].data, M);
+    const exponent_t e = sub[s].exp - sub[s].hr;
+    max_exp = (e > max_exp)? e : max_exp;
+  }
+
+  // Each output is the sum of three rotated sub-DFT outputs, which can grow by up to 3*sqrt(2)
+  const exponent_t out_exp = max_exp + 3;
+  for(int s = 0; s < 3; s++)
+    vect_s32_shl((int32_t*) sub[s].data, (int32_t*) sub[s].data, 2*M, sub[s].exp - out_exp);
+
+  const complex_s32_t* W = mdct->radix3_twiddle;
+
+  for(unsigned k = 0; k < M; k++){
+    const complex_s32_t A = Z[k];
+    const complex_s32_t B = Z[M + k];
+    const complex_s32_t C = Z[2*M + k];
+    const complex_s32_t W1 = W[2*k];
+    const complex_s32_t W2 = W[2*k+1];
+
+    const int32_t b_re = mdct_round(((int64_t) W1.re) * B.re - ((int64_t) W1.im) * B.im, 30);
+    const int32_t b_im = mdct_round(((int64_t) W1.re) * B.im + ((int64_t) W1.im) * B.re, 30);
+    const int32_t c_re = mdct_round(((int64_t) W2.re) * C.re - ((int64_t) W2.im) * C.im, 30);
+    const int32_t c_im = mdct_round(((int64_t) W2.re) * C.im + ((int64_t) W2.im) * C.re, 30);
+
+    const int32_t s_re = b_re + c_re;
+    const int32_t s_im = b_im + c_im;
+    const int32_t d_re = mdct_mul(b_re - c_re, Q30_HALF_SQRT3, 30);
+    const int32_t d_im = mdct_mul(b_im - c_im, Q30_HALF_SQRT3, 30);
+    const int32_t h_re = A.re - (s_re >> 1);
+    const int32_t h_im = A.im - (s_im >> 1);
+
+    // Multiplying by exp(-j*2*pi/3) and exp(-j*4*pi/3)
+    Z[k].re       = A.re + s_re;
+    Z[k].im       = A.im + s_im;
+    Z[M + k].re   = h_re + d_im;
+    Z[M + k].im   = h_im - d_re;
+    Z[2*M + k].re = h_re - d_im;
+    Z[2*M + k].im = h_im + d_re;
+  }
+
+  *exp = out_exp;
+  *hr = vect_complex_s32_headroom(Z, Q);
+}
+
+
+void mdct_forward(
+    mdct_s32_t* mdct,
+    bfp_s32_t* X,
+    const bfp_s32_t* x)
+{
+  const unsigned F = mdct->frame_length;
+  const unsigned Q = F >> 1;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(x->length == F);
+#endif
+
+  // The 2F-sample input block is the previous frame followed by the new frame. The windowed block
+  // (a, b, c, d) is folded to the F-element sequence u = (-c_r - d, a - b_r), whose DCT-IV is the
+  // MDCT. The DCT-IV is computed with an F/2-point complex FFT between pre- and post-rotations.
+  const int32_t* prev = mdct->state.data;
+  const int32_t* cur = x->data;
+  const q2_30* w = mdct->window;
+
+  // Shift both halves to a common exponent, leaving headroom for the folding and rotation
+  const exponent_t e_prev = mdct->state.exp - mdct->state.hr;
+  const exponent_t e_cur = x->exp - x->hr;
+  exponent_t exp = ((e_prev > e_cur)? e_prev : e_cur) + 3;
+  const right_shift_t prev_shr = 30 + exp - mdct->state.exp;
+  const right_shift_t cur_shr = 30 + exp - x->exp;
+
+  complex_s32_t* Z = mdct->scratch;
+  const complex_s32_t* pre = mdct->pre_twiddle;
+
+  for(unsigned m = 0; m < Q; m++){
+    int32_t u_even, u_odd;
+
+    // u[2m] and u[F-1-2m]
+    if(2*m < Q){
+      const unsigned i = Q - 1 - 2*m;
+      const unsigned j = Q + 2*m;
+      u_even = mdct_round(-((int64_t) w[F+i]) * cur[i] - ((int64_t) w[F+j]) * cur[j], cur_shr);
+      const unsigned a = Q - 1 - 2*m;
+      const unsigned b = Q + 2*m;
+      u_odd = mdct_round(((int64_t) w[a]) * prev[a] - ((int64_t) w[b]) * prev[b], prev_shr);
+    } else {
+      const unsigned a = 2*m - Q;
+      const unsigned b = F - 1 - a;
+      u_even = mdct_round(((int64_t) w[a]) * prev[a] - ((int64_t) w[b]) * prev[b], prev_shr);
+      const unsigned i = a;
+      const unsigned j = F - 1 - i;
+      u_odd = mdct_round(-((int64_t) w[F+j]) * cur[j] - ((int64_t) w[F+i]) * cur[i], cur_shr);
+    }
+
+    const complex_s32_t W = pre[m];
+    complex_s32_t* z = &Z[mdct_fft_index(mdct, m)];
+    z->re = mdct_round(((int64_t) W.re) * u_even - ((int64_t) W.im) * u_odd, 30);
+    z->im = mdct_round(((int64_t) W.re) * u_odd + ((int64_t) W.im) * u_even, 30);
+  }
+
+  headroom_t hr = vect_complex_s32_headroom(Z, Q);
+  mdct_fft(mdct, &exp, &hr);
+
+  // Rotating can grow the real or imaginary part by up to sqrt(2)
+  if(hr == 0){
+    vect_s32_shr((int32_t*) Z, (int32_t*) Z, F, 1);
+    exp += 1;
+  }
+
+  const complex_s32_t* post = mdct->post_twiddle;
+  for(unsigned k = 0; k < Q; k++){
+    const complex_s32_t W = post[k];
+    X->data[2*k] = mdct_round(((int64_t) W.re) * Z[k].re - ((int64_t) W.im) * Z[k].im, 30);
+    X->data[F-1-2*k] = -mdct_round(((int64_t) W.re) * Z[k].im + ((int64_t) W.im) * Z[k].re, 30);
+  }
+
+  X->length = F;
+  X->exp = exp;
+  X->hr = vect_s32_headroom(X->data, F);
+
+  // The new frame becomes the previous frame
+  memcpy(mdct->state.data, x->data, F * sizeof(int32_t));
+  mdct->state.exp = x->exp;
+  mdct->state.hr = x->hr;
+}
+
+
+void mdct_inverse(
+    mdct_s32_t* mdct,
+    bfp_s32_t* y,
+    const bfp_s32_t* X)
+{
+  const unsigned F = mdct->frame_length;
+  const unsigned Q = F >> 1;
+  const unsigned radix3 = mdct->radix3_twiddle != NULL;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(X->length == F);
+#endif
+
+  // The DCT-IV of X gives u = (u1, u2), which unfolds to the 2F-sample block
+  // (u2, -u2_r, -u1_r, -u1). This is windowed and scaled by 2/F, and the first half is added to
+  // the second half of the previous block.
+  complex_s32_t* Z = mdct->scratch;
+  const complex_s32_t* pre = mdct->pre_twiddle;
+
+  // Rotating can grow the real or imaginary part by up to sqrt(2)
+  exponent_t exp = X->exp - X->hr + 1;
+  const right_shift_t X_shr = 30 + exp - X->exp;
+
+  for(unsigned m = 0; m < Q; m++){
+    const int32_t u_even = X->data[2*m];
+    const int32_t u_odd = X->data[F-1-2*m];
+    const complex_s32_t W = pre[m];
+    complex_s32_t* z = &Z[mdct_fft_index(mdct, m)];
+    z->re = mdct_round(((int64_t) W.re) * u_even - ((int64_t) W.im) * u_odd, X_shr);
+    z->im = mdct_round(((int64_t) W.re) * u_odd + ((int64_t) W.im) * u_even, X_shr);
+
+    // Part of the 2/F scaling when F is not a power of 2
+    if(radix3){
+      z->re = mdct_mul(z->re, Q30_TWO_THIRDS, 30);
+      z->im = mdct_mul(z->im, Q30_TWO_THIRDS, 30);
+    }
+  }
+
+  headroom_t hr = vect_complex_s32_headroom(Z, Q);
+  mdct_fft(mdct, &exp, &hr);
+
+  if(hr == 0){
+    vect_s32_shr((int32_t*) Z, (int32_t*) Z, F, 1);
+    exp += 1;
+  }
+
+  // Post-rotation, in-place. Z[k] gives u[2k] and u[F-1-2k], which are in the slots of Z[k].re
+  // and Z[Q-1-k].im, so Z[k] and Z[Q-1-k] are processed together.
+  const complex_s32_t* post = mdct->post_twiddle;
+  int32_t* u = (int32_t*) Z;
+  for(unsigned k = 0; k < Q/2; k++){
+    const unsigned kk = Q - 1 - k;
+    const complex_s32_t A = Z[k];
+    const complex_s32_t B = Z[kk];
+    const complex_s32_t Wa = post[k];
+    const complex_s32_t Wb = post[kk];
+    u[2*k]      =  mdct_round(((int64_t) Wa.re) * A.re - ((int64_t) Wa.im) * A.im, 30);
+    u[F-1-2*k]  = -mdct_round(((int64_t) Wa.re) * A.im + ((int64_t) Wa.im) * A.re, 30);
+    u[2*kk]     =  mdct_round(((int64_t) Wb.re) * B.re - ((int64_t) Wb.im) * B.im, 30);
+    u[F-1-2*kk] = -mdct_round(((int64_t) Wb.re) * B.im + ((int64_t) Wb.im) * B.re, 30);
+  }
+
+  // The remaining power of 2 of the 2/F scaling
+  exp += (radix3? 0 : 1) - (exponent_t) mdct_log2(radix3? (F/3) : F);
+  const headroom_t u_hr = vect_s32_headroom(u, F);
+
+  // Output exponent, with a bit of headroom for the overlap-add
+  const exponent_t e_new = exp - u_hr;
+  const exponent_t e_old = mdct->state.exp - mdct->state.hr;
+  const exponent_t y_exp = ((e_new > e_old)? e_new : e_old) + 1;
+  const right_shift_t new_shr = 30 + y_exp - exp;
+  const right_shift_t old_shr = y_exp - mdct->state.exp;
+
+  const q2_30* w = mdct->window;
+  int32_t* ov = mdct->state.data;
+
+  for(unsigned n = 0; n < F; n++){
+    const int32_t v = (n < Q)? u[Q + n] : -u[F + Q - 1 - n];
+    y->data[n] = mdct_mul(w[n], v, new_shr) + mdct_shr(ov[n], old_shr);
+  }
+
+  // The second half of the block is kept for the next frame
+  for(unsigned n = 0; n < F; n++){
+    const int32_t v = (n < Q)? -u[Q - 1 - n] : -u[n - Q];
+    ov[n] = mdct_mul(w[F + n], v, 30);
+  }
+
+  mdct->state.exp = exp;
+  mdct->state.hr = vect_s32_headroom(ov, F);
+
+  y->length = F;
+  y->exp = y_exp;
+  y->hr = vect_s32_headroom(y->data, F);
+}
@@ -0,0 +1,228 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+#include "vpu_helper.h"
+
+
+/*
+ * A lifting step updates every element of one polyphase component (the even samples s[] or the odd
+ * samples d[]) in place from the other component,
+ *
+ *    y[i] += c0 * u[i] + c1 * u[i + offset]
+ *
+ * Because each step only reads the component it doesn't modify, the inverse step subtracts exactly
+ * the same (rounded) value, and the lifting steps themselves are bit-exact invertible.
+ */
+typedef struct {
+  unsigned odd;
+  int offset;
+  q2_30 c0;
+  q2_30 c1;
+} dwt_lift_step_t;
+
+typedef struct {
+  unsigned step_count;
+  dwt_lift_step_t step[4];
+  // Final scaling of s[] and d[]. For all supported wavelets scale_s * scale_d = 1, so the inverse
+  // scaling just swaps them.
+  q2_30 scale_s;
+  q2_30 scale_d;
+  // Whether the signal is extended periodically (rather than symmetrically) at its boundaries
+  unsigned periodic;
+  // Headroom required of the input to a single level (forward or inverse) to avoid saturation
+  headroom_t headroom;
+} dwt_wavelet_t;
+
+
+static const dwt_wavelet_t dwt_wavelets[] = {
+  // DWT_HAAR
+  { 2, {{ 1,  0, -0x40000000, 0 },
+        { 0,  0,  0x20000000, 0 }},
+    0x5A82799A, 0x2D413CCD, 0, 2 },
+  // DWT_DB4
+  { 3, {{ 1,  0, -0x6ED9EBA1, 0 },
+        { 0,  1,  0x1BB67AE8, -0x04498518 },
+        { 1, -1,  0,           0x40000000 }},
+    0x7BA3751D, 0x2120FB83, 1, 3 },
+  // DWT_CDF97
+  { 4, {{ 1,  1, -0x6583399E, -0x6583399E },
+        { 0, -1, -0x036406B9, -0x036406B9 },
+        { 1,  1,  0x38819D75,  0x38819D75 },
+        { 0, -1,  0x1C626A90,  0x1C626A90 }},
+    0x49931E54, 0x37ABDBF3, 0, 4 },
+};
+
+
+static inline int32_t dwt_mul_q30(
+    const int32_t x,
+    const q2_30 c)
+{
+  const int64_t p = ((int64_t) x) * c + (1 << 29);
+  return SAT(32)(p >> 30);
+}
+
+
+/*
+ * Apply (or undo) the lifting steps and scaling of one level to the n elements of x[] spaced
+ * stride apart. Even-indexed elements are s[] and odd-indexed elements are d[].
+ */
+static void dwt_lift(
+    int32_t x[],
+    const unsigned n,
+    const unsigned stride,
+    const dwt_wavelet_t* wavelet,
+    const unsigned inverse)
+{
+  const unsigned half = n >> 1;
+  const unsigned pitch = 2 * stride;
+
+  if(inverse){
+    for(unsigned i = 0; i < half; i++){
+      x[i * pitch] = dwt_mul_q30(x[i * pitch], wavelet->scale_d);
+      x[i * pitch + stride] = dwt_mul_q30(x[i * pitch + stride], wavelet->scale_s);
+    }
+  }
+
+  for(unsigned k = 0; k < wavelet->step_count; k++){
+    const dwt_lift_step_t* step = &wavelet->step[inverse? (wavelet->step_count - 1 - k) : k];
+    int32_t* y = &x[step->odd? stride : 0];
+    const int32_t* u = &x[step->odd? 0 : stride];
+
+    for(unsigned i = 0; i < half; i++){
+      int j = (int) i + step->offset;
+      // Whole-point symmetric extension maps s[half] to s[half-1] and d[-1] to d[0]
+      if(j < 0)
+        j = wavelet->periodic? (int) half - 1 : 0;
+      else if(j >= (int) half)
+        j = wavelet->periodic? 0 : (int) half - 1;
+
+      const int64_t acc = ((int64_t) u[i * pitch]) * step->c0
+                        + ((int64_t) u[j * pitch]) * step->c1;
+      const int32_t delta = (int32_t) ((acc + (1 << 29)) >> 30);
+      const int64_t res = inverse? ((int64_t) y[i * pitch]) - delta : ((int64_t) y[i * pitch]) + delta;
+      y[i * pitch] = SAT(32)(res);
+    }
+  }
+
+  if(!inverse){
+    for(unsigned i = 0; i < half; i++){
+      x[i * pitch] = dwt_mul_q30(x[i * pitch], wavelet->scale_s);
+      x[i * pitch + stride] = dwt_mul_q30(x[i * pitch + stride], wavelet->scale_d);
+    }
+  }
+}
+
+
+/*
+ * Ensure the n elements of x->data[] spaced stride apart have at least the headroom required by
+ * the wavelet, by shifting the whole vector (which shares a single exponent) down if necessary.
+ */
+static void dwt_ensure_headroom(
+    bfp_s32_t* x,
+    const unsigned n,
+    const unsigned stride,
+    const dwt_wavelet_t* wavelet)
+{
+  const headroom_t band_hr = vect_s32_headroom_strided(x->data, stride, n);
+  if(band_hr < wavelet->headroom){
+    const right_shift_t shr = wavelet->headroom - band_hr;
+    x->hr = vect_s32_shr(x->data, x->data, x->length, shr);
+    x->exp += shr;
+  }
+}
+
+
+void bfp_s32_dwt_forward(
+    bfp_s32_t* x,
+    int32_t scratch[],
+    const dwt_wavelet_e wavelet,
+    const unsigned levels,
+    const dwt_layout_e layout)
+{
+  const unsigned N = x->length;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(wavelet <= DWT_CDF97);
+  assert((N >> levels) > 0);
+  assert(((N >> levels) << levels) == N);
+  assert(layout == DWT_LAYOUT_STRIDED || scratch != NULL);
+#endif
+
+  const dwt_wavelet_t* w = &dwt_wavelets[wavelet];
+
+  // Normalise so that the first level has exactly the headroom it needs. Later levels only shift
+  // the vector down if the approximation band has grown into that headroom.
+  const left_shift_t shl = x->hr - w->headroom;
+  x->hr = vect_s32_shl(x->data, x->data, N, shl);
+  x->exp -= shl;
+
+  for(unsigned level = 0; level < levels; level++){
+    const unsigned n = N >> level;
+
+    if(layout == DWT_LAYOUT_PACKED){
+      // The approximation band is x[0:n]. Afterwards, its s[] are packed into x[0:n/2] and d[] into
+      // x[n/2:n].
+      dwt_ensure_headroom(x, n, 1, w);
+      dwt_lift(x->data, n, 1, w, 0);
+      vect_s32_copy_strided(scratch, 1, &x->data[1], 2, n >> 1);
+      vect_s32_copy_strided(x->data, 1, x->data, 2, n >> 1);
+      memcpy(&x->data[n >> 1], scratch, (n >> 1) * sizeof(int32_t));
+    } else {
+      // The approximation band is every (2^level)th element of x[].
+      dwt_ensure_headroom(x, n, 1 << level, w);
+      dwt_lift(x->data, n, 1 << level, w, 0);
+    }
+  }
+
+  x->hr = vect_s32_headroom(x->data, N);
+}
+
+
+void bfp_s32_dwt_inverse(
+    bfp_s32_t* x,
+    int32_t scratch[],
+    const dwt_wavelet_e wavelet,
+    const unsigned levels,
+    const dwt_layout_e layout)
+{
+  const unsigned N = x->length;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(wavelet <= DWT_CDF97);
+  assert((N >> levels) > 0);
+  assert(((N >> levels) << levels) == N);
+  assert(layout == DWT_LAYOUT_STRIDED || scratch != NULL);
+#endif
+
+  const dwt_wavelet_t* w = &dwt_wavelets[wavelet];
+
+  // As for the forward transform, normalise for the first (coarsest) level
+  const left_shift_t shl = x->hr - w->headroom;
+  x->hr = vect_s32_shl(x->data, x->data, N, shl);
+  x->exp -= shl;
+
+  for(int level = levels - 1; level >= 0; level--){
+    const unsigned n = N >> level;
+
+    if(layout == DWT_LAYOUT_PACKED){
+      // Interleave the approximation band x[0:n/2] and detail band x[n/2:n] before lifting
+      dwt_ensure_headroom(x, n, 1, w);
+      memcpy(scratch, &x->data[n >> 1], (n >> 1) * sizeof(int32_t));
+      for(int i = (n >> 1) - 1; i >= 0; i--)
+        x->data[2 * i] = x->data[i];
+      vect_s32_copy_strided(&x->data[1], 2, scratch, 1, n >> 1);
+      dwt_lift(x->data, n, 1, w, 1);
+    } else {
+      dwt_ensure_headroom(x, n, 1 << level, w);
+      dwt_lift(x->data, n, 1 << level, w, 1);
+    }
+  }
+
+  x->hr = vect_s32_headroom(x->data, N);
+}
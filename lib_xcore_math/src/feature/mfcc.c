@@ -0,0 +1,223 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+#include "xmath_internal.h"
+
+
+// Mel scale, up to a constant factor (which doesn't affect equal spacing)
+static float mel_of_freq(
+    const float freq)
+{
+  return f32_log2(1.0f + freq / 700.0f);
+}
+
+
+/*
+ * Store 64-bit value x as element index of the 32-bit vector data[], where all elements have a
+ * common right-shift *shr from their 64-bit values. If x needs a larger shift than *shr, the
+ * preceding elements are shifted down to match and *shr is updated. Starting from *shr = -31, the
+ * vector ends up with no headroom.
+ */
+static void mel_store_s64(
+    int32_t data[],
+    const unsigned index,
+    const int64_t x,
+    right_shift_t* shr)
+{
+  const right_shift_t x_shr = 32 - HR_S64(x);
+  if(x_shr > *shr){
+    if(index)
+      vect_s32_shr(data, data, index, MIN(x_shr - *shr, 31));
+    *shr = x_shr;
+  }
+  data[index] = (int32_t) ((*shr >= 0)? (x >> *shr) : (x * (((int64_t) 1) << -*shr)));
+}
+
+
+// cos(2*pi*num/den), as a Q2.30
+static inline q2_30 mfcc_cos(
+    const unsigned num,
+    const unsigned den)
+{
+  return xmath_turn_phasor((uint32_t) (((((uint64_t) num) << 32) + den/2) / den)).re;
+}
+
+
+void mel_filterbank_init(
+    mel_filterbank_t* filterbank,
+    int32_t buffer[],
+    const unsigned fft_length,
+    const unsigned band_count,
+    const float sample_rate,
+    const float min_freq,
+    const float max_freq)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(band_count > 0);
+  assert(min_freq >= 0.0f);
+  assert(min_freq < max_freq);
+  assert(max_freq <= sample_rate / 2);
+#endif
+
+  unsigned* band_start = (unsigned*) &buffer[0];
+  unsigned* band_length = (unsigned*) &buffer[band_count];
+  q2_30* weight = (q2_30*) &buffer[2 * band_count];
+
+  const unsigned bins = (fft_length >> 1) + 1;
+  const float bin_width = sample_rate / fft_length;
+  const float mel_min = mel_of_freq(min_freq);
+  const float mel_step = (mel_of_freq(max_freq) - mel_min) / (band_count + 1);
+
+  unsigned first = 0;
+  unsigned w = 0;
+
+  for(unsigned m = 0; m < band_count; m++){
+    const float lower = mel_min + m * mel_step;
+    const float centre = lower + mel_step;
+    const float upper = centre + mel_step;
+
+    // Bins are in increasing order of frequency, so each band starts no lower than the previous
+    while(first < bins && mel_of_freq(first * bin_width) <= lower)
+      first++;
+
+    band_start[m] = first;
+    band_length[m] = 0;
+
+    for(unsigned k = first; k < bins; k++){
+      const float mel = mel_of_freq(k * bin_width);
+      if(mel >= upper)
+        break;
+
+      const float tri = (mel <= centre)? (mel - lower) / mel_step : (upper - mel) / mel_step;
+      weight[w++] = (q2_30) (tri * 0x40000000 + 0.5f);
+      band_length[m]++;
+    }
+  }
+
+  filterbank->fft_length = fft_length;
+  filterbank->band_count = band_count;
+  filterbank->band_start = band_start;
+  filterbank->band_length = band_length;
+  filterbank->weight = weight;
+}
+
+
+void mel_filterbank_energy(
+    const mel_filterbank_t* filterbank,
+    bfp_s32_t* mel,
+    const bfp_complex_s32_t* X)
+{
+  const unsigned M = filterbank->band_count;
+  const unsigned half = filterbank->fft_length >> 1;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(X->length == half);
+#endif
+
+  // With the mantissas of X[] normalised, each bin's squared magnitude fits in 64 bits, of which the
+  // upper word is kept. Each weighted term is then below 2^45, leaving room to sum 2^18 of them.
+  const int64_t X_scale = ((int64_t) 1) << X->hr;
+  const complex_s32_t* data = X->data;
+  const q2_30* weight = filterbank->weight;
+
+  right_shift_t shr = -31;
+
+  for(unsigned m = 0; m < M; m++){
+    const unsigned start = filterbank->band_start[m];
+    const unsigned length = filterbank->band_length[m];
+    int64_t sum = 0;
+
+    for(unsigned i = 0; i < length; i++){
+      const unsigned k = start + i;
+      // The real-valued DC and Nyquist components are packed together in X[0]
+      const int64_t re = ((int64_t) ((k == half)? data[0].im : data[k].re)) * X_scale;
+      const int64_t im = ((k == 0) || (k == half))? 0 : ((int64_t) data[k].im) * X_scale;
+      const uint64_t power = ((uint64_t) (re * re)) + ((uint64_t) (im * im));
+      sum += (((int64_t) weight[i]) * ((int64_t) (power >> 32))) >> 16;
+    }
+    weight += length;
+
+    mel_store_s64(mel->data, m, sum, &shr);
+  }
+
+  mel->length = M;
+  mel->exp = 2 * (X->exp - X->hr) + 18 + shr;
+  mel->hr = vect_s32_headroom(mel->data, M);
+}
+
+
+void mel_filterbank_log_energy(
+    const mel_filterbank_t* filterbank,
+    q8_24 log_mel[],
+    const bfp_complex_s32_t* X)
+{
+  const unsigned M = filterbank->band_count;
+
+  bfp_s32_t mel;
+  bfp_s32_init(&mel, log_mel, 0, M, 0);
+  mel_filterbank_energy(filterbank, &mel, X);
+
+  // The log of zero is undefined
+  for(unsigned m = 0; m < M; m++)
+    log_mel[m] = MAX(log_mel[m], 1);
+
+  vect_s32_log(log_mel, log_mel, mel.exp, M);
+}
+
+
+void mfcc_s32_init(
+    mfcc_s32_t* mfcc,
+    int32_t buffer[],
+    const mel_filterbank_t* filterbank,
+    const unsigned coef_count)
+{
+  const unsigned M = filterbank->band_count;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(coef_count <= M);
+#endif
+
+  q2_30* dct_matrix = &buffer[M];
+
+  // Only the first coef_count of the M DCT-II outputs are needed, so they are computed with a
+  // coef_count x M cosine matrix rather than a full dct_forward().
+  //   cos(pi*i*(2m+1)/(2M)) = cos(2*pi*(i*(2m+1) mod 4M)/(4M))
+  for(unsigned i = 0; i < coef_count; i++)
+    for(unsigned m = 0; m < M; m++)
+      dct_matrix[i * M + m] = mfcc_cos((i * (2*m + 1)) % (4*M), 4*M);
+
+  mfcc->filterbank = filterbank;
+  mfcc->coef_count = coef_count;
+  mfcc->dct_matrix = dct_matrix;
+  mfcc->log_mel = &buffer[0];
+}
+
+
+void mfcc_s32(
+    mfcc_s32_t* mfcc,
+    bfp_s32_t* coef,
+    const bfp_complex_s32_t* X)
+{
+  const unsigned M = mfcc->filterbank->band_count;
+  const unsigned C = mfcc->coef_count;
+
+  mel_filterbank_log_energy(mfcc->filterbank, mfcc->log_mel, X);
+
+  // Each inner product is Q8.24 (the products are shifted down 30 bits). With up to 256 bands the
+  // 40-bit accumulators cannot saturate.
+  right_shift_t shr = -31;
+  for(unsigned i = 0; i < C; i++){
+    const int64_t acc = vect_s32_dot(mfcc->log_mel, &mfcc->dct_matrix[i * M], M, 0, 0);
+    mel_store_s64(coef->data, i, acc, &shr);
+  }
+
+  coef->length = C;
+  coef->exp = -24 + shr;
+  coef->hr = vect_s32_headroom(coef->data, C);
+}
@@ -0,0 +1,69 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+
+
+// Rounding (signed) right-shift of a mantissa
+static int32_t analytic_shr(
+    const int32_t x,
+    const right_shift_t shr)
+{
+  if(shr <= 0) return (int32_t) (((int64_t) x) << -shr);
+  if(shr >= 32) return 0;
+  return (int32_t) ((((int64_t) x) + (((int64_t) 1) << (shr - 1))) >> shr);
+}
+
+
+void bfp_fft_analytic_mono(
+    bfp_complex_s32_t* z,
+    bfp_s32_t* x)
+{
+  const unsigned N = x->length;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(N >= 4);
+  assert((N & (N - 1)) == 0);
+#endif
+
+  // The input is kept in the second half of the output buffer. Interleaving the output in
+  // ascending order only ever overwrites input samples which have already been consumed.
+  int32_t* x_copy = (int32_t*) &z->data[N / 2];
+  vect_s32_copy(x_copy, x->data, N);
+  const exponent_t x_exp = x->exp;
+  const headroom_t x_hr = x->hr;
+
+  bfp_complex_s32_t* X = bfp_fft_forward_mono(x);
+
+  // Multiply by -j, i.e. (re, im) -> (im, -re). The DC and Nyquist bins (packed into bin 0) are
+  // real, and the Hilbert transform removes them.
+  X->data[0].re = 0;
+  X->data[0].im = 0;
+  for(unsigned f = 1; f < N / 2; f++){
+    const int32_t re = X->data[f].re;
+    X->data[f].re = X->data[f].im;
+    X->data[f].im = (re == INT32_MIN)? INT32_MAX : -re;
+  }
+  X->hr = vect_complex_s32_headroom(X->data, N / 2);
+
+  bfp_s32_t* h = bfp_fft_inverse_mono(X);
+
+  // Real and imaginary parts are brought to a common exponent
+  const exponent_t exp = MAX(x_exp - (exponent_t) x_hr, h->exp - (exponent_t) h->hr);
+  const right_shift_t x_shr = exp - x_exp;
+  const right_shift_t h_shr = exp - h->exp;
+
+  for(unsigned n = 0; n < N; n++){
+    const int32_t re = analytic_shr(x_copy[n], x_shr);
+    z->data[n].im = analytic_shr(h->data[n], h_shr);
+    z->data[n].re = re;
+  }
+
+  z->length = N;
+  z->exp = exp;
+  z->hr = vect_complex_s32_headroom(z->data, N);
+}
@@ -0,0 +1,162 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+#include "xmath_internal.h"
+
+
+// Frequency in cycles per sample, as a UQ0.32 fraction of a turn (modulo one turn)
+static uint32_t czt_turns(
+    const float freq)
+{
+  // Scaling by 2^32 is exact, and any whole turns are discarded by the conversion
+  return (uint32_t) ((int64_t) (freq * 4294967296.0f));
+}
+
+
+/*
+ * Phase, in turns, of the chirp exp(-j*pi*step*n^2) (times exp(-j*2*pi*start*n)). The products are
+ * computed modulo 2^33 (i.e. in half-turn units) so that they are exact however large n is.
+ */
+static uint32_t czt_chirp_phase(
+    const uint32_t start,
+    const uint32_t step,
+    const unsigned n)
+{
+  const uint64_t nn = ((uint64_t) n) * n;
+  const uint64_t p = 2 * ((uint64_t) start) * n + ((uint64_t) step) * nn;
+  return (uint32_t) ((p + 1) >> 1);
+}
+
+
+void czt_s32_init(
+    czt_s32_t* czt,
+    int32_t buffer[],
+    const unsigned fft_length,
+    const unsigned input_length,
+    const unsigned bin_count,
+    const float f_start,
+    const float f_step)
+{
+  const unsigned L = fft_length;
+  const unsigned N = input_length;
+  const unsigned M = bin_count;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(N > 0 && M > 0);
+  assert((L & (L - 1)) == 0);
+  assert(L >= N + M - 1);
+  assert(L <= (1 << MAX_DIT_FFT_LOG2));
+#endif
+
+  complex_s32_t* spectrum = (complex_s32_t*) &buffer[0];
+
+  czt->input_length = N;
+  czt->bin_count = M;
+  czt->scratch = (complex_s32_t*) &buffer[2 * L];
+  czt->pre_chirp = (complex_s32_t*) &buffer[4 * L];
+  czt->post_chirp = (complex_s32_t*) &buffer[4 * L + 2 * N];
+
+  const uint32_t start = czt_turns(f_start);
+  const uint32_t step = czt_turns(f_step);
+
+  for(unsigned n = 0; n < N; n++)
+    czt->pre_chirp[n] = xmath_turn_phasor(czt_chirp_phase(start, step, n));
+
+  for(unsigned k = 0; k < M; k++)
+    czt->post_chirp[k] = xmath_turn_phasor(czt_chirp_phase(0, step, k));
+
+  // The convolution chirp exp(+j*pi*step*m^2) for -(N-1) <= m <= M-1, wrapped around L elements.
+  // It is even in m, so it is the conjugate of the post-multiplication chirp.
+  vect_s32_set((int32_t*) spectrum, 0, 2 * L);
+  for(unsigned m = 0; m < M || m < N; m++){
+    complex_s32_t v = (m < M)? czt->post_chirp[m]
+                             : xmath_turn_phasor(czt_chirp_phase(0, step, m));
+    v.im = -v.im;
+    if(m < M)
+      spectrum[m] = v;
+    if(m > 0 && m < N)
+      spectrum[L - m] = v;
+  }
+
+  bfp_complex_s32_init(&czt->chirp_spectrum, spectrum, -30, L, 1);
+  bfp_fft_forward_complex(&czt->chirp_spectrum);
+}
+
+
+// Circular convolution with the chirp, followed by the post-multiplication
+static void czt_convolve(
+    const czt_s32_t* czt,
+    bfp_complex_s32_t* X,
+    bfp_complex_s32_t* work)
+{
+  const unsigned L = czt->chirp_spectrum.length;
+  const unsigned N = czt->input_length;
+  const unsigned M = czt->bin_count;
+
+  vect_s32_set((int32_t*) &work->data[N], 0, 2 * (L - N));
+  work->length = L;
+
+  bfp_fft_forward_complex(work);
+  bfp_complex_s32_mul(work, work, &czt->chirp_spectrum);
+  bfp_fft_inverse_complex(work);
+
+  // Only the first M outputs of the convolution are needed
+  work->length = M;
+  work->hr = vect_complex_s32_headroom(work->data, M);
+
+  // The chirps have magnitude 1, i.e. 0x40000000 with an exponent of -30
+  bfp_complex_s32_t post;
+  bfp_complex_s32_init(&post, czt->post_chirp, -30, M, 0);
+  X->length = M;
+  bfp_complex_s32_mul(X, work, &post);
+}
+
+
+void czt_s32_complex(
+    const czt_s32_t* czt,
+    bfp_complex_s32_t* X,
+    const bfp_complex_s32_t* x)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(x->length == czt->input_length);
+#endif
+
+  const unsigned N = czt->input_length;
+
+  bfp_complex_s32_t pre;
+  bfp_complex_s32_init(&pre, czt->pre_chirp, -30, N, 0);
+
+  bfp_complex_s32_t work;
+  bfp_complex_s32_init(&work, czt->scratch, 0, N, 0);
+  bfp_complex_s32_mul(&work, x, &pre);
+
+  czt_convolve(czt, X, &work);
+}
+
+
+void czt_s32_mono(
+    const czt_s32_t* czt,
+    bfp_complex_s32_t* X,
+    const bfp_s32_t* x)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(x->length == czt->input_length);
+#endif
+
+  const unsigned N = czt->input_length;
+
+  bfp_complex_s32_t pre;
+  bfp_complex_s32_init(&pre, czt->pre_chirp, -30, N, 0);
+
+  bfp_complex_s32_t work;
+  bfp_complex_s32_init(&work, czt->scratch, 0, N, 0);
+  bfp_complex_s32_real_mul(&work, &pre, x);
+
+  czt_convolve(czt, X, &work);
+}
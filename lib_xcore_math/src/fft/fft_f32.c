@@ -5,20 +5,243 @@
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
+#include <assert.h>
 
 #include "xmath/xmath.h"
+#include "xmath_fft_lut.h"
 
 
+// Twiddle factors are taken from the (Q2.30) DIT look-up table, whose final pass holds
+// W_{2^MAX_DIT_FFT_LOG2}^q for 0 <= q < 2^(MAX_DIT_FFT_LOG2-1), in blocks of 4 stored in
+// descending order.
+static inline complex_float_t fft_f32_twiddle(
+    const unsigned q)
+{
+  const complex_s32_t w = xmath_dit_fft_lut[(1 << MAX_DIT_FFT_LOG2) - 8 - (q & ~3u) + (q & 3u)];
+  const complex_float_t res = { w.re * 0x1p-30f, w.im * 0x1p-30f };
+  return res;
+}
+
+
+static inline complex_float_t cmul_f32(
+    const complex_float_t b,
+    const complex_float_t c)
+{
+  const complex_float_t res = {
+    b.re * c.re - b.im * c.im,
+    b.re * c.im + b.im * c.re };
+  return res;
+}
+
+
+/*
+ * In-place radix-4 decimation-in-time FFT on a bit-reversed complex float vector. Each radix-4
+ * pass is two fused radix-2 passes (radix-2^2), which needs 3 complex multiplies per butterfly
+ * and one trip through memory instead of two. If log2(N) is odd a single radix-2 pass is done
+ * first. The first pass needs no twiddle factors, and is where the inverse transform's 1/N
+ * scaling is applied.
+ */
+static void fft_f32_dit(
+    complex_float_t x[],
+    const unsigned N,
+    const unsigned inverse)
+{
+  const unsigned log2_N = u32_ceil_log2(N);
+  const float scale = inverse? ldexpf(1.0f, -(int)log2_N) : 1.0f;
+  // Multiplying by -j (forward) or +j (inverse) is a swap and a negation
+  const float rot = inverse? 1.0f : -1.0f;
+
+  unsigned L;
+
+  if(N == 1){
+    x[0].re *= scale;
+    x[0].im *= scale;
+    return;
+  } else if(log2_N & 1){
+    for(unsigned s = 0; s < N; s += 2){
+      const complex_float_t x0 = x[s], x1 = x[s+1];
+      x[s  ].re = (x0.re + x1.re) * scale;
+      x[s  ].im = (x0.im + x1.im) * scale;
+      x[s+1].re = (x0.re - x1.re) * scale;
+      x[s+1].im = (x0.im - x1.im) * scale;
+    }
+    L = 2;
+  } else {
+    for(unsigned s = 0; s < N; s += 4){
+      const complex_float_t x0 = x[s], x1 = x[s+1], x2 = x[s+2], x3 = x[s+3];
+      const complex_float_t b0 = { x0.re + x1.re, x0.im + x1.im };
+      const complex_float_t b1 = { x0.re - x1.re, x0.im - x1.im };
+      const complex_float_t b2 = { x2.re + x3.re, x2.im + x3.im };
+      const complex_float_t b3 = { -rot * (x2.im - x3.im), rot * (x2.re - x3.re) };
+      x[s  ].re = (b0.re + b2.re) * scale;
+      x[s  ].im = (b0.im + b2.im) * scale;
+      x[s+1].re = (b1.re + b3.re) * scale;
+      x[s+1].im = (b1.im + b3.im) * scale;
+      x[s+2].re = (b0.re - b2.re) * scale;
+      x[s+2].im = (b0.im - b2.im) * scale;
+      x[s+3].re = (b1.re - b3.re) * scale;
+      x[s+3].im = (b1.im - b3.im) * scale;
+    }
+    L = 4;
+  }
+
+  for(; L < N; L *= 4){
+    const unsigned stride = (1 << MAX_DIT_FFT_LOG2) / (4*L);
+
+    for(unsigned k = 0; k < L; k++){
+      // w1 = W_{4L}^k,  w2 = W_{4L}^{2k} = W_{2L}^k
+      complex_float_t w1 = fft_f32_twiddle(k * stride);
+      complex_float_t w2 = fft_f32_twiddle(2 * k * stride);
+      if(inverse){
+        w1.im = -w1.im;
+        w2.im = -w2.im;
+      }
+
+      for(unsigned s = k; s < N; s += 4*L){
+        const complex_float_t x0 = x[s], x2 = x[s+2*L];
+        const complex_float_t t1 = cmul_f32(x[s+L], w2);
+        const complex_float_t t3 = cmul_f32(x[s+3*L], w2);
+
+        const complex_float_t b0 = { x0.re + t1.re, x0.im + t1.im };
+        const complex_float_t b1 = { x0.re - t1.re, x0.im - t1.im };
+        const complex_float_t b2 = { x2.re + t3.re, x2.im + t3.im };
+        const complex_float_t b3 = { x2.re - t3.re, x2.im - t3.im };
+
+        const complex_float_t u2 = cmul_f32(b2, w1);
+        const complex_float_t v3 = cmul_f32(b3, w1);
+        const complex_float_t u3 = { -rot * v3.im, rot * v3.re };
+
+        x[s    ].re = b0.re + u2.re;
+        x[s    ].im = b0.im + u2.im;
+        x[s+2*L].re = b0.re - u2.re;
+        x[s+2*L].im = b0.im - u2.im;
+        x[s+  L].re = b1.re + u3.re;
+        x[s+  L].im = b1.im + u3.im;
+        x[s+3*L].re = b1.re - u3.re;
+        x[s+3*L].im = b1.im - u3.im;
+      }
+    }
+  }
+}
+
+
+void fft_f32_forward_complex(
+    complex_float_t x[],
+    const unsigned fft_length)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(fft_length != 0 && (fft_length & (fft_length - 1)) == 0);
+  assert(fft_length <= (1 << MAX_DIT_FFT_LOG2));
+#endif
+
+  fft_index_bit_reversal((complex_s32_t*) x, fft_length);
+  fft_f32_dit(x, fft_length, 0);
+}
+
+
+void fft_f32_inverse_complex(
+    complex_float_t x[],
+    const unsigned fft_length)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(fft_length != 0 && (fft_length & (fft_length - 1)) == 0);
+  assert(fft_length <= (1 << MAX_DIT_FFT_LOG2));
+#endif
+
+  fft_index_bit_reversal((complex_s32_t*) x, fft_length);
+  fft_f32_dit(x, fft_length, 1);
+}
+
+
+#if (XMATH_FFT_F32_NATIVE)
+
+/*
+ * Turn the K-point spectrum Z[] of z[n] = x[2n] + j*x[2n+1] into the first K bins of the N=2K
+ * point spectrum of x[], with the (real) Nyquist bin packed into X[0].im.
+ */
+static void fft_f32_mono_adjust_forward(
+    complex_float_t X[],
+    const unsigned fft_length)
+{
+  const unsigned K = fft_length / 2;
+  const unsigned stride = (1 << MAX_DIT_FFT_LOG2) / fft_length;
+
+  const complex_float_t Z0 = X[0];
+  X[0].re = Z0.re + Z0.im;
+  X[0].im = Z0.re - Z0.im;
+
+  for(unsigned k = 1; k <= K/2; k++){
+    const complex_float_t Zk = X[k], Zm = X[K-k];
+
+    // E = (Z[k] + conj(Z[K-k])) / 2;   O = -j * (Z[k] - conj(Z[K-k])) / 2
+    const complex_float_t E = { 0.5f * (Zk.re + Zm.re), 0.5f * (Zk.im - Zm.im) };
+    const complex_float_t O = { 0.5f * (Zk.im + Zm.im), 0.5f * (Zm.re - Zk.re) };
+    const complex_float_t P = cmul_f32(O, fft_f32_twiddle(k * stride));
+
+    // X[k] = E + W^k O;   X[K-k] = conj(E - W^k O)
+    X[k].re   =  E.re + P.re;
+    X[k].im   =  E.im + P.im;
+    X[K-k].re =  E.re - P.re;
+    X[K-k].im = -E.im + P.im;
+  }
+}
+
+
+// Inverse of fft_f32_mono_adjust_forward().
+static void fft_f32_mono_adjust_inverse(
+    complex_float_t X[],
+    const unsigned fft_length)
+{
+  const unsigned K = fft_length / 2;
+  const unsigned stride = (1 << MAX_DIT_FFT_LOG2) / fft_length;
+
+  const complex_float_t X0 = X[0];
+  X[0].re = 0.5f * (X0.re + X0.im);
+  X[0].im = 0.5f * (X0.re - X0.im);
+
+  for(unsigned k = 1; k <= K/2; k++){
+    const complex_float_t Xk = X[k], Xm = X[K-k];
+
+    // E = (X[k] + conj(X[K-k])) / 2;   O = W^-k * (X[k] - conj(X[K-k])) / 2
+    const complex_float_t E = { 0.5f * (Xk.re + Xm.re), 0.5f * (Xk.im - Xm.im) };
+    const complex_float_t D = { 0.5f * (Xk.re - Xm.re), 0.5f * (Xk.im + Xm.im) };
+    complex_float_t W = fft_f32_twiddle(k * stride);
+    W.im = -W.im;
+    const complex_float_t O = cmul_f32(D, W);
+
+    // Z[k] = E + jO;   Z[K-k] = conj(E - jO)
+    X[k].re   =  E.re - O.im;
+    X[k].im   =  E.im + O.re;
+    X[K-k].re =  E.re + O.im;
+    X[K-k].im = -E.im + O.re;
+  }
+}
+
+#endif // XMATH_FFT_F32_NATIVE
+
 
 complex_float_t* fft_f32_forward(
     float x[],
     const unsigned fft_length)
 {
-  int32_t* x_s32 = (int32_t*) &x[0];
   complex_float_t* X = (complex_float_t*) &x[0];
 
-  exponent_t exp = vect_f32_max_exponent(x, fft_length) + 2;
-  vect_f32_to_vect_s32(x_s32, x, fft_length, exp);
+#if (XMATH_FFT_F32_NATIVE)
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(fft_length >= 2 && (fft_length & (fft_length - 1)) == 0);
+  assert(fft_length <= (1 << MAX_DIT_FFT_LOG2));
+#endif
+
+  fft_index_bit_reversal((complex_s32_t*) X, fft_length/2);
+  fft_f32_dit(X, fft_length/2, 0);
+  fft_f32_mono_adjust_forward(X, fft_length);
+
+#else
+
+  int32_t* x_s32 = (int32_t*) &x[0];
+
+  exponent_t exp = vect_f32_to_vect_s32_auto_exp(x_s32, x, fft_length, 2);
 
   // Now call the three functions to do an FFT
   fft_index_bit_reversal((complex_s32_t*) x_s32, fft_length/2);
@@ -29,6 +252,8 @@ complex_float_t* fft_f32_forward(
   // And unpack back to floating point values
   vect_s32_to_vect_f32(x, x_s32, fft_length, exp);
 
+#endif // XMATH_FFT_F32_NATIVE
+
   return X;
 }
 
@@ -37,11 +262,24 @@ float* fft_f32_inverse(
     complex_float_t X[],
     const unsigned fft_length)
 {
-  int32_t* x_s32 = (int32_t*) &X[0];
   float* x = (float*) &X[0];
-  
-  exponent_t exp = vect_f32_max_exponent(x, fft_length) + 2;
-  vect_f32_to_vect_s32(x_s32, x, fft_length, exp);
+
+#if (XMATH_FFT_F32_NATIVE)
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(fft_length >= 2 && (fft_length & (fft_length - 1)) == 0);
+  assert(fft_length <= (1 << MAX_DIT_FFT_LOG2));
+#endif
+
+  fft_f32_mono_adjust_inverse(X, fft_length);
+  fft_index_bit_reversal((complex_s32_t*) X, fft_length/2);
+  fft_f32_dit(X, fft_length/2, 1);
+
+#else
+
+  int32_t* x_s32 = (int32_t*) &X[0];
+
+  exponent_t exp = vect_f32_to_vect_s32_auto_exp(x_s32, x, fft_length, 2);
 
   fft_mono_adjust((complex_s32_t*) x_s32, fft_length, 1);
   fft_index_bit_reversal((complex_s32_t*) x_s32, fft_length/2);
@@ -50,5 +288,7 @@ float* fft_f32_inverse(
 
   vect_s32_to_vect_f32(x, x_s32, fft_length, exp);
 
+#endif // XMATH_FFT_F32_NATIVE
+
   return x;
 }
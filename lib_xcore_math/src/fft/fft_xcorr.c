@@ -0,0 +1,156 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+
+
+extern const unsigned rot_table32_rows;
+extern const complex_s32_t rot_table32[30][4];
+
+
+// Product of two real mantissas, shifted as vect_complex_s32_conj_mul() shifts its operands
+static int32_t xcorr_real_mul(
+    const int32_t b,
+    const int32_t c,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+  const int64_t bb = (b_shr >= 0)? (((int64_t) b) >> b_shr) : (((int64_t) b) << -b_shr);
+  const int64_t cc = (c_shr >= 0)? (((int64_t) c) >> c_shr) : (((int64_t) c) << -c_shr);
+  return (int32_t) ((bb * cc + (1 << 29)) >> 30);
+}
+
+
+// Sign of the product of b and c, as a value with magnitude 2^29 (or 0)
+static int32_t xcorr_phase(
+    const int32_t b,
+    const int32_t c)
+{
+  if(b == 0 || c == 0) return 0;
+  return ((b < 0) == (c < 0))? 0x20000000 : -0x20000000;
+}
+
+
+/*
+ * Divides each element of the cross-spectrum by its magnitude, leaving 2^29 * e^(j*theta). Each
+ * element is first normalized by its own headroom, so the magnitudes all lie within a factor of 2
+ * of one another and the block-exponent reciprocal loses no precision on any of them.
+ */
+static headroom_t xcorr_phat(
+    complex_s32_t C[],
+    int32_t mag[],
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++){
+    const right_shift_t shr = 1 - HR_C32(C[k]);
+    C[k].re = (shr > 0)? (C[k].re >> shr) : (C[k].re << -shr);
+    C[k].im = (shr > 0)? (C[k].im >> shr) : (C[k].im << -shr);
+  }
+
+  // |C[k]| is now in [2^29, 2^30.5), except for bins that are exactly zero. Clipping those avoids
+  // a division by zero, and they remain zero after the product.
+  vect_complex_s32_mag(mag, C, length, 0, (complex_s32_t*) rot_table32, rot_table32_rows);
+  vect_s32_clip(mag, mag, length, 0x20000000, INT32_MAX, 0);
+  vect_s32_inverse(mag, mag, length, 59);
+
+  return vect_complex_s32_real_mul(C, C, mag, length, 0, 0);
+}
+
+
+void bfp_fft_xcorr(
+    bfp_s32_t* r,
+    int32_t buffer[],
+    const bfp_complex_s32_t* X,
+    const bfp_complex_s32_t* Y,
+    const xcorr_weighting_e weighting)
+{
+  const unsigned K = X->length;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(X->length == Y->length);
+  assert(K >= 2);
+#endif
+
+  // The cross-spectrum is built in place of the result, and the inverse FFT recasts it
+  bfp_complex_s32_t* C = (bfp_complex_s32_t*) r;
+  bfp_complex_s32_init(C, (complex_s32_t*) &buffer[0], 0, K, 0);
+
+  exponent_t C_exp;
+  right_shift_t X_shr, Y_shr;
+  vect_complex_s32_conj_mul_prepare(&C_exp, &X_shr, &Y_shr, X->exp, Y->exp, X->hr, Y->hr);
+
+  // Bin 0 packs the (real) DC and Nyquist bins, so it is handled separately
+  headroom_t hr = vect_complex_s32_conj_mul(&C->data[1], &X->data[1], &Y->data[1], K - 1,
+                                            X_shr, Y_shr);
+
+  if(weighting == XCORR_WEIGHT_PHAT){
+    C->data[0].re = xcorr_phase(X->data[0].re, Y->data[0].re);
+    C->data[0].im = xcorr_phase(X->data[0].im, Y->data[0].im);
+    hr = xcorr_phat(&C->data[1], &buffer[2 * K], K - 1);
+    C_exp = -29;
+  } else {
+    C->data[0].re = xcorr_real_mul(X->data[0].re, Y->data[0].re, X_shr, Y_shr);
+    C->data[0].im = xcorr_real_mul(X->data[0].im, Y->data[0].im, X_shr, Y_shr);
+  }
+
+  C->exp = C_exp;
+  C->hr = MIN(hr, HR_C32(C->data[0]));
+
+  bfp_fft_inverse_mono(C);
+}
+
+
+xcorr_peak_t bfp_s32_xcorr_peak(
+    const bfp_s32_t* r,
+    const unsigned max_lag)
+{
+  const unsigned N = r->length;
+  const int32_t* x = r->data;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(max_lag < N / 2);
+#endif
+
+  // Non-negative lags are at the start of r, and negative lags at the end
+  unsigned peak = vect_s32_argmax(x, max_lag + 1);
+  if(max_lag > 0){
+    const unsigned k = N - max_lag + vect_s32_argmax(&x[N - max_lag], max_lag);
+    if(x[k] > x[peak])
+      peak = k;
+  }
+
+  // Parabola through the peak and its (circular) neighbours
+  const int64_t y0 = x[(peak == 0)? N - 1 : peak - 1];
+  const int64_t y1 = x[peak];
+  const int64_t y2 = x[(peak == N - 1)? 0 : peak + 1];
+  const int64_t curve = y0 - 2 * y1 + y2;
+
+  const float offset = (curve < 0)? (0.5f * (float) (y0 - y2) / (float) curve) : 0.0f;
+
+  xcorr_peak_t res;
+  res.lag = ((peak > max_lag)? ((float) peak - (float) N) : (float) peak) + offset;
+  res.value.mant = x[peak];
+  res.value.exp = r->exp;
+  return res;
+}
+
+
+void bfp_fft_xcorr_pairs(
+    xcorr_peak_t peaks[],
+    int32_t buffer[],
+    const bfp_complex_s32_t spectra[],
+    const unsigned pairs[][2],
+    const unsigned pair_count,
+    const xcorr_weighting_e weighting,
+    const unsigned max_lag)
+{
+  for(unsigned p = 0; p < pair_count; p++){
+    bfp_s32_t r;
+    bfp_fft_xcorr(&r, buffer, &spectra[pairs[p][0]], &spectra[pairs[p][1]], weighting);
+    peaks[p] = bfp_s32_xcorr_peak(&r, max_lag);
+  }
+}
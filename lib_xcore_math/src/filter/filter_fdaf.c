@@ -0,0 +1,209 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+
+
+/*
+ * Exponent given to vectors which start out all zero (weights, power estimate and reference
+ * history). It is low enough that when such a vector is combined with real data the data determines
+ * the output exponent, so the first frames are processed without losing precision.
+ */
+#define FDAF_EMPTY_EXP    (-1024)
+
+
+void filter_fdaf_s32_init(
+    filter_fdaf_s32_t* filter,
+    bfp_complex_s32_t X[],
+    bfp_complex_s32_t W[],
+    int32_t buffer[],
+    const unsigned frame_advance,
+    const unsigned partitions,
+    const float_s32_t mu,
+    const float_s32_t delta,
+    const uq2_30 alpha,
+    const filter_fdaf_constraint_e constraint)
+{
+  assert(partitions != 0);
+  assert(frame_advance != 0);
+  assert((frame_advance & (frame_advance - 1)) == 0);
+  assert(alpha <= 0x40000000);
+
+  const unsigned bins = frame_advance + 1;
+
+  filter->frame_advance = frame_advance;
+  filter->partitions = partitions;
+  filter->head = 0;
+  filter->frame_count = 0;
+  filter->constraint = constraint;
+  filter->mu = mu;
+  filter->delta = delta;
+  filter->alpha = alpha;
+  filter->X = X;
+  filter->W = W;
+
+  vect_s32_set(buffer, 0, FILTER_FDAF_S32_BUFFER_WORDS(frame_advance, partitions));
+
+  complex_s32_t* X_data = (complex_s32_t*) &buffer[0];
+  complex_s32_t* W_data = &X_data[partitions * bins];
+
+  for(unsigned p = 0; p < partitions; p++){
+    bfp_complex_s32_init(&X[p], &X_data[p * bins], FDAF_EMPTY_EXP, bins, 1);
+    bfp_complex_s32_init(&W[p], &W_data[p * bins], FDAF_EMPTY_EXP, bins, 1);
+  }
+
+  filter->scratch = (int32_t*) &W_data[partitions * bins];
+  int32_t* power_data = &filter->scratch[4 * bins];
+  int32_t* x_prev_data = &power_data[bins];
+
+  bfp_s32_init(&filter->power, power_data, FDAF_EMPTY_EXP, bins, 1);
+  bfp_s32_init(&filter->x_prev, x_prev_data, FDAF_EMPTY_EXP, frame_advance, 1);
+}
+
+
+/*
+ * Place [b, c] into a, using a common exponent which leaves no headroom.
+ */
+static void fdaf_concat(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c)
+{
+  const unsigned len = b->length;
+  const exponent_t b_min = b->exp - b->hr;
+  const exponent_t c_min = c->exp - c->hr;
+  const exponent_t a_exp = MAX(b_min, c_min);
+
+  const headroom_t b_hr = vect_s32_shl(&a->data[0], b->data, len, b->exp - a_exp);
+  const headroom_t c_hr = vect_s32_shl(&a->data[len], c->data, len, c->exp - a_exp);
+
+  a->exp = a_exp;
+  a->hr = MIN(b_hr, c_hr);
+  a->length = 2 * len;
+}
+
+
+void filter_fdaf_s32(
+    filter_fdaf_s32_t* filter,
+    bfp_s32_t* e,
+    const bfp_s32_t* d,
+    const bfp_s32_t* x,
+    const unsigned adapt)
+{
+  const unsigned F = filter->frame_advance;
+  const unsigned P = filter->partitions;
+  const unsigned bins = F + 1;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(x->length == F);
+  assert(d->length == F);
+  assert(e->length == F);
+#endif
+
+  // Scratch holds two complex vectors of `bins` elements. The first is also large enough to hold
+  // an unpacked mono FFT of length 2*F.
+  complex_s32_t* scratch0 = (complex_s32_t*) &filter->scratch[0];
+  complex_s32_t* scratch1 = (complex_s32_t*) &filter->scratch[2 * bins];
+
+  // Rotate the reference history; X[head] becomes the newest spectrum.
+  filter->head = (filter->head == 0)? P - 1 : filter->head - 1;
+  bfp_complex_s32_t* X_new = &filter->X[filter->head];
+
+  // X_0 = FFT{ [x_prev, x] }
+  {
+    bfp_s32_t frame;
+    frame.data = (int32_t*) X_new->data;
+    frame.flags = 0;
+    fdaf_concat(&frame, &filter->x_prev, x);
+
+    bfp_complex_s32_t* spec = bfp_fft_forward_mono(&frame);
+    bfp_fft_unpack_mono(spec);
+    X_new->exp = spec->exp;
+    X_new->hr = spec->hr;
+    X_new->length = spec->length;
+
+    vect_s32_copy(filter->x_prev.data, x->data, F);
+    filter->x_prev.exp = x->exp;
+    filter->x_prev.hr = x->hr;
+  }
+
+  // Y = sum_p X_p * W_p
+  bfp_complex_s32_t Y;
+  bfp_complex_s32_init(&Y, scratch0, 0, bins, 0);
+
+  for(unsigned p = 0; p < P; p++){
+    const bfp_complex_s32_t* X_p = &filter->X[(filter->head + p) % P];
+    if(p == 0)  bfp_complex_s32_mul(&Y, X_p, &filter->W[p]);
+    else        bfp_complex_s32_macc(&Y, X_p, &filter->W[p]);
+  }
+
+  // e = d - IFFT{Y}[F:2F]
+  {
+    bfp_fft_pack_mono(&Y);
+    bfp_s32_t* y = bfp_fft_inverse_mono(&Y);
+    bfp_s32_t y_tail;
+    bfp_s32_slice(&y_tail, y, F, F);
+    bfp_s32_sub(e, d, &y_tail);
+  }
+
+  if(!adapt)
+    return;
+
+  // S = alpha * S + (1 - alpha) * |X_0|^2
+  bfp_s32_t tmp;
+  bfp_s32_init(&tmp, (int32_t*) scratch1, 0, bins, 0);
+  {
+    const float_s32_t alpha = { (int32_t) filter->alpha, -30 };
+    const float_s32_t beta = { (int32_t) (0x40000000 - filter->alpha), -30 };
+    bfp_complex_s32_squared_mag(&tmp, X_new);
+    bfp_s32_scale(&tmp, &tmp, beta);
+    bfp_s32_scale(&filter->power, &filter->power, alpha);
+    bfp_s32_add(&filter->power, &filter->power, &tmp);
+  }
+
+  // G = (mu / (S + delta)) * FFT{ [0, e] }
+  bfp_complex_s32_t G;
+  {
+    bfp_s32_t frame;
+    bfp_s32_init(&frame, (int32_t*) scratch0, e->exp, 2 * F, 0);
+    vect_s32_set(&frame.data[0], 0, F);
+    vect_s32_copy(&frame.data[F], e->data, F);
+    frame.hr = e->hr;
+
+    bfp_complex_s32_t* spec = bfp_fft_forward_mono(&frame);
+    bfp_fft_unpack_mono(spec);
+    G = *spec;
+
+    bfp_s32_add_scalar(&tmp, &filter->power, filter->delta);
+    bfp_s32_inverse(&tmp, &tmp);
+    bfp_s32_scale(&tmp, &tmp, filter->mu);
+    bfp_complex_s32_real_mul(&G, &G, &tmp);
+  }
+
+  // W_p += C{ G * conj(X_p) }
+  const unsigned constrained = filter->frame_count % P;
+
+  for(unsigned p = 0; p < P; p++){
+    const bfp_complex_s32_t* X_p = &filter->X[(filter->head + p) % P];
+    bfp_complex_s32_t* W_p = &filter->W[p];
+
+    if(filter->constraint == FDAF_CONSTRAIN_ALTERNATING && p != constrained){
+      bfp_complex_s32_conj_macc(W_p, &G, X_p);
+    } else {
+      bfp_complex_s32_t grad;
+      bfp_complex_s32_init(&grad, scratch1, 0, bins, 0);
+      bfp_complex_s32_conj_mul(&grad, &G, X_p);
+      bfp_fft_pack_mono(&grad);
+      bfp_complex_s32_gradient_constraint_mono(&grad, F);
+      bfp_fft_unpack_mono(&grad);
+      bfp_complex_s32_add(W_p, W_p, &grad);
+    }
+  }
+
+  filter->frame_count++;
+}
@@ -0,0 +1,216 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+#include "xmath_internal.h"
+
+
+static inline int32_t round_shr32(
+    const int32_t x,
+    const right_shift_t shr)
+{
+  if(shr <= 0) return x;
+  return (int32_t) ((((int64_t) x) + (((int64_t) 1) << (shr - 1))) >> shr);
+}
+
+
+static inline int32_t round_mul_q30(
+    const int32_t x,
+    const q2_30 c)
+{
+  return (int32_t) ((((int64_t) x) * c + (1 << 29)) >> 30);
+}
+
+
+// cos(2*pi*bin/N) and sin(2*pi*bin/N) as Q2.30 values, for 0 < bin < N/2
+static void bin_cos_sin(
+    q2_30* c,
+    q2_30* s,
+    const unsigned bin,
+    const unsigned N)
+{
+  // The phasor is exp(-j*2*pi*bin/N)
+  const complex_s32_t w = xmath_turn_phasor((uint32_t) (((((uint64_t) bin) << 32) + N/2) / N));
+  *c = w.re;
+  *s = -w.im;
+}
+
+
+static void goertzel_reset(
+    filter_goertzel_s32_t* filter)
+{
+  filter->count = 0;
+  vect_s32_set(filter->s1, 0, filter->bin_count);
+  vect_s32_set(filter->s2, 0, filter->bin_count);
+}
+
+
+// Advance all of the recurrences by one sample
+static void goertzel_add_sample(
+    filter_goertzel_s32_t* filter,
+    const int32_t new_sample)
+{
+  const unsigned K = filter->bin_count;
+  int32_t* s0 = filter->s0;
+
+  // s0 = 2*cos(w)*s1 - s2 + x
+  vect_s32_mul(s0, filter->coef, filter->s1, K, 0, 0);
+  vect_s32_sub(s0, s0, filter->s2, K, 0, 0);
+  vect_s32_add_scalar(s0, s0, round_shr32(new_sample, filter->input_shr), K, 0);
+
+  filter->s0 = filter->s2;
+  filter->s2 = filter->s1;
+  filter->s1 = s0;
+  filter->count++;
+}
+
+
+/*
+ * After the last sample of a block, s1 = s[N-1] and s2 = s[N-2], and the bin is
+ *   X = e^(jw) s[N-1] - s[N-2] = (cos(w) s1 - s2) + j sin(w) s1
+ */
+static void goertzel_output(
+    const filter_goertzel_s32_t* filter,
+    complex_s32_t X[])
+{
+  for(unsigned k = 0; k < filter->bin_count; k++){
+    const int32_t s1 = filter->s1[k];
+    X[k].re = round_mul_q30(s1, filter->coef[k] >> 1) - filter->s2[k];
+    X[k].im = round_mul_q30(s1, filter->sin[k]);
+  }
+}
+
+
+void filter_goertzel_s32_init(
+    filter_goertzel_s32_t* filter,
+    int32_t state_buffer[],
+    const unsigned bins[],
+    const unsigned bin_count,
+    const unsigned block_length)
+{
+  assert(bin_count != 0);
+  assert(block_length >= 4);
+
+  const unsigned K = bin_count;
+
+  filter->bin_count = K;
+  filter->block_length = block_length;
+  filter->coef = &state_buffer[0];
+  filter->sin = &state_buffer[K];
+  filter->s1 = &state_buffer[2 * K];
+  filter->s2 = &state_buffer[3 * K];
+  filter->s0 = &state_buffer[4 * K];
+
+  q2_30 sin_min = 0x40000000;
+  for(unsigned k = 0; k < K; k++){
+    assert(bins[k] > 0 && 2 * bins[k] < block_length);
+    q2_30 c;
+    bin_cos_sin(&c, &filter->sin[k], bins[k], block_length);
+    filter->coef[k] = 2 * c;
+    sin_min = MIN(sin_min, filter->sin[k]);
+  }
+
+  // The recurrence state is bounded by N / sin(w) times the input amplitude, and 2*cos(w)*s1 must
+  // not saturate either.
+  const uint64_t growth = ((((uint64_t) 2 * block_length) << 30) + sin_min - 1) / sin_min;
+  right_shift_t shr = 0;
+  while((((uint64_t) 1) << shr) < growth)
+    shr++;
+
+  assert(shr < 31);
+  filter->input_shr = shr;
+
+  goertzel_reset(filter);
+}
+
+
+void filter_goertzel_s32_block(
+    filter_goertzel_s32_t* filter,
+    bfp_complex_s32_t* X,
+    const int32_t x[])
+{
+  for(unsigned n = 0; n < filter->block_length; n++)
+    goertzel_add_sample(filter, x[n]);
+
+  goertzel_output(filter, X->data);
+
+  X->length = filter->bin_count;
+  X->exp = filter->input_shr;
+  X->hr = vect_complex_s32_headroom(X->data, X->length);
+
+  goertzel_reset(filter);
+}
+
+
+void filter_sdft_s32_init(
+    filter_sdft_s32_t* filter,
+    int32_t state_buffer[],
+    const unsigned bins[],
+    const unsigned bin_count,
+    const unsigned window_length)
+{
+  const unsigned K = bin_count;
+  const unsigned N = window_length;
+
+  filter->bin_count = K;
+  filter->window_length = N;
+  filter->head = 0;
+  filter->history = &state_buffer[0];
+  filter->bin = (complex_s32_t*) &state_buffer[N];
+  filter->twiddle = (complex_s32_t*) &state_buffer[N + 2 * K];
+
+  filter_goertzel_s32_init(&filter->goertzel, &state_buffer[N + 4 * K], bins, K, N);
+
+  // The twiddles are e^(jw), with w as for the Goertzel recurrences
+  for(unsigned k = 0; k < K; k++){
+    filter->twiddle[k].re = filter->goertzel.coef[k] >> 1;
+    filter->twiddle[k].im = filter->goertzel.sin[k];
+  }
+
+  // The bins are bounded by N times the input amplitude, and x[t] - x[t-N] by twice it.
+  filter->input_shr = u32_ceil_log2(N) + 1;
+
+  vect_s32_set(filter->history, 0, N);
+  vect_s32_set((int32_t*) filter->bin, 0, 2 * K);
+}
+
+
+void filter_sdft_s32(
+    filter_sdft_s32_t* filter,
+    bfp_complex_s32_t* X,
+    const int32_t new_sample)
+{
+  const unsigned K = filter->bin_count;
+  const unsigned N = filter->window_length;
+  filter_goertzel_s32_t* goertzel = &filter->goertzel;
+
+  // The sample leaving the window is subtracted with exactly the rounding it was added with
+  const int32_t delta = round_shr32(new_sample, filter->input_shr)
+                      - round_shr32(filter->history[filter->head], filter->input_shr);
+
+  filter->history[filter->head] = new_sample;
+  filter->head = (filter->head + 1 == N)? 0 : filter->head + 1;
+
+  for(unsigned k = 0; k < K; k++)
+    filter->bin[k].re += delta;
+  vect_complex_s32_mul(filter->bin, filter->bin, filter->twiddle, K, 0, 0);
+
+  goertzel_add_sample(goertzel, new_sample);
+
+  // When the Goertzel block coincides with the window, its output replaces the recursion's state.
+  if(goertzel->count == N){
+    goertzel_output(goertzel, filter->bin);
+    vect_s32_shl((int32_t*) filter->bin, (int32_t*) filter->bin, 2 * K,
+                 goertzel->input_shr - filter->input_shr);
+    goertzel_reset(goertzel);
+  }
+
+  X->length = K;
+  X->exp = filter->input_shr;
+  X->hr = vect_s32_copy((int32_t*) X->data, (int32_t*) filter->bin, 2 * K);
+}
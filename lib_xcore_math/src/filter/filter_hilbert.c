@@ -0,0 +1,103 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+
+
+static inline int32_t round_shr_sat32(
+    const int64_t x,
+    const right_shift_t shr)
+{
+  const int64_t y = (shr <= 0)? x : ((x + (((int64_t) 1) << (shr - 1))) >> shr);
+  return (int32_t) MAX(-INT32_MAX, MIN(INT32_MAX, y));
+}
+
+
+void filter_hilbert_s32_init(
+    filter_hilbert_s32_t* filter,
+    int32_t state_buffer[],
+    const unsigned tap_count)
+{
+  assert(tap_count >= 3);
+  assert((tap_count & 3) == 3);
+
+  const unsigned L = (tap_count + 1) / 2;
+  const int c = (tap_count - 1) / 2;
+
+  filter->num_taps = tap_count;
+  filter->stream_length = L;
+  filter->parity = 0;
+  filter->head[0] = 0;
+  filter->head[1] = 0;
+  filter->coef = &state_buffer[0];
+  filter->stream[0] = &state_buffer[L];
+  filter->stream[1] = &state_buffer[3 * L];
+
+  /*
+   * coef[i] = h[2i], the tap applied to x[t-2i], is offset by m = 2i - c from the centre tap. The
+   * ideal response 2 / (pi m) is tapered by a Blackman window which reaches zero at m = +/-(c+1).
+   * The taps are mirrored so that they are exactly antisymmetric, which keeps the response zero at
+   * DC and Nyquist.
+   */
+  uint64_t gain = 0;
+  for(unsigned i = 0; i < L / 2; i++){
+    const int m = c - 2 * (int) i;
+    const float theta = (float) M_PI * m / (c + 1);
+    const float w = 0.42f + 0.5f * f32_cos(theta) + 0.08f * f32_cos(2 * theta);
+    const q2_30 h = (q2_30) lroundf(ldexpf(2.0f * w / ((float) M_PI * m), 30));
+    filter->coef[i] = -h;
+    filter->coef[L - 1 - i] = h;
+    gain += 2 * (uint64_t) h;
+  }
+
+  // The sum of the coefficient magnitudes bounds the gain of the filter
+  right_shift_t shr = 0;
+  while((((uint64_t) 1) << (30 + shr)) < gain)
+    shr++;
+  filter->output_shr = shr;
+
+  vect_s32_set(filter->stream[0], 0, 4 * L);
+}
+
+
+void filter_hilbert_s32_block(
+    filter_hilbert_s32_t* filter,
+    bfp_complex_s32_t* z,
+    const int32_t x[],
+    const unsigned length)
+{
+  const unsigned L = filter->stream_length;
+  const right_shift_t shr = filter->output_shr;
+
+  for(unsigned n = 0; n < length; n++){
+    const unsigned q = filter->parity;
+    int32_t* s = filter->stream[q];
+
+    // Each sample is written twice, so that the newest L samples are contiguous from `head`
+    unsigned head = filter->head[q];
+    head = (head == 0)? L - 1 : head - 1;
+    s[head] = x[n];
+    s[head + L] = x[n];
+    filter->head[q] = head;
+
+    // Only the taps at even k, applied to samples of the same parity as x[n], are non-zero
+    const int64_t acc = vect_s32_dot(&s[head], filter->coef, L, 0, 0);
+
+    // The centre tap's sample, x[n-(L-1)], is (L/2 - 1) samples into the other stream
+    const int32_t* s_other = filter->stream[1 - q];
+    z->data[n].re = round_shr_sat32(s_other[filter->head[1 - q] + L / 2 - 1], shr);
+    z->data[n].im = round_shr_sat32(acc, shr);
+
+    filter->parity = 1 - q;
+  }
+
+  z->length = length;
+  z->exp = shr;
+  z->hr = vect_complex_s32_headroom(z->data, length);
+}
@@ -0,0 +1,254 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+
+
+/*
+ * Each input sample contributes (x*x) >> ENERGY_SHR to the running energy. The same truncated term
+ * is subtracted when the sample leaves the window, so the running sum never drifts.
+ */
+#define ENERGY_SHR    (16)
+
+// Number of taps whose update is computed at a time
+#define UPDATE_BLOCK  (32)
+
+// The state buffer holds the input history, followed by the block's steps
+#define NLMS_HISTORY(TAPS, BLOCK)   ((TAPS) + (BLOCK) - 1)
+
+
+static inline int64_t energy_term(
+    const int32_t x)
+{
+  return (((int64_t) x) * x) >> ENERGY_SHR;
+}
+
+
+static inline int64_t round_shr64(
+    const int64_t x,
+    const right_shift_t shr)
+{
+  if(shr <= 0) return x;
+  return (x + (((int64_t) 1) << (shr - 1))) >> shr;
+}
+
+
+void filter_nlms_s32_init(
+    filter_nlms_s32_t* filter,
+    int32_t* state_buffer,
+    int32_t* coefficients,
+    const unsigned tap_count,
+    const unsigned block_length,
+    const right_shift_t shift,
+    const uq2_30 mu,
+    const int64_t delta)
+{
+  assert(tap_count != 0);
+  assert(block_length != 0);
+  assert(delta > 0);
+
+  const unsigned hist_len = NLMS_HISTORY(tap_count, block_length);
+
+  filter->num_taps = tap_count;
+  filter->block_length = block_length;
+  filter->head = hist_len - 1;
+  filter->shift = shift;
+  filter->mu = mu;
+  filter->delta = delta;
+  filter->energy = 0;
+  filter->coef = coefficients;
+  filter->state = state_buffer;
+
+  vect_s32_set(state_buffer, 0, FILTER_NLMS_S32_STATE_WORDS(tap_count, block_length));
+}
+
+
+// mu / (E + delta), in units of inverse squared input samples
+static float_s32_t nlms_step_scale(
+    const filter_nlms_s32_t* filter)
+{
+  const int64_t total = filter->energy + (filter->delta >> ENERGY_SHR);
+  float_s64_t energy = { MAX(1, total), ENERGY_SHR };
+  const float_s32_t denom = float_s64_to_float_s32(energy);
+
+  float_s32_t scale;
+  scale.mant = s32_inverse(&scale.exp, denom.mant);
+  scale.exp -= denom.exp;
+  return float_s32_mul(scale, (float_s32_t){ (int32_t) (filter->mu >> 1), -29 });
+}
+
+
+/*
+ * Computes the steps for the block's errors, i.e. scale * e[j], as 32-bit mantissas sharing a
+ * left-shift `shl`, such that the coefficient update is
+ *   b[k] += round(sum_j step[j] * x[t_j - k] * 2^-30) << shl
+ * The steps are written to `step` in reverse order (step[B-1-j] for e[j]), so that they line up
+ * with the state buffer, in which sample age increases with index. They are given enough headroom
+ * that the sum over the block cannot overflow 32 bits. `shl` is never negative; smaller updates
+ * are rounded into the steps instead.
+ */
+static left_shift_t nlms_steps(
+    int32_t step[],
+    const filter_nlms_s32_t* filter,
+    const float_s32_t scale,
+    const int32_t e[])
+{
+  const unsigned B = filter->block_length;
+
+  headroom_t hr = 63;
+  for(unsigned j = 0; j < B; j++)
+    hr = MIN(hr, HR_S64(((int64_t) scale.mant) * e[j]));
+
+  // Each step gets one bit of headroom, plus enough to sum B products.
+  headroom_t growth = 0;
+  while((1u << growth) < B) growth++;
+
+  // Real coefficient change is step * x * 2^(p_shr + scale.exp), and coefficients carry
+  // 30 + shift fractional bits.
+  right_shift_t p_shr = 33 + growth - (int) hr;
+  left_shift_t shl = p_shr + scale.exp + 60 + filter->shift;
+
+  if(shl < 0){
+    p_shr -= shl;
+    shl = 0;
+  }
+
+  for(unsigned j = 0; j < B; j++){
+    const int64_t p = ((int64_t) scale.mant) * e[j];
+    int32_t s;
+    if(p_shr >= 63)     s = 0;
+    else if(p_shr >= 0) s = (int32_t) round_shr64(p, p_shr);
+    else                s = (int32_t) (p * (((int64_t) 1) << -p_shr));
+    step[B - 1 - j] = s;
+  }
+
+  return shl;
+}
+
+
+/*
+ * Computes the (32-bit) gradient for `count` consecutive taps, the first of which sees the input
+ * sample at state[first] as its newest.
+ */
+static void nlms_gradient(
+    int32_t delta[],
+    const int32_t state[],
+    const unsigned H,
+    const unsigned first,
+    const unsigned count,
+    const int32_t step[],
+    const unsigned B)
+{
+  // With a single sample per block, the gradient is just a scaled copy of the input.
+  if(B == 1){
+    const unsigned len_a = MIN(count, H - first);
+    vect_s32_scale(delta, &state[first], len_a, step[0], 0, 0);
+    if(len_a < count)
+      vect_s32_scale(&delta[len_a], &state[0], count - len_a, step[0], 0, 0);
+    return;
+  }
+
+  for(unsigned k = 0; k < count; k++){
+    unsigned start = first + k;
+    if(start >= H) start -= H;
+
+    const unsigned len_a = MIN(B, H - start);
+    int64_t g = vect_s32_dot(&state[start], step, len_a, 0, 0);
+    if(len_a < B)
+      g += vect_s32_dot(&state[0], &step[len_a], B - len_a, 0, 0);
+
+    delta[k] = (int32_t) MAX(INT32_MIN, MIN(INT32_MAX, g));
+  }
+}
+
+
+void filter_nlms_s32_block(
+    filter_nlms_s32_t* filter,
+    int32_t e[],
+    const int32_t d[],
+    const int32_t x[],
+    const unsigned adapt)
+{
+  const unsigned N = filter->num_taps;
+  const unsigned B = filter->block_length;
+  const unsigned H = NLMS_HISTORY(N, B);
+
+  int32_t* state = filter->state;
+  int32_t* step = &filter->state[H];
+  int32_t* coef = filter->coef;
+
+  // Add the new samples, keeping the energy of the most recent N samples up to date.
+  for(unsigned j = 0; j < B; j++){
+    unsigned head = filter->head;
+    unsigned old = head + N;
+    if(old >= H) old -= H;
+
+    filter->energy += energy_term(x[j]) - energy_term(state[old]);
+    state[head] = x[j];
+
+    filter->head = (head == 0)? H - 1 : head - 1;
+  }
+
+  // Index of the newest sample. The sample of age `a` is at state[(newest + a) % H], so the input
+  // for block sample j covers the (circularly) contiguous range of N samples starting at age
+  // B - 1 - j.
+  const unsigned newest = (filter->head == H - 1)? 0 : filter->head + 1;
+
+  for(unsigned j = 0; j < B; j++){
+    unsigned start = newest + (B - 1 - j);
+    if(start >= H) start -= H;
+
+    const unsigned len_a = MIN(N, H - start);
+    int64_t y = vect_s32_dot(&state[start], coef, len_a, 0, 0);
+    if(len_a < N)
+      y += vect_s32_dot(&state[0], &coef[len_a], N - len_a, 0, 0);
+
+    if(filter->shift >= 0)  y = round_shr64(y, filter->shift);
+    else                    y = y * (((int64_t) 1) << -filter->shift);
+
+    y = MAX(INT32_MIN, MIN(INT32_MAX, y));
+    const int64_t err = ((int64_t) d[j]) - y;
+    e[j] = (int32_t) MAX(INT32_MIN, MIN(INT32_MAX, err));
+  }
+
+  if(!adapt)
+    return;
+
+  // The block's update is applied once all of its outputs have been computed, in a single pass
+  // over the taps. The gradient for tap k is the inner product of the (reversed) steps with the B
+  // input samples of ages k to k + B - 1.
+  const left_shift_t shl = nlms_steps(step, filter, nlms_step_scale(filter), e);
+
+  int32_t DWORD_ALIGNED delta[UPDATE_BLOCK];
+
+  for(unsigned k0 = 0; k0 < N; k0 += UPDATE_BLOCK){
+    const unsigned count = MIN(UPDATE_BLOCK, N - k0);
+
+    unsigned first = newest + k0;
+    if(first >= H) first -= H;
+    nlms_gradient(delta, state, H, first, count, step, B);
+
+    vect_s32_add(&coef[k0], &coef[k0], delta, count, 0, -shl);
+  }
+}
+
+
+int32_t filter_nlms_s32(
+    filter_nlms_s32_t* filter,
+    const int32_t new_sample,
+    const int32_t desired,
+    const unsigned adapt)
+{
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(filter->block_length == 1);
+#endif
+
+  int32_t e;
+  filter_nlms_s32_block(filter, &e, &desired, &new_sample, adapt);
+  return e;
+}
@@ -0,0 +1,295 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+#include "xmath_fft_lut.h"
+
+
+// Number of significant bits in a non-negative 64-bit value
+static unsigned u64_bits(
+    const uint64_t x)
+{
+  unsigned bits = 0;
+  while(bits < 64 && (x >> bits) != 0)
+    bits++;
+  return bits;
+}
+
+
+// Square of a real mantissa, with each factor shifted as vect_complex_s32_conj_mul() shifts its
+// operands
+static int32_t autocorr_square(
+    const int32_t b,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+  const int64_t bb = (b_shr >= 0)? (((int64_t) b) >> b_shr) : (((int64_t) b) << -b_shr);
+  const int64_t cc = (c_shr >= 0)? (((int64_t) b) >> c_shr) : (((int64_t) b) << -c_shr);
+  return (int32_t) ((bb * cc + (1 << 29)) >> 30);
+}
+
+
+static void autocorr_direct(
+    bfp_s32_t* a,
+    const bfp_s32_t* b)
+{
+  exponent_t energy_exp;
+  right_shift_t b_shr;
+  vect_s32_energy_prepare(&energy_exp, &b_shr, b->length, b->exp, b->hr);
+  const int64_t energy = vect_s32_energy(b->data, b->length, b_shr);
+
+  // Lag 0 is the largest, and is scaled to leave it 1 bit of headroom
+  const right_shift_t a_shr = (energy == 0)? 0 : ((int) u64_bits(energy) - 30);
+
+  a->hr = vect_s32_autocorr(a->data, b->data, b->length, a->length, b_shr, a_shr);
+  a->exp = 2 * (b->exp + b_shr) + 30 + a_shr;
+}
+
+
+static void autocorr_fft(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    int32_t scratch[],
+    const unsigned fft_length)
+{
+  const unsigned N = b->length;
+  const unsigned L = fft_length;
+
+  bfp_s32_t x;
+  bfp_s32_init(&x, scratch, b->exp, L, 0);
+  vect_s32_copy(&scratch[0], b->data, N);
+  vect_s32_set(&scratch[N], 0, L - N);
+  x.hr = b->hr;
+
+  bfp_complex_s32_t* X = bfp_fft_forward_mono(&x);
+
+  // X * conj(X) is the power spectrum, with imaginary parts of exactly zero. Bin 0 packs the
+  // (real) DC and Nyquist bins, so it is handled separately.
+  const int32_t dc = X->data[0].re;
+  const int32_t nyquist = X->data[0].im;
+
+  exponent_t P_exp;
+  right_shift_t X_shr, X_shr2;
+  vect_complex_s32_conj_mul_prepare(&P_exp, &X_shr, &X_shr2, X->exp, X->exp, X->hr, X->hr);
+  const headroom_t P_hr = vect_complex_s32_conj_mul(X->data, X->data, X->data, X->length,
+                                                    X_shr, X_shr2);
+  X->data[0].re = autocorr_square(dc, X_shr, X_shr2);
+  X->data[0].im = autocorr_square(nyquist, X_shr, X_shr2);
+  X->exp = P_exp;
+  X->hr = MIN(P_hr, HR_C32(X->data[0]));
+
+  bfp_s32_t* r = bfp_fft_inverse_mono(X);
+
+  // As with the direct path, lag 0 (the largest) is left with 1 bit of headroom
+  const right_shift_t shr = 1 - vect_s32_headroom(r->data, a->length);
+  a->hr = vect_s32_shr(a->data, r->data, a->length, shr);
+  a->exp = r->exp + shr;
+}
+
+
+void bfp_s32_autocorr(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    int32_t scratch[])
+{
+  const unsigned N = b->length;
+  const unsigned K = a->length;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(K != 0);
+  assert(K <= N);
+#endif
+
+  const unsigned log2_L = u32_ceil_log2(N + K - 1);
+
+  if(scratch != NULL && K >= XMATH_AUTOCORR_FFT_MIN_LAGS && log2_L <= MAX_DIT_FFT_LOG2)
+    autocorr_fft(a, b, scratch, 1 << log2_L);
+  else
+    autocorr_direct(a, b);
+}
+
+
+float_s32_t lpc_s32_levinson_durbin(
+    bfp_s32_t* lpc,
+    q2_30 refl[],
+    const bfp_s32_t* r)
+{
+  const unsigned P = lpc->length;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(P != 0);
+  assert(P <= LPC_MAX_ORDER);
+  assert(r->length > P);
+#endif
+
+  const float_s32_t one = {0x40000000, -30};
+  const float_s32_t zero = {0, 0};
+
+  // a[0] is unused; a[j] is the coefficient of z^-j
+  float_s32_t a[LPC_MAX_ORDER + 1];
+  for(unsigned j = 0; j <= P; j++)
+    a[j] = zero;
+  for(unsigned j = 0; j < P; j++)
+    refl[j] = 0;
+
+  float_s32_t err = {r->data[0], r->exp};
+
+  for(unsigned i = 1; i <= P && err.mant > 0; i++){
+    // k_i = -(r_i + sum_{j=1}^{i-1} a_j r_{i-j}) / err
+    float_s32_t acc = {r->data[i], r->exp};
+    for(unsigned j = 1; j < i; j++){
+      const float_s32_t r_ij = {r->data[i - j], r->exp};
+      acc = float_s32_add(acc, float_s32_mul(a[j], r_ij));
+    }
+
+    float_s32_t k = float_s32_div(acc, err);
+    k.mant = -k.mant;
+
+    // Rounding error can only make a (theoretically) stable predictor appear unstable when the
+    // autocorrelation is (nearly) singular; the lower order predictor is kept.
+    if(float_s32_gte(float_s32_abs(k), one))
+      break;
+
+    // a_j <- a_j + k * a_{i-j}, updated in pairs so that no temporary vector is needed
+    for(unsigned j = 1; j < i - j; j++){
+      const float_s32_t a_j = float_s32_add(a[j], float_s32_mul(k, a[i - j]));
+      a[i - j] = float_s32_add(a[i - j], float_s32_mul(k, a[j]));
+      a[j] = a_j;
+    }
+    if((i & 1) == 0)
+      a[i / 2] = float_s32_add(a[i / 2], float_s32_mul(k, a[i / 2]));
+
+    a[i] = k;
+    refl[i - 1] = float_s32_to_s32(k, -30);
+    err = float_s32_mul(err, float_s32_sub(one, float_s32_mul(k, k)));
+  }
+
+  // Use the smallest exponent at which no coefficient saturates
+  exponent_t exp = INT32_MIN;
+  for(unsigned j = 1; j <= P; j++)
+    if(a[j].mant != 0)
+      exp = MAX(exp, a[j].exp - (exponent_t) HR_S32(a[j].mant));
+  if(exp == INT32_MIN)
+    exp = -30;
+
+  for(unsigned j = 1; j <= P; j++)
+    lpc->data[j - 1] = float_s32_to_s32(a[j], exp);
+  lpc->exp = exp;
+  lpc->hr = vect_s32_headroom(lpc->data, P);
+
+  return err;
+}
+
+
+// Chebyshev series c_0 + sum_{k=1}^{M} c_k T_k(x), by Clenshaw's recurrence
+static float lsf_chebyshev(
+    const float c[],
+    const unsigned M,
+    const float x)
+{
+  float b1 = 0.0f, b2 = 0.0f;
+  for(unsigned k = M; k >= 1; k--){
+    const float b0 = 2.0f * x * b1 - b2 + c[k];
+    b2 = b1;
+    b1 = b0;
+  }
+  return x * b1 - b2 + c[0];
+}
+
+
+// Root of the Chebyshev series within (w0, w1), where it changes sign, by bisection
+static float lsf_bisect(
+    const float c[],
+    const unsigned M,
+    float w0,
+    float w1,
+    float f0)
+{
+  for(int iter = 0; iter < 20; iter++){
+    const float w = 0.5f * (w0 + w1);
+    const float f = lsf_chebyshev(c, M, f32_cos(w));
+    if((f < 0) == (f0 < 0)){
+      w0 = w;
+      f0 = f;
+    } else {
+      w1 = w;
+    }
+  }
+  return 0.5f * (w0 + w1);
+}
+
+
+unsigned lpc_s32_to_lsf(
+    radian_q24_t lsf[],
+    const bfp_s32_t* lpc)
+{
+  const unsigned P = lpc->length;
+  const unsigned M = P / 2;
+
+#if (XMATH_BFP_DEBUG_CHECK_LENGTHS) // See xmath_conf.h
+  assert(P != 0 && (P & 1) == 0);
+  assert(P <= LPC_MAX_ORDER);
+#endif
+
+  /*
+   * P(z) / (1 + z^-1) and Q(z) / (1 - z^-1) are symmetric polynomials of order P, with
+   * coefficients p_i and q_i. On the unit circle each is e^(-jMw) times a cosine series in w,
+   * which is the Chebyshev series in x = cos(w) with c_0 = p_M / 2 and c_k = p_{M-k}.
+   */
+  float cp[LPC_MAX_ORDER / 2 + 1];
+  float cq[LPC_MAX_ORDER / 2 + 1];
+
+  float p = 1.0f, q = 1.0f;
+  cp[M] = p;
+  cq[M] = q;
+  for(unsigned i = 1; i <= M; i++){
+    const float a_i = ldexpf((float) lpc->data[i - 1], lpc->exp);
+    const float a_r = ldexpf((float) lpc->data[P - i], lpc->exp);
+    p = a_i + a_r - p;
+    q = a_i - a_r + q;
+    cp[M - i] = p;
+    cq[M - i] = q;
+  }
+  cp[0] *= 0.5f;
+  cq[0] *= 0.5f;
+
+  // Roots of the two series interlace, with the lowest belonging to P
+  unsigned count = 0;
+  float w0 = 0.0f;
+  float fp0 = lsf_chebyshev(cp, M, 1.0f);
+  float fq0 = lsf_chebyshev(cq, M, 1.0f);
+
+  for(unsigned g = 1; g <= LPC_LSF_GRID_POINTS && count < P; g++){
+    const float w1 = (float) M_PI * g / LPC_LSF_GRID_POINTS;
+    const float x1 = f32_cos(w1);
+    const float fp1 = lsf_chebyshev(cp, M, x1);
+    const float fq1 = lsf_chebyshev(cq, M, x1);
+
+    float roots[2];
+    unsigned found = 0;
+    if((fp0 < 0) != (fp1 < 0))
+      roots[found++] = lsf_bisect(cp, M, w0, w1, fp0);
+    if((fq0 < 0) != (fq1 < 0))
+      roots[found++] = lsf_bisect(cq, M, w0, w1, fq0);
+
+    if(found == 2 && roots[1] < roots[0]){
+      const float t = roots[0];
+      roots[0] = roots[1];
+      roots[1] = t;
+    }
+
+    for(unsigned k = 0; k < found && count < P; k++)
+      lsf[count++] = (radian_q24_t) lroundf(ldexpf(roots[k], 24));
+
+    w0 = w1;
+    fp0 = fp1;
+    fq0 = fq1;
+  }
+
+  return count;
+}
@@ -23,6 +23,19 @@ const int32_t exp_small_coef[] = {
 };
 const unsigned exp_small_term_count = 10;
 
+// Power series of sin(pi/2 * t) / t in t^2
+const int32_t sbrad_sin_coef[] = {
+  REP8(0x6487ED51),
+  REP8(-0x295779CC),
+  REP8(0x0519AF1A),
+  REP8(-0x004CB4B3),
+  REP8(0x0002A0F0),
+  REP8(-0x00000F18),
+  REP8(0x0000003D),
+  REP8(-0x00000001),
+};
+const unsigned sbrad_sin_term_count = 8;
+
 void chunk_q30_exp_small(
     q2_30 a[VPU_INT32_EPV],
     const q2_30 b[VPU_INT32_EPV])
@@ -588,6 +588,32 @@ void vect_s32_inverse_prepare(
 }
 
 
+void vect_s32_divide_prepare(
+    exponent_t* a_exp,
+    left_shift_t* scale,
+    const exponent_t b_exp,
+    const headroom_t b_hr,
+    const int32_t c[],
+    const exponent_t c_exp,
+    const unsigned length)
+{
+    // Zero divisors saturate regardless, so they are excluded here.
+    int32_t c_min = INT32_MAX;
+    for(unsigned i = 0; i < length; i++){
+        const int32_t tmp = vlmul32(c[i], vsign32(c[i]));
+        if(tmp != 0) c_min = MIN(c_min, tmp);
+    }
+
+    // |b| <= 2^(31-b_hr) and |c| >= 2^(30-c_hr), so |b/c| <= 2^(1-b_hr+c_hr). As with
+    // vect_s32_inverse_prepare(), one bit is given up so that the largest quotient (which may be
+    // exactly a power of 2) is at most 2^30 and cannot saturate.
+    const headroom_t c_hr = HR_S32(c_min);
+
+    *scale = 29 + b_hr - c_hr;
+    *a_exp = b_exp - c_exp - *scale;
+}
+
+
 void vect_s32_energy_prepare(
     exponent_t* a_exp,
     right_shift_t* b_shr,
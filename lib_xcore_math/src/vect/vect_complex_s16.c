@@ -139,3 +139,72 @@ headroom_t vect_complex_s16_add_scalar(
 
   return 15 - MAX(mask_re, mask_im);
 }
+
+
+// pi in Q3.29
+#define PI_Q29        (0x6487ED51)
+// 1/pi in Q1.31
+#define INV_PI_Q31    (0x28BE60DC)
+
+void vect_complex_s16_angle(
+    radian_q24_t a[],
+    const int16_t b_real[],
+    const int16_t b_imag[],
+    const unsigned length,
+    const int16_t* rot_table,
+    const unsigned table_rows)
+{
+  // Same as vect_complex_s32_angle(), with Q1.15 rotations. Row `i` of the table rotates by
+  // -(pi/4) * 2^-i, which is 2^(29-i) in units of pi * 2^-31.
+  for(unsigned k = 0; k < length; k++){
+    int32_t x = b_real[k];
+    int32_t y = b_imag[k];
+    int64_t angle = 0;
+
+    if(x == 0 && y == 0){
+      a[k] = 0;
+      continue;
+    }
+
+    // The angle does not depend on scale, so normalize (leaving room for the rotations) for
+    // precision.
+    const headroom_t hr = MIN(HR_S32(x), HR_S32(y)) - 2;
+    x *= (1 << hr);
+    y *= (1 << hr);
+
+    if(x < 0){
+      const int32_t t = x;
+      if(y >= 0){ x = y;  y = -t; angle =  0x40000000; }
+      else      { x = -y; y = t;  angle = -0x40000000; }
+    }
+
+    for(unsigned iter = 0; iter < table_rows; iter++){
+      const int64_t c = rot_table[32 * iter];
+      const int64_t s = -rot_table[32 * iter + 16];
+      const int32_t step = 0x20000000 >> iter;
+
+      int64_t new_x, new_y;
+      if(y > 0){
+        new_x = x * c + y * s;
+        new_y = y * c - x * s;
+        angle += step;
+      } else {
+        new_x = x * c - y * s;
+        new_y = y * c + x * s;
+        angle -= step;
+      }
+
+      x = (int32_t) ((new_x + (1 << 14)) >> 15);
+      y = (int32_t) ((new_y + (1 << 14)) >> 15);
+    }
+
+    // The remaining angle is small enough that atan(y/x) = y/x.
+    if(x > 0)
+      angle += (((int64_t) y) * INV_PI_Q31) / x;
+
+    // Rounding can carry the angle slightly past +/-pi, which does not fit in 32 bits.
+    angle = MAX(-(((int64_t) 1) << 31), MIN(((int64_t) 1) << 31, angle));
+
+    a[k] = (radian_q24_t) ((angle * PI_Q29 + (((int64_t) 1) << 35)) >> 36);
+  }
+}
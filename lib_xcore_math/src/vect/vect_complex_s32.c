@@ -6,6 +6,7 @@
 #include <string.h>
 
 #include "xmath/xmath.h"
+#include "xmath_internal.h"
 
 
 
@@ -81,4 +82,189 @@ headroom_t vect_complex_s32_add_scalar(
 {
   return 31 - vect_sXX_add_scalar((int32_t*) a,(int32_t*)  b, 
                                       (length<<3), c.re, c.im, b_shr, 0x0000);
-}
\ No newline at end of file
+}
+
+// pi in Q3.29
+#define PI_Q29        (0x6487ED51)
+// 1/pi in Q1.31
+#define INV_PI_Q31    (0x28BE60DC)
+
+/*
+ * Rotates (re, im) onto the positive real axis, returning the angle it was rotated through in
+ * units of pi * 2^-31. Row `i` of the rotation table rotates by -(pi/4) * 2^-i, which is exactly
+ * 2^(29-i) of these units. The angle is within [-2^31, 2^31], i.e. [-pi, pi]; it is kept in 64 bits
+ * because +pi itself does not fit in an int32_t.
+ */
+static int64_t complex_s32_rotate_to_real(
+    int64_t* re,
+    int64_t* im,
+    const complex_s32_t* rot_table,
+    const unsigned table_rows)
+{
+  int64_t x = *re;
+  int64_t y = *im;
+  int64_t angle = 0;
+
+  // Fold into the right half-plane with a rotation of +/- pi/2
+  if(x < 0){
+    const int64_t t = x;
+    if(y >= 0){ x = y;  y = -t; angle =  0x40000000; }
+    else      { x = -y; y = t;  angle = -0x40000000; }
+  }
+
+  for(unsigned iter = 0; iter < table_rows; iter++){
+    const int64_t c = rot_table[iter * 4].re;
+    const int64_t s = -rot_table[iter * 4].im;
+    const int32_t step = 0x20000000 >> iter;
+
+    int64_t new_x, new_y;
+    if(y > 0){
+      new_x = x * c + y * s;
+      new_y = y * c - x * s;
+      angle += step;
+    } else {
+      new_x = x * c - y * s;
+      new_y = y * c + x * s;
+      angle -= step;
+    }
+
+    x = (new_x + (1 << 29)) >> 30;
+    y = (new_y + (1 << 29)) >> 30;
+  }
+
+  // The remaining angle is small enough that atan(y/x) = y/x.
+  if(x > 0)
+    angle += (y * INV_PI_Q31) / x;
+
+  // Rounding can carry the angle slightly past +/-pi.
+  const int64_t pi = ((int64_t) 1) << 31;
+
+  *re = x;
+  *im = y;
+  return MAX(-pi, MIN(pi, angle));
+}
+
+
+static inline radian_q24_t pi_units_to_q24(
+    const int64_t angle)
+{
+  return (radian_q24_t) ((angle * PI_Q29 + (((int64_t) 1) << 35)) >> 36);
+}
+
+
+void vect_complex_s32_angle(
+    radian_q24_t a[],
+    const complex_s32_t b[],
+    const unsigned length,
+    const complex_s32_t* rot_table,
+    const unsigned table_rows)
+{
+  for(unsigned k = 0; k < length; k++){
+    if(b[k].re == 0 && b[k].im == 0){
+      a[k] = 0;
+      continue;
+    }
+
+    // The angle does not depend on scale, so normalize for precision.
+    const headroom_t hr = MIN(HR_S32(b[k].re), HR_S32(b[k].im));
+    int64_t re = ((int64_t) b[k].re) * (((int64_t) 1) << hr);
+    int64_t im = ((int64_t) b[k].im) * (((int64_t) 1) << hr);
+
+    a[k] = pi_units_to_q24(complex_s32_rotate_to_real(&re, &im, rot_table, table_rows));
+  }
+}
+
+
+headroom_t vect_complex_s32_to_polar(
+    int32_t a_mag[],
+    radian_q24_t a_angle[],
+    const complex_s32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const complex_s32_t* rot_table,
+    const unsigned table_rows)
+{
+  for(unsigned k = 0; k < length; k++){
+    if(b[k].re == 0 && b[k].im == 0){
+      a_mag[k] = 0;
+      a_angle[k] = 0;
+      continue;
+    }
+
+    // Normalize for the rotations, and undo that (along with b_shr) on the magnitude.
+    const headroom_t hr = MIN(HR_S32(b[k].re), HR_S32(b[k].im));
+    int64_t re = ((int64_t) b[k].re) * (((int64_t) 1) << hr);
+    int64_t im = ((int64_t) b[k].im) * (((int64_t) 1) << hr);
+
+    const int64_t angle = complex_s32_rotate_to_real(&re, &im, rot_table, table_rows);
+
+    const int shr = hr + b_shr;
+    int64_t mag;
+    if(shr > 0)   mag = (re + (((int64_t) 1) << (shr - 1))) >> shr;
+    else          mag = (-shr >= 31)? INT32_MAX : (re << (-shr));
+
+    a_mag[k] = (int32_t) MIN(INT32_MAX, mag);
+    a_angle[k] = pi_units_to_q24(angle);
+  }
+
+  return vect_s32_headroom(a_mag, length);
+}
+
+
+headroom_t vect_polar_to_complex_s32(
+    complex_s32_t a[],
+    const int32_t b_mag[],
+    const radian_q24_t b_angle[],
+    const unsigned length,
+    const right_shift_t b_shr)
+{
+  int32_t DWORD_ALIGNED re[32];
+  int32_t DWORD_ALIGNED im[32];
+
+  for(unsigned k = 0; k < length; k += 32){
+    const unsigned count = MIN(32, length - k);
+
+    vect_s32_cos(re, &b_angle[k], count);
+    vect_s32_sin(im, &b_angle[k], count);
+    vect_s32_mul(re, &b_mag[k], re, count, b_shr, 0);
+    vect_s32_mul(im, &b_mag[k], im, count, b_shr, 0);
+    vect_s32_zip(&a[k], re, im, count, 0, 0);
+  }
+
+  return vect_complex_s32_headroom(a, length);
+}
+
+
+// Alpha-max-plus-beta-min coefficients (Q2.30) which minimise the largest relative error.
+#define AMBM_ALPHA_Q30  (0x3D77BFA0)
+#define AMBM_BETA_Q30   (0x1975F5E0)
+
+headroom_t vect_complex_s32_mag_fast(
+    int32_t a[],
+    const complex_s32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const unsigned iterations)
+{
+  for(unsigned k = 0; k < length; k++){
+    // |INT32_MIN| is clamped to INT32_MAX, so the squared magnitude below cannot overflow.
+    int64_t re = s32_ashr(b[k].re, b_shr);
+    int64_t im = s32_ashr(b[k].im, b_shr);
+    re = MIN(INT32_MAX, (re < 0)? -re : re);
+    im = MIN(INT32_MAX, (im < 0)? -im : im);
+
+    int64_t mag;
+
+    if(iterations == 0){
+      const int64_t hi = MAX(re, im);
+      const int64_t lo = MIN(re, im);
+      mag = (AMBM_ALPHA_Q30 * hi + AMBM_BETA_Q30 * lo + (1 << 29)) >> 30;
+    } else {
+      mag = xmath_s64_sqrt_newton(re * re + im * im, iterations);
+    }
+
+    a[k] = (int32_t) MIN(INT32_MAX, mag);
+  }
+
+  return vect_s32_headroom(a, length);
+}
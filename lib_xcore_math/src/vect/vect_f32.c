@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 
 #include "xmath/xmath.h"
 
@@ -66,3 +67,387 @@ void vect_packed_complex_f32_conj_macc(
 
   vect_complex_f32_conj_macc(&a[1], &b[1], &c[1], length-1);
 }
+
+
+exponent_t vect_f32_to_vect_s32_auto_exp(
+  int32_t a[],
+  const float b[],
+  const unsigned length,
+  const headroom_t a_hr)
+{
+  const exponent_t a_exp = vect_f32_max_exponent(b, length) + a_hr;
+  vect_f32_to_vect_s32(a, b, length, a_exp);
+  return a_exp;
+}
+
+
+void vect_f32_set(
+  float a[],
+  const float b,
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = b;
+}
+
+
+void vect_f32_copy(
+  float a[],
+  const float b[],
+  const unsigned length)
+{
+  memmove(&a[0], &b[0], length * sizeof(float));
+}
+
+
+void vect_f32_sub(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = b[k] - c[k];
+}
+
+
+void vect_f32_mul(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = b[k] * c[k];
+}
+
+
+void vect_f32_scale(
+  float a[],
+  const float b[],
+  const unsigned length,
+  const float c)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = b[k] * c;
+}
+
+
+void vect_f32_add_scalar(
+  float a[],
+  const float b[],
+  const unsigned length,
+  const float c)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = b[k] + c;
+}
+
+
+void vect_f32_macc(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] += b[k] * c[k];
+}
+
+
+void vect_f32_nmacc(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] -= b[k] * c[k];
+}
+
+
+void vect_f32_abs(
+  float a[],
+  const float b[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = fabsf(b[k]);
+}
+
+
+void vect_f32_rect(
+  float a[],
+  const float b[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = (b[k] > 0.0f)? b[k] : 0.0f;
+}
+
+
+void vect_f32_clip(
+  float a[],
+  const float b[],
+  const unsigned length,
+  const float lower_bound,
+  const float upper_bound)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = MIN(upper_bound, MAX(lower_bound, b[k]));
+}
+
+
+float vect_f32_max(
+  const float b[],
+  const unsigned length)
+{
+  return b[vect_f32_argmax(b, length)];
+}
+
+
+float vect_f32_min(
+  const float b[],
+  const unsigned length)
+{
+  return b[vect_f32_argmin(b, length)];
+}
+
+
+unsigned vect_f32_argmax(
+  const float b[],
+  const unsigned length)
+{
+  unsigned res = 0;
+  for(unsigned k = 1; k < length; k++)
+    if(b[k] > b[res]) res = k;
+  return res;
+}
+
+
+unsigned vect_f32_argmin(
+  const float b[],
+  const unsigned length)
+{
+  unsigned res = 0;
+  for(unsigned k = 1; k < length; k++)
+    if(b[k] < b[res]) res = k;
+  return res;
+}
+
+
+void vect_f32_max_elementwise(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = MAX(b[k], c[k]);
+}
+
+
+void vect_f32_min_elementwise(
+  float a[],
+  const float b[],
+  const float c[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = MIN(b[k], c[k]);
+}
+
+
+float vect_f32_sum(
+  const float b[],
+  const unsigned length)
+{
+  float acc = 0.0f;
+  for(unsigned k = 0; k < length; k++)
+    acc += b[k];
+  return acc;
+}
+
+
+float vect_f32_abs_sum(
+  const float b[],
+  const unsigned length)
+{
+  float acc = 0.0f;
+  for(unsigned k = 0; k < length; k++)
+    acc += fabsf(b[k]);
+  return acc;
+}
+
+
+float vect_f32_energy(
+  const float b[],
+  const unsigned length)
+{
+  return vect_f32_dot(b, b, length);
+}
+
+
+void vect_f32_sqrt(
+  float a[],
+  const float b[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = (b[k] > 0.0f)? sqrtf(b[k]) : 0.0f;
+}
+
+
+void vect_f32_inverse(
+  float a[],
+  const float b[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = 1.0f / b[k];
+}
+
+
+void vect_complex_f32_set(
+  complex_float_t a[],
+  const float b_real,
+  const float b_imag,
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++){
+    a[k].re = b_real;
+    a[k].im = b_imag;
+  }
+}
+
+
+void vect_complex_f32_sub(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const complex_float_t c[],
+  const unsigned length)
+{
+  vect_f32_sub((float*) &a[0], (float*) &b[0], (float*) &c[0], 2*length);
+}
+
+
+void vect_complex_f32_add_scalar(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const complex_float_t c,
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++){
+    a[k].re = b[k].re + c.re;
+    a[k].im = b[k].im + c.im;
+  }
+}
+
+
+void vect_complex_f32_real_mul(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const float c[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++){
+    a[k].re = b[k].re * c[k];
+    a[k].im = b[k].im * c[k];
+  }
+}
+
+
+void vect_complex_f32_real_scale(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const float c,
+  const unsigned length)
+{
+  vect_f32_scale((float*) &a[0], (float*) &b[0], 2*length, c);
+}
+
+
+void vect_complex_f32_scale(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const float c_real,
+  const float c_imag,
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++){
+    const complex_float_t B = b[k];
+    a[k].re = B.re * c_real - B.im * c_imag;
+    a[k].im = B.re * c_imag + B.im * c_real;
+  }
+}
+
+
+void vect_complex_f32_nmacc(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const complex_float_t c[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++){
+    a[k].re -= b[k].re * c[k].re - b[k].im * c[k].im;
+    a[k].im -= b[k].re * c[k].im + b[k].im * c[k].re;
+  }
+}
+
+
+void vect_complex_f32_conj_nmacc(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const complex_float_t c[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++){
+    a[k].re -= b[k].re * c[k].re + b[k].im * c[k].im;
+    a[k].im -= b[k].im * c[k].re - b[k].re * c[k].im;
+  }
+}
+
+
+void vect_complex_f32_conjugate(
+  complex_float_t a[],
+  const complex_float_t b[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++){
+    a[k].re = b[k].re;
+    a[k].im = -b[k].im;
+  }
+}
+
+
+void vect_complex_f32_squared_mag(
+  float a[],
+  const complex_float_t b[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = b[k].re * b[k].re + b[k].im * b[k].im;
+}
+
+
+void vect_complex_f32_mag(
+  float a[],
+  const complex_float_t b[],
+  const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = sqrtf(b[k].re * b[k].re + b[k].im * b[k].im);
+}
+
+
+complex_float_t vect_complex_f32_sum(
+  const complex_float_t b[],
+  const unsigned length)
+{
+  complex_float_t acc = { 0.0f, 0.0f };
+  for(unsigned k = 0; k < length; k++){
+    acc.re += b[k].re;
+    acc.im += b[k].im;
+  }
+  return acc;
+}
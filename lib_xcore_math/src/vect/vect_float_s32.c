@@ -6,6 +6,7 @@
 #include <string.h>
 
 #include "xmath/xmath.h"
+#include "xmath_internal.h"
 
 
 void vect_float_s32_log_base(
@@ -61,3 +62,239 @@ void vect_float_s32_log10(
   vect_float_s32_log_base(a, b, 0x1bcb7b15, length);
 }
 
+
+
+void vect_float_s32_exp(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const unsigned length)
+{
+  // See vect_s32_exp()
+  q2_30 DWORD_ALIGNED z[TRANS_BLOCK];
+  int n[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    for(unsigned i = 0; i < count; i++)
+      n[i] = xmath_exp_reduce(&z[i], b[k + i].mant, b[k + i].exp);
+
+    vect_q30_exp_small(z, z, count);
+
+    for(unsigned i = 0; i < count; i++){
+      a[k + i].mant = z[i];
+      a[k + i].exp = n[i] - 30;
+    }
+  }
+}
+
+
+/*
+ * Inline equivalents of float_s32_mul() and float_s32_add(), producing bit-identical results.
+ * The scalar functions go through vect_s32_mul_prepare() and a single-element vect_s32_mul(),
+ * which dominates the cost when applied element-by-element.
+ */
+
+static inline int32_t float_s32_shift(
+    const int32_t x,
+    const right_shift_t shr)
+{
+  // Left shifts here are always bounded by the headroom of x, so never saturate.
+  if(shr > 31)        return (x >= 0)? 0 : -1;
+  else if(shr >= 0)   return x >> shr;
+  else                return (int32_t) (((uint32_t) x) << (-shr));
+}
+
+
+static inline float_s32_t float_s32_mul_inline(
+    const float_s32_t x,
+    const float_s32_t y)
+{
+  // See vect_s32_mul_prepare()
+  const headroom_t x_hr = HR_S32(x.mant);
+  const headroom_t y_hr = HR_S32(y.mant);
+  const headroom_t total_hr = x_hr + y_hr;
+
+  right_shift_t x_shr, y_shr;
+
+  if(total_hr == 0){
+    x_shr = 1;
+    y_shr = 1;
+  } else if(total_hr == 1){
+    x_shr = (x_hr == 0)? 1 : 0;
+    y_shr = (y_hr == 0)? 1 : 0;
+  } else if(x_hr == 0){
+    x_shr = 0;
+    y_shr = 2 - total_hr;
+  } else if(y_hr == 0){
+    x_shr = 2 - total_hr;
+    y_shr = 0;
+  } else {
+    x_shr = 1 - x_hr;
+    y_shr = 1 - y_hr;
+  }
+
+  const int64_t p = ((int64_t) float_s32_shift(x.mant, x_shr)) * float_s32_shift(y.mant, y_shr);
+  const int64_t q = (p + (1 << 29)) >> 30;
+
+  float_s32_t res;
+  res.mant = (q > INT32_MAX)? INT32_MAX : (q < INT32_MIN)? INT32_MIN : (int32_t) q;
+  res.exp = x.exp + y.exp + x_shr + y_shr + 30;
+  return res;
+}
+
+
+static inline float_s32_t float_s32_add_inline(
+    const float_s32_t x,
+    const float_s32_t y)
+{
+  const exponent_t x_min_exp = x.exp - HR_S32(x.mant);
+  const exponent_t y_min_exp = y.exp - HR_S32(y.mant);
+
+  float_s32_t res;
+  res.exp = MAX(x_min_exp, y_min_exp) + 1;
+  res.mant = float_s32_shift(x.mant, res.exp - x.exp) + float_s32_shift(y.mant, res.exp - y.exp);
+  return res;
+}
+
+
+static inline float_s32_t float_s32_sub_inline(
+    const float_s32_t x,
+    const float_s32_t y)
+{
+  const exponent_t x_min_exp = x.exp - HR_S32(x.mant);
+  const exponent_t y_min_exp = y.exp - HR_S32(y.mant);
+
+  float_s32_t res;
+  res.exp = MAX(x_min_exp, y_min_exp) + 1;
+  res.mant = float_s32_shift(x.mant, res.exp - x.exp) - float_s32_shift(y.mant, res.exp - y.exp);
+  return res;
+}
+
+
+/*
+ * Exact comparison, returning the sign of (x - y). float_s32_sub() would shift both mantissas right
+ * and lose the LSB of near-equal values, so the mantissas are instead aligned to the smaller
+ * exponent in 64 bits. When the exponents differ by 32 or more, any non-zero value with the larger
+ * exponent has a greater magnitude than the other value.
+ */
+static inline int float_s32_cmp_inline(
+    const float_s32_t x,
+    const float_s32_t y)
+{
+  int64_t xx = x.mant;
+  int64_t yy = y.mant;
+
+  if(x.exp > y.exp){
+    if(x.exp - y.exp < 32)  xx = xx * (((int64_t) 1) << (x.exp - y.exp));
+    else if(xx != 0)        yy = 0;
+  } else if(y.exp > x.exp){
+    if(y.exp - x.exp < 32)  yy = yy * (((int64_t) 1) << (y.exp - x.exp));
+    else if(yy != 0)        xx = 0;
+  }
+
+  return (xx > yy) - (xx < yy);
+}
+
+
+void vect_float_s32_mul(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = float_s32_mul_inline(b[k], c[k]);
+}
+
+
+void vect_float_s32_scale(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c,
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = float_s32_mul_inline(b[k], c);
+}
+
+
+void vect_float_s32_add(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = float_s32_add_inline(b[k], c[k]);
+}
+
+
+void vect_float_s32_sub(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = float_s32_sub_inline(b[k], c[k]);
+}
+
+
+void vect_float_s32_macc(
+    float_s32_t acc[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    acc[k] = float_s32_add_inline(acc[k], float_s32_mul_inline(b[k], c[k]));
+}
+
+
+void vect_float_s32_ema(
+    float_s32_t acc[],
+    const float_s32_t b[],
+    const uq2_30 coef,
+    const unsigned length)
+{
+  // See float_s32_ema()
+  const float_s32_t t = { (int32_t) coef, -30 };
+  const float_s32_t s = { (int32_t) (0x40000000 - coef), -30 };
+
+  for(unsigned k = 0; k < length; k++)
+    acc[k] = float_s32_add_inline(float_s32_mul_inline(acc[k], t), float_s32_mul_inline(b[k], s));
+}
+
+
+void vect_float_s32_gt(
+    int8_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = float_s32_cmp_inline(b[k], c[k]) > 0;
+}
+
+
+void vect_float_s32_max_elementwise(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = (float_s32_cmp_inline(b[k], c[k]) >= 0)? b[k] : c[k];
+}
+
+
+void vect_float_s32_min_elementwise(
+    float_s32_t a[],
+    const float_s32_t b[],
+    const float_s32_t c[],
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = (float_s32_cmp_inline(b[k], c[k]) <= 0)? b[k] : c[k];
+}
@@ -4,8 +4,10 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 
 #include "xmath/xmath.h"
+#include "xmath_internal.h"
 
 
 headroom_t vect_s32_shr(
@@ -30,6 +32,8 @@ headroom_t vect_s32_add_scalar(
 
 extern const int32_t exp_small_coef[];
 extern const unsigned exp_small_term_count;
+extern const int32_t sbrad_sin_coef[];
+extern const unsigned sbrad_sin_term_count;
 
 void vect_q30_power_series(
     int32_t a[],
@@ -38,16 +42,15 @@ void vect_q30_power_series(
     const unsigned term_count,
     const unsigned length)
 {
-  (void) coef;
   const unsigned full_chunks = length >> 3;
   const unsigned tail = length & 0x7;
 
   for(unsigned k = 0; k < full_chunks; k++)
-    chunk_q30_power_series(&a[k<<3], &b[k<<3], exp_small_coef, term_count);
+    chunk_q30_power_series(&a[k<<3], &b[k<<3], coef, term_count);
 
   if(tail){
     int32_t DWORD_ALIGNED tmp[8];
-    chunk_q30_power_series(&tmp[0], &b[full_chunks<<3], exp_small_coef, term_count);
+    chunk_q30_power_series(&tmp[0], &b[full_chunks<<3], coef, term_count);
     memcpy(&a[full_chunks<<3], &tmp[0], tail*sizeof(int32_t));
   }
 }
@@ -66,6 +69,480 @@ void vect_q30_exp_small(
 }
 
 
+#define LOG2_E_Q30    (0x5C551D95)
+#define LN_2_Q30      (0x2C5C85FE)
+
+// Largest |n| in e^x = 2^n * 2^f. Anything beyond this saturates.
+#define EXP_N_MAX     (1 << 24)
+
+
+// See xmath_internal.h
+int xmath_exp_reduce(
+    q2_30* z,
+    const int32_t b,
+    const exponent_t b_exp)
+{
+  // y = b * log2(e), with `frac` fractional bits
+  const int64_t y = ((int64_t) b) * LOG2_E_Q30;
+  const int frac = 30 - b_exp;
+
+  int64_t n;
+  int64_t f_q30;
+
+  if(y == 0){
+    n = 0;
+    f_q30 = 0;
+  } else if(frac <= 0){
+    // y is an integer.
+    const headroom_t hr = HR_S64(y);
+    n = ((-frac) >= (int) hr)? ((y > 0)? EXP_N_MAX : -EXP_N_MAX) : (y * (((int64_t) 1) << -frac));
+    f_q30 = 0;
+  } else if(frac >= 62){
+    // |y| < 1/2
+    n = 0;
+    f_q30 = ((frac - 30) >= 63)? 0 : (y >> (frac - 30));
+  } else {
+    const int64_t half = ((int64_t) 1) << (frac - 1);
+    n = (y + half) >> frac;
+    const int64_t f = y - n * (((int64_t) 1) << frac);
+    f_q30 = (frac >= 30)? (f >> (frac - 30)) : (f * (((int64_t) 1) << (30 - frac)));
+  }
+
+  *z = (q2_30) ((f_q30 * LN_2_Q30 + (1 << 29)) >> 30);
+
+  return (int) MAX(-EXP_N_MAX, MIN(EXP_N_MAX, n));
+}
+
+
+headroom_t vect_s32_exp(
+    int32_t a[],
+    exponent_t* a_exp,
+    const int32_t b[],
+    const exponent_t b_exp,
+    const unsigned length)
+{
+  // e^x is monotonic, so the largest input determines the output exponent.
+  q2_30 z_max;
+  const int n_max = xmath_exp_reduce(&z_max, vect_s32_max(b, length), b_exp);
+
+  q2_30 DWORD_ALIGNED z[TRANS_BLOCK];
+  int n[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    for(unsigned i = 0; i < count; i++)
+      n[i] = xmath_exp_reduce(&z[i], b[k + i], b_exp);
+
+    vect_q30_exp_small(z, z, count);
+
+    for(unsigned i = 0; i < count; i++){
+      const int shr = n_max - n[i];
+      a[k + i] = (shr >= 31)? 0 : (int32_t) ((((int64_t) z[i]) + ((1 << shr) >> 1)) >> shr);
+    }
+  }
+
+  *a_exp = n_max - 30;
+  return vect_s32_headroom(a, length);
+}
+
+
+void vect_sbrad_sin(
+    q2_30 a[],
+    const sbrad_t b[],
+    const unsigned length)
+{
+  q2_30 DWORD_ALIGNED r[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    // sin(pi/2 * t) = t * P(t^2), with t = b / 2 as a Q2.30
+    vect_s32_mul(r, &b[k], &b[k], count, 1, 1);
+    vect_q30_power_series(r, r, sbrad_sin_coef, sbrad_sin_term_count, count);
+    vect_s32_mul(&a[k], &b[k], r, count, 1, 0);
+  }
+}
+
+
+// Same mapping as radians_to_sbrads()
+static inline sbrad_t q24_to_sbrad(
+    const radian_q24_t theta)
+{
+  const int64_t acc = ((int64_t) 0x517CC1B7) * theta;
+  int32_t tmp = (int32_t) (acc >> 25);
+  const int32_t kase = (tmp >> 30) & 0x3;
+  tmp = (int32_t) (((uint32_t) tmp) << 1);
+  return (kase == 1 || kase == 2)? (int32_t) (0u - (uint32_t) tmp) : tmp;
+}
+
+
+void vect_s32_sin(
+    q2_30 a[],
+    const radian_q24_t b[],
+    const unsigned length)
+{
+  sbrad_t DWORD_ALIGNED alpha[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    for(unsigned i = 0; i < count; i++)
+      alpha[i] = q24_to_sbrad(b[k + i]);
+
+    vect_sbrad_sin(&a[k], alpha, count);
+  }
+}
+
+
+void vect_s32_cos(
+    q2_30 a[],
+    const radian_q24_t b[],
+    const unsigned length)
+{
+  // cos(x) = sin(x + pi/2) = sin(x - 3*pi/2), choosing whichever does not overflow (see q24_cos())
+  const radian_q24_t pi_half = Q24(M_PI / 2.0);
+  const radian_q24_t three_pi_half = Q24(3.0 * M_PI / 2.0);
+
+  sbrad_t DWORD_ALIGNED alpha[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    for(unsigned i = 0; i < count; i++){
+      const radian_q24_t theta = b[k + i];
+      alpha[i] = q24_to_sbrad(theta + ((theta >= 0)? -three_pi_half : pi_half));
+    }
+
+    vect_sbrad_sin(&a[k], alpha, count);
+  }
+}
+
+
+void vect_s32_tan(
+    float_s32_t a[],
+    const radian_q24_t b[],
+    const unsigned length)
+{
+  // tan(pi/2 * alpha) = sin(pi/2 * alpha) / sin(pi/2 * (1 - |alpha|)), where alpha is the angle in
+  // units of pi/2 reduced to [-1, 1) using the period of tan().
+  sbrad_t DWORD_ALIGNED alpha[TRANS_BLOCK];
+  sbrad_t DWORD_ALIGNED beta[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    for(unsigned i = 0; i < count; i++){
+      const int32_t t = (int32_t) ((((int64_t) 0x517CC1B7) * b[k + i]) >> 24);
+      alpha[i] = t;
+      // 1 - |t| in Q1.31 (less one LSB so that it is representable)
+      beta[i] = (int32_t) (0x7FFFFFFF - ((t < 0)? -(int64_t) t : t));
+    }
+
+    vect_sbrad_sin(alpha, alpha, count);
+    vect_sbrad_sin(beta, beta, count);
+
+    for(unsigned i = 0; i < count; i++){
+      // tan() is undefined at odd multiples of pi/2; avoid dividing by zero there.
+      float_s32_t res;
+      res.mant = s32_inverse(&res.exp, (beta[i] == 0)? 1 : beta[i]);
+      res.exp += 30;
+      a[k + i] = float_s32_mul((float_s32_t){ alpha[i], -30 }, res);
+    }
+  }
+}
+
+
+/*
+ * Computes 1 / (1 + e^(-|x|)) as Q2.30 values for a block of Q8.24 inputs, where `b_exp` is the
+ * exponent to associate with the input mantissas (-24 for x, -23 for 2x).
+ */
+static void logistic_abs_block(
+    q2_30 a[],
+    const q8_24 b[],
+    const exponent_t b_exp,
+    const unsigned count)
+{
+  for(unsigned i = 0; i < count; i++)
+    a[i] = (b[i] < 0)? ((b[i] == INT32_MIN)? INT32_MIN + 1 : b[i]) : -b[i];
+
+  // y = e^(-|x|), which is within (0, 1]
+  exponent_t y_exp;
+  vect_s32_exp(a, &y_exp, a, b_exp, count);
+  vect_s32_shr(a, a, count, -30 - y_exp);
+
+  // 1 / (1 + y) using the Q2.29 denominator, which cannot overflow.
+  vect_s32_add_scalar(a, a, 0x20000000, count, 1);
+  vect_s32_inverse(a, a, count, 59);
+}
+
+
+void vect_s32_logistic(
+    q8_24 a[],
+    const q8_24 b[],
+    const unsigned length)
+{
+  q2_30 DWORD_ALIGNED tmp[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    logistic_abs_block(tmp, &b[k], -24, count);
+
+    // logistic(-x) = 1 - logistic(x)
+    for(unsigned i = 0; i < count; i++){
+      const q2_30 y = (b[k + i] < 0)? 0x40000000 - tmp[i] : tmp[i];
+      a[k + i] = (y + (1 << 5)) >> 6;
+    }
+  }
+}
+
+
+void vect_s32_tanh(
+    q2_30 a[],
+    const q8_24 b[],
+    const unsigned length)
+{
+  q2_30 DWORD_ALIGNED tmp[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    // tanh(|x|) = 2 * logistic(2|x|) - 1
+    logistic_abs_block(tmp, &b[k], -23, count);
+
+    for(unsigned i = 0; i < count; i++){
+      const q2_30 y = 2 * (tmp[i] - 0x20000000);
+      a[k + i] = (b[k + i] < 0)? -y : y;
+    }
+  }
+}
+
+
+void vect_s32_relu_to_vect_s16(
+    int16_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr)
+{
+  int32_t DWORD_ALIGNED tmp[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    vect_s32_rect(tmp, &b[k], count);
+    vect_s32_to_vect_s16(&a[k], tmp, count, b_shr);
+  }
+}
+
+
+void vect_s32_relu_to_vect_s8(
+    int8_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr)
+{
+  int32_t DWORD_ALIGNED tmp[TRANS_BLOCK];
+  int16_t DWORD_ALIGNED tmp16[TRANS_BLOCK];
+
+  for(unsigned k = 0; k < length; k += TRANS_BLOCK){
+    const unsigned count = MIN(TRANS_BLOCK, length - k);
+
+    vect_s32_rect(tmp, &b[k], count);
+    vect_s32_to_vect_s16(tmp16, tmp, count, b_shr);
+    vect_s16_clip(tmp16, tmp16, count, 0, INT8_MAX, 0);
+    vect_s16_extract_low_byte(&a[k], tmp16, count);
+  }
+}
+
+
+void vect_s32_unwrap_phase(
+    radian_q24_t a[],
+    const radian_q24_t b[],
+    const unsigned length)
+{
+  const int64_t pi = Q24(M_PI);
+  const int64_t two_pi = Q24(2.0 * M_PI);
+
+  if(length == 0)
+    return;
+
+  radian_q24_t prev = b[0];
+  int64_t acc = b[0];
+  a[0] = b[0];
+
+  for(unsigned k = 1; k < length; k++){
+    const radian_q24_t cur = b[k];
+
+    // Wrap the phase step into [-pi, pi)
+    int64_t delta = ((int64_t) cur) - prev;
+    delta -= two_pi * ((delta + pi) / two_pi);
+    if(delta < -pi) delta += two_pi;
+
+    acc += delta;
+    a[k] = (radian_q24_t) MAX(INT32_MIN, MIN(INT32_MAX, acc));
+    prev = cur;
+  }
+}
+
+
+// 1/sqrt(x) as Q2.30, for x at the centre of each interval [i/64, (i+1)/64) with i in [32, 128).
+static const int32_t rsqrt_seed[96] = {
+  0x59CF8CBC, 0x5875CADE, 0x572B2DE0, 0x55EEA2C4, 0x54BF311A, 0x539BF7CD,
+  0x52842A5F, 0x51770E8F, 0x5073FA50, 0x4F7A5202, 0x4E8986EA, 0x4DA115DA,
+  0x4CC08605, 0x4BE767F5, 0x4B1554A6, 0x4A49ECB3, 0x4984D7A4, 0x48C5C34B,
+  0x480C6332, 0x4758701C, 0x46A9A794, 0x45FFCB80, 0x455AA1CB, 0x44B9F40B,
+  0x441D8F3B, 0x43854374, 0x42F0E3AE, 0x4260458E, 0x41D3412A, 0x4149B0E5,
+  0x40C3713B, 0x404060A1, 0x3FC05F61, 0x3F434F77, 0x3EC91474, 0x3E519367,
+  0x3DDCB2BD, 0x3D6A5A31, 0x3CFA72B2, 0x3C8CE651, 0x3C21A02F, 0x3BB88C6E,
+  0x3B51981D, 0x3AECB12E, 0x3A89C669, 0x3A28C759, 0x39C9A44B, 0x396C4E39,
+  0x3910B6C7, 0x38B6D037, 0x385E8D61, 0x3807E1AA, 0x37B2C0FC, 0x375F1FC3,
+  0x370CF2E1, 0x36BC2FAB, 0x366CCBE1, 0x361EBDAC, 0x35D1FB96, 0x35867C84,
+  0x353C37B6, 0x34F324BF, 0x34AB3B82, 0x3464742F, 0x341EC73E, 0x33DA2D6C,
+  0x33969FBA, 0x33541766, 0x33128DEB, 0x32D1FD00, 0x32925E8F, 0x3253ACBA,
+  0x3215E1D5, 0x31D8F863, 0x319CEB16, 0x3161B4CC, 0x3127508E, 0x30EDB98E,
+  0x30B4EB25, 0x307CE0CF, 0x30459630, 0x300F070C, 0x2FD92F48, 0x2FA40AEB,
+  0x2F6F9618, 0x2F3BCD12, 0x2F08AC36, 0x2ED62FFE, 0x2EA454FF, 0x2E7317E4,
+  0x2E427573, 0x2E126A89, 0x2DE2F41A, 0x2DB40F2F, 0x2D85B8E6, 0x2D57EE72,
+};
+
+
+// See xmath_internal.h
+int64_t xmath_s64_sqrt_newton(
+    const int64_t x,
+    const unsigned iterations)
+{
+  if(x <= 0)
+    return 0;
+
+  // Normalise by an even shift so that x_n = (x << s) >> 32 lies in [2^29, 2^31), i.e. [0.5, 2)
+  // as a Q2.30 value.
+  const unsigned s = ((unsigned) HR_S64(x)) & ~1u;
+  const int64_t x_n = (x << s) >> 32;
+
+  int64_t r = rsqrt_seed[(x_n >> 24) - 32];
+
+  // r <- r * (3 - x_n * r^2) / 2
+  for(unsigned i = 0; i < iterations; i++){
+    const int64_t t = (x_n * r + (1 << 29)) >> 30;
+    const int64_t t2 = (t * r + (1 << 29)) >> 30;
+    r = (r * (0xC0000000LL - t2) + (1LL << 30)) >> 31;
+  }
+
+  // sqrt(x_n) = x_n * r, and sqrt(x) = sqrt(x_n) * 2^(31 - s/2)
+  const int64_t q = x_n * r;
+  const right_shift_t shr = 29 + (s >> 1);
+  return (q + (((int64_t) 1) << (shr - 1))) >> shr;
+}
+
+
+headroom_t vect_s32_sqrt_fast(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const unsigned iterations)
+{
+  for(unsigned k = 0; k < length; k++){
+    const int32_t v = s32_ashr(b[k], b_shr);
+    a[k] = (int32_t) xmath_s64_sqrt_newton(((int64_t) v) << 30, iterations);
+  }
+
+  return vect_s32_headroom(a, length);
+}
+
+
+// Number of significant bits in x (x > 0)
+static inline int s64_bits(
+    const int64_t x)
+{
+  return 63 - (int) HR_S64(x);
+}
+
+
+/*
+ * Computes round(n / d) for 0 <= n < 2^62 and 0 < d < 2^62, with ties rounded up.
+ *
+ * The reciprocal of d is estimated with the linear seed 24/17 - 8/17 * x and refined with three
+ * Newton-Raphson iterations, giving a quotient which is within a few units of the exact one. The
+ * remainder is then used to correct and round it.
+ */
+static int64_t u62_divide_round(
+    const int64_t n,
+    const int64_t d)
+{
+  if(n == 0)
+    return 0;
+
+  // Normalise both operands to 31-bit values in [2^30, 2^31), i.e. [1, 2) as Q1.30
+  const int d_bits = s64_bits(d);
+  const int n_bits = s64_bits(n);
+  const int64_t d_n = (d_bits > 31)? (d >> (d_bits - 31)) : (d << (31 - d_bits));
+  const int64_t n_n = (n_bits > 31)? (n >> (n_bits - 31)) : (n << (31 - n_bits));
+
+  // r ~ 1/d_n as Q2.30, in (0.5, 1]
+  int64_t r = 0x5A5A5A5ALL - ((0x1E1E1E1ELL * d_n) >> 30);
+  for(int i = 0; i < 3; i++){
+    const int64_t t = (d_n * r) >> 30;
+    r = (r * (0x80000000LL - t)) >> 30;
+  }
+
+  // n/d = (n_n / d_n) * 2^(n_bits - d_bits)
+  const right_shift_t shr = 60 - (n_bits - d_bits);
+  int64_t q = (shr >= 63)? 0 : (n_n * r) >> shr;
+
+  int64_t rem = n - q * d;
+  while(rem < 0){ q--; rem += d; }
+  while(rem >= d){ q++; rem -= d; }
+
+  return q + ((2 * rem >= d)? 1 : 0);
+}
+
+
+headroom_t vect_s32_divide(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const left_shift_t scale)
+{
+  for(unsigned k = 0; k < length; k++){
+    const int64_t bk = b[k];
+    const int64_t ck = c[k];
+    const int negative = (bk < 0) != (ck < 0);
+    const int64_t n = (bk < 0)? -bk : bk;
+    int64_t d = (ck < 0)? -ck : ck;
+    left_shift_t shl = scale;
+
+    // Keep the divisor within 31 bits, so neither operand below reaches 2^62
+    if(d == (((int64_t) 1) << 31)){
+      d >>= 1;
+      shl--;
+    }
+
+    int64_t q;
+
+    if(n == 0){
+      q = 0;
+    } else if(d == 0 || s64_bits(n) + shl >= s64_bits(d) + 32){
+      // Quotient is at least 2^31
+      q = ((int64_t) 1) << 31;
+    } else if(shl >= 0){
+      q = u62_divide_round(n << shl, d);
+    } else if(s64_bits(d) - shl > 62){
+      // Quotient is below 1/2
+      q = 0;
+    } else {
+      q = u62_divide_round(n, d << (-shl));
+    }
+
+    a[k] = (int32_t) (negative? MAX(INT32_MIN, -q) : MIN(INT32_MAX, q));
+  }
+
+  return vect_s32_headroom(a, length);
+}
+
+
 
 void vect_s32_log_base(
     q8_24 a[],
@@ -134,3 +611,29 @@ void vect_split_acc_s32_shr(
   vect_s32_shr((int32_t*) &a[0], (int32_t*) &a[0], length, shr);
   vect_s32_split_accs(&a[0], (int32_t*) &a[0], length);
 }
+
+
+headroom_t vect_s32_autocorr(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const unsigned lag_count,
+    const right_shift_t b_shr,
+    const right_shift_t a_shr)
+{
+  for(unsigned k = 0; k < lag_count; k++){
+    int64_t acc = vect_s32_dot(&b[0], &b[k], length - k, b_shr, b_shr);
+
+    // A left-shift of more than 31 bits saturates anything non-zero, so clamp before shifting.
+    if(a_shr > 0){
+      acc = (acc + (((int64_t) 1) << (a_shr - 1))) >> a_shr;
+    } else {
+      acc = MAX(-INT32_MAX, MIN(INT32_MAX, acc));
+      acc = acc * (((int64_t) 1) << MIN(-a_shr, 31));
+    }
+
+    a[k] = (int32_t) MAX(-INT32_MAX, MIN(INT32_MAX, acc));
+  }
+
+  return vect_s32_headroom(a, lag_count);
+}
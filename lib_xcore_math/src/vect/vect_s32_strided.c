@@ -0,0 +1,297 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xmath/xmath.h"
+
+
+/*
+ * Strided operands are gathered into word-aligned scratch blocks, processed with the ordinary
+ * contiguous kernel (which is VPU-accelerated on xcore), and then scattered back. This keeps the
+ * strided functions bit-exact with their contiguous counterparts.
+ */
+
+#define BLOCK   VECT_S32_STRIDED_BLOCK
+
+
+static inline void gather(
+    int32_t dst[],
+    const int32_t src[],
+    const unsigned stride,
+    const unsigned count)
+{
+  for(unsigned k = 0; k < count; k++)
+    dst[k] = src[k * stride];
+}
+
+
+static inline void scatter(
+    int32_t dst[],
+    const unsigned stride,
+    const int32_t src[],
+    const unsigned count)
+{
+  for(unsigned k = 0; k < count; k++)
+    dst[k * stride] = src[k];
+}
+
+
+headroom_t vect_s32_copy_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length)
+{
+  headroom_t hr = 31;
+  for(unsigned k = 0; k < length; k++){
+    const int32_t v = b[k * b_stride];
+    a[k * a_stride] = v;
+    hr = MIN(hr, (headroom_t) HR_S32(v));
+  }
+  return hr;
+}
+
+
+headroom_t vect_s32_headroom_strided(
+    const int32_t x[],
+    const unsigned x_stride,
+    const unsigned length)
+{
+  if(x_stride == 1)
+    return vect_s32_headroom(x, length);
+
+  int32_t DWORD_ALIGNED buff[BLOCK];
+  headroom_t hr = 31;
+
+  for(unsigned k = 0; k < length; k += BLOCK){
+    const unsigned count = MIN(BLOCK, length - k);
+    gather(buff, &x[k * x_stride], x_stride, count);
+    const headroom_t blk_hr = vect_s32_headroom(buff, count);
+    hr = MIN(hr, blk_hr);
+  }
+
+  return hr;
+}
+
+
+headroom_t vect_s32_shl_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length,
+    const left_shift_t b_shl)
+{
+  if(a_stride == 1 && b_stride == 1)
+    return vect_s32_shl(a, b, length, b_shl);
+
+  int32_t DWORD_ALIGNED buff[BLOCK];
+  headroom_t hr = 31;
+
+  for(unsigned k = 0; k < length; k += BLOCK){
+    const unsigned count = MIN(BLOCK, length - k);
+    gather(buff, &b[k * b_stride], b_stride, count);
+    const headroom_t blk_hr = vect_s32_shl(buff, buff, count, b_shl);
+    hr = MIN(hr, blk_hr);
+    scatter(&a[k * a_stride], a_stride, buff, count);
+  }
+
+  return hr;
+}
+
+
+headroom_t vect_s32_add_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const int32_t c[],
+    const unsigned c_stride,
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+  if(a_stride == 1 && b_stride == 1 && c_stride == 1)
+    return vect_s32_add(a, b, c, length, b_shr, c_shr);
+
+  int32_t DWORD_ALIGNED buff_b[BLOCK];
+  int32_t DWORD_ALIGNED buff_c[BLOCK];
+  headroom_t hr = 31;
+
+  for(unsigned k = 0; k < length; k += BLOCK){
+    const unsigned count = MIN(BLOCK, length - k);
+    gather(buff_b, &b[k * b_stride], b_stride, count);
+    gather(buff_c, &c[k * c_stride], c_stride, count);
+    const headroom_t blk_hr = vect_s32_add(buff_b, buff_b, buff_c, count, b_shr, c_shr);
+    hr = MIN(hr, blk_hr);
+    scatter(&a[k * a_stride], a_stride, buff_b, count);
+  }
+
+  return hr;
+}
+
+
+headroom_t vect_s32_mul_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const int32_t c[],
+    const unsigned c_stride,
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+  if(a_stride == 1 && b_stride == 1 && c_stride == 1)
+    return vect_s32_mul(a, b, c, length, b_shr, c_shr);
+
+  int32_t DWORD_ALIGNED buff_b[BLOCK];
+  int32_t DWORD_ALIGNED buff_c[BLOCK];
+  headroom_t hr = 31;
+
+  for(unsigned k = 0; k < length; k += BLOCK){
+    const unsigned count = MIN(BLOCK, length - k);
+    gather(buff_b, &b[k * b_stride], b_stride, count);
+    gather(buff_c, &c[k * c_stride], c_stride, count);
+    const headroom_t blk_hr = vect_s32_mul(buff_b, buff_b, buff_c, count, b_shr, c_shr);
+    hr = MIN(hr, blk_hr);
+    scatter(&a[k * a_stride], a_stride, buff_b, count);
+  }
+
+  return hr;
+}
+
+
+headroom_t vect_s32_scale_strided(
+    int32_t a[],
+    const unsigned a_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length,
+    const int32_t c,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+  if(a_stride == 1 && b_stride == 1)
+    return vect_s32_scale(a, b, length, c, b_shr, c_shr);
+
+  int32_t DWORD_ALIGNED buff[BLOCK];
+  headroom_t hr = 31;
+
+  for(unsigned k = 0; k < length; k += BLOCK){
+    const unsigned count = MIN(BLOCK, length - k);
+    gather(buff, &b[k * b_stride], b_stride, count);
+    const headroom_t blk_hr = vect_s32_scale(buff, buff, count, c, b_shr, c_shr);
+    hr = MIN(hr, blk_hr);
+    scatter(&a[k * a_stride], a_stride, buff, count);
+  }
+
+  return hr;
+}
+
+
+headroom_t vect_s32_macc_strided(
+    int32_t acc[],
+    const unsigned acc_stride,
+    const int32_t b[],
+    const unsigned b_stride,
+    const int32_t c[],
+    const unsigned c_stride,
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+  if(acc_stride == 1 && b_stride == 1 && c_stride == 1)
+    return vect_s32_macc(acc, b, c, length, acc_shr, b_shr, c_shr);
+
+  int32_t DWORD_ALIGNED buff_a[BLOCK];
+  int32_t DWORD_ALIGNED buff_b[BLOCK];
+  int32_t DWORD_ALIGNED buff_c[BLOCK];
+  headroom_t hr = 31;
+
+  for(unsigned k = 0; k < length; k += BLOCK){
+    const unsigned count = MIN(BLOCK, length - k);
+    gather(buff_a, &acc[k * acc_stride], acc_stride, count);
+    gather(buff_b, &b[k * b_stride], b_stride, count);
+    gather(buff_c, &c[k * c_stride], c_stride, count);
+    const headroom_t blk_hr = vect_s32_macc(buff_a, buff_b, buff_c, count, acc_shr, b_shr, c_shr);
+    hr = MIN(hr, blk_hr);
+    scatter(&acc[k * acc_stride], acc_stride, buff_a, count);
+  }
+
+  return hr;
+}
+
+
+int64_t vect_s32_dot_strided(
+    const int32_t b[],
+    const unsigned b_stride,
+    const int32_t c[],
+    const unsigned c_stride,
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+  if(b_stride == 1 && c_stride == 1)
+    return vect_s32_dot(b, c, length, b_shr, c_shr);
+
+  int32_t DWORD_ALIGNED buff_b[BLOCK];
+  int32_t DWORD_ALIGNED buff_c[BLOCK];
+  int64_t total = 0;
+
+  for(unsigned k = 0; k < length; k += BLOCK){
+    const unsigned count = MIN(BLOCK, length - k);
+    gather(buff_b, &b[k * b_stride], b_stride, count);
+    gather(buff_c, &c[k * c_stride], c_stride, count);
+    total += vect_s32_dot(buff_b, buff_c, count, b_shr, c_shr);
+  }
+
+  return total;
+}
+
+
+int64_t vect_s32_energy_strided(
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length,
+    const right_shift_t b_shr)
+{
+  if(b_stride == 1)
+    return vect_s32_energy(b, length, b_shr);
+
+  int32_t DWORD_ALIGNED buff[BLOCK];
+  int64_t total = 0;
+
+  for(unsigned k = 0; k < length; k += BLOCK){
+    const unsigned count = MIN(BLOCK, length - k);
+    gather(buff, &b[k * b_stride], b_stride, count);
+    total += vect_s32_energy(buff, count, b_shr);
+  }
+
+  return total;
+}
+
+
+int64_t vect_s32_sum_strided(
+    const int32_t b[],
+    const unsigned b_stride,
+    const unsigned length)
+{
+  if(b_stride == 1)
+    return vect_s32_sum(b, length);
+
+  int32_t DWORD_ALIGNED buff[BLOCK];
+  int64_t total = 0;
+
+  for(unsigned k = 0; k < length; k += BLOCK){
+    const unsigned count = MIN(BLOCK, length - k);
+    gather(buff, &b[k * b_stride], b_stride, count);
+    total += vect_s32_sum(buff, count);
+  }
+
+  return total;
+}
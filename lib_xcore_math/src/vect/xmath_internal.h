@@ -0,0 +1,69 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#pragma once
+
+#include "xmath/xmath.h"
+
+/*
+ * Helpers shared between translation units of the library. None of these are part of the API.
+ */
+
+
+/*
+ * The transcendental vector functions do their range reduction element-wise, and then evaluate the
+ * polynomial over a whole block with vect_q30_power_series() (which shares coefficient loads across
+ * each chunk). Blocks are small enough for stack scratch.
+ */
+#define TRANS_BLOCK   (32)
+
+
+// sin(pi/2 * a) for 0 <= a <= 1, with a as a Q1.31 held in 64 bits
+static inline int32_t xmath_quarter_sin(
+    const int64_t a)
+{
+  return (a >= (((int64_t) 1) << 31))? 0x40000000 : sbrad_sin((sbrad_t) a);
+}
+
+
+// exp(-j*2*pi*t/2^32) as a Q2.30, where t is a fraction of a turn as a UQ0.32
+static inline complex_s32_t xmath_turn_phasor(
+    const uint32_t t)
+{
+  // Remainder within the quadrant in quarter turns, as a Q1.31
+  const int64_t r = ((int64_t) (t & 0x3FFFFFFF)) << 1;
+  const int64_t q = ((int64_t) 1) << 31;
+
+  int32_t s, c;
+  switch(t >> 30){
+    case 0:  s =  xmath_quarter_sin(r);      c =  xmath_quarter_sin(q - r);  break;
+    case 1:  s =  xmath_quarter_sin(q - r);  c = -xmath_quarter_sin(r);      break;
+    case 2:  s = -xmath_quarter_sin(r);      c = -xmath_quarter_sin(q - r);  break;
+    default: s = -xmath_quarter_sin(q - r);  c =  xmath_quarter_sin(r);      break;
+  }
+
+  const complex_s32_t w = { c, -s };
+  return w;
+}
+
+
+/*
+ * Computes sqrt(x) for 0 <= x < 2^63 by refining a table estimate of 1/sqrt(x) with `iterations`
+ * Newton-Raphson steps. No division is needed. The result is rounded, and can exceed INT32_MAX.
+ * 
+ * Defined in vect_s32.c.
+ */
+int64_t xmath_s64_sqrt_newton(
+    const int64_t x,
+    const unsigned iterations);
+
+
+/*
+ * Splits e^(b * 2^b_exp) into 2^n * e^z, with z a Q2.30 value in [-ln(2)/2, ln(2)/2]. Returns n.
+ * 
+ * Defined in vect_s32.c.
+ */
+int xmath_exp_reduce(
+    q2_30* z,
+    const int32_t b,
+    const exponent_t b_exp);
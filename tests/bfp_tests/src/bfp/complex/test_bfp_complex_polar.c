@@ -0,0 +1,129 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_complex_polar) {
+  RUN_TEST_CASE(bfp_complex_polar, bfp_complex_s32_to_polar);
+  RUN_TEST_CASE(bfp_complex_polar, bfp_polar_to_complex_s32);
+}
+
+TEST_GROUP(bfp_complex_polar);
+TEST_SETUP(bfp_complex_polar) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_complex_polar) {}
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (128)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (512)
+#endif
+
+
+TEST(bfp_complex_polar, bfp_complex_s32_to_polar)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t DWORD_ALIGNED B_data[MAX_LEN];
+  int32_t DWORD_ALIGNED mag_data[MAX_LEN];
+  int32_t DWORD_ALIGNED angle_data[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    bfp_complex_s32_t B;
+    bfp_s32_t mag, angle;
+
+    bfp_complex_s32_init(&B, B_data, pseudo_rand_int(&seed, -30, 30),
+                         pseudo_rand_uint(&seed, 1, MAX_LEN+1), 0);
+    bfp_s32_init(&mag, mag_data, 0, B.length, 0);
+    bfp_s32_init(&angle, angle_data, 0, B.length, 0);
+
+    B.hr = pseudo_rand_uint(&seed, 0, 8);
+    for(unsigned int i = 0; i < B.length; i++){
+      B.data[i].re = pseudo_rand_int32(&seed) >> B.hr;
+      B.data[i].im = pseudo_rand_int32(&seed) >> B.hr;
+    }
+    bfp_complex_s32_headroom(&B);
+
+    bfp_complex_s32_to_polar(&mag, &angle, &B);
+
+    TEST_ASSERT_EQUAL(vect_s32_headroom(mag.data, mag.length), mag.hr);
+    TEST_ASSERT_EQUAL(vect_s32_headroom(angle.data, angle.length), angle.hr);
+    TEST_ASSERT_EQUAL(-24, angle.exp);
+
+    for(unsigned int i = 0; i < B.length; i++){
+      const double re = ldexp(B.data[i].re, B.exp);
+      const double im = ldexp(B.data[i].im, B.exp);
+
+      const double expected_mag = hypot(re, im);
+      TEST_ASSERT_INT32_WITHIN(4, 0, (int32_t) ldexp(ldexp(mag.data[i], mag.exp) - expected_mag,
+                                                    -mag.exp));
+
+      if(B.data[i].re == 0 && B.data[i].im == 0)
+        continue;
+
+      const double diff = remainder(ldexp(angle.data[i], -24) - atan2(im, re), 2 * M_PI);
+      TEST_ASSERT_INT32_WITHIN(4, 0, (int32_t) ldexp(diff, 24));
+    }
+  }
+}
+
+
+// Converting to polar form and back must recover the original vector.
+TEST(bfp_complex_polar, bfp_polar_to_complex_s32)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t DWORD_ALIGNED B_data[MAX_LEN];
+  complex_s32_t DWORD_ALIGNED A_data[MAX_LEN];
+  int32_t DWORD_ALIGNED mag_data[MAX_LEN];
+  int32_t DWORD_ALIGNED angle_data[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    bfp_complex_s32_t A, B;
+    bfp_s32_t mag, angle;
+
+    bfp_complex_s32_init(&B, B_data, pseudo_rand_int(&seed, -30, 30),
+                         pseudo_rand_uint(&seed, 1, MAX_LEN+1), 0);
+    bfp_complex_s32_init(&A, A_data, 0, B.length, 0);
+    bfp_s32_init(&mag, mag_data, 0, B.length, 0);
+    bfp_s32_init(&angle, angle_data, 0, B.length, 0);
+
+    B.hr = pseudo_rand_uint(&seed, 0, 8);
+    for(unsigned int i = 0; i < B.length; i++){
+      B.data[i].re = pseudo_rand_int32(&seed) >> B.hr;
+      B.data[i].im = pseudo_rand_int32(&seed) >> B.hr;
+    }
+    bfp_complex_s32_headroom(&B);
+
+    bfp_complex_s32_to_polar(&mag, &angle, &B);
+    bfp_polar_to_complex_s32(&A, &mag, &angle);
+
+    TEST_ASSERT_EQUAL(vect_complex_s32_headroom(A.data, A.length), A.hr);
+
+    // Relative to the largest element, the error comes from the Q8.24 angle resolution.
+    const double scale = ldexp(1, B.exp + 31 - B.hr);
+
+    for(unsigned int i = 0; i < B.length; i++){
+      const double re_err = ldexp(A.data[i].re, A.exp) - ldexp(B.data[i].re, B.exp);
+      const double im_err = ldexp(A.data[i].im, A.exp) - ldexp(B.data[i].im, B.exp);
+      TEST_ASSERT_INT32_WITHIN(64, 0, (int32_t) ldexp(re_err / scale, 24));
+      TEST_ASSERT_INT32_WITHIN(64, 0, (int32_t) ldexp(im_err / scale, 24));
+    }
+  }
+}
@@ -0,0 +1,535 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_mat) {
+  RUN_TEST_CASE(bfp_mat, bfp_mat_s32_transpose);
+  RUN_TEST_CASE(bfp_mat, bfp_mat_complex_s32_transpose);
+  RUN_TEST_CASE(bfp_mat, bfp_mat_complex_s32_hermitian);
+  RUN_TEST_CASE(bfp_mat, bfp_mat_s32_mul_vect);
+  RUN_TEST_CASE(bfp_mat, bfp_mat_complex_s32_mul_vect);
+  RUN_TEST_CASE(bfp_mat, bfp_mat_s32_mul);
+  RUN_TEST_CASE(bfp_mat, bfp_mat_complex_s32_mul);
+  RUN_TEST_CASE(bfp_mat, bfp_mat_complex_s32_cholesky_batch);
+  RUN_TEST_CASE(bfp_mat, bfp_mat_complex_s32_cholesky_solve_batch);
+}
+
+TEST_GROUP(bfp_mat);
+TEST_SETUP(bfp_mat) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_mat) {}
+
+#if SMOKE_TEST
+#  define REPS       (50)
+#  define MAX_DIM    (20)
+#else
+#  define REPS       (500)
+#  define MAX_DIM    (48)
+#endif
+
+#define MAX_ELMS  (MAX_DIM * MAX_DIM)
+
+// Rounding of each product plus rounding of the final 64-to-32-bit reduction
+#define THRESHOLD   (2)
+
+
+TEST(bfp_mat, bfp_mat_s32_transpose)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t dataA[MAX_ELMS];
+  int32_t dataB[MAX_ELMS];
+  bfp_mat_s32_t A, B;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned M = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+
+    test_random_vect_s32(dataB, &seed, M*N, M*N, 0, 20);
+    bfp_mat_s32_init(&B, dataB, pseudo_rand_int(&seed, -30, 30), M, N, 1);
+    bfp_mat_s32_init(&A, dataA, 0, N, M, 0);
+
+    bfp_mat_s32_transpose(&A, &B);
+
+    TEST_ASSERT_EQUAL(B.exp, A.exp);
+    TEST_ASSERT_EQUAL(B.hr, A.hr);
+
+    for(unsigned i = 0; i < M; i++)
+      for(unsigned j = 0; j < N; j++)
+        TEST_ASSERT_EQUAL_INT32(dataB[i*N + j], dataA[j*M + i]);
+  }
+}
+
+
+TEST(bfp_mat, bfp_mat_complex_s32_transpose)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t dataA[MAX_ELMS];
+  complex_s32_t dataB[MAX_ELMS];
+  bfp_mat_complex_s32_t A, B;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned M = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+
+    test_random_vect_complex_s32(dataB, &seed, M*N, M*N, 0, 20);
+    bfp_mat_complex_s32_init(&B, dataB, pseudo_rand_int(&seed, -30, 30), M, N, 1);
+    bfp_mat_complex_s32_init(&A, dataA, 0, N, M, 0);
+
+    bfp_mat_complex_s32_transpose(&A, &B);
+
+    TEST_ASSERT_EQUAL(B.exp, A.exp);
+    TEST_ASSERT_EQUAL(B.hr, A.hr);
+
+    for(unsigned i = 0; i < M; i++){
+      for(unsigned j = 0; j < N; j++){
+        TEST_ASSERT_EQUAL_INT32(dataB[i*N + j].re, dataA[j*M + i].re);
+        TEST_ASSERT_EQUAL_INT32(dataB[i*N + j].im, dataA[j*M + i].im);
+      }
+    }
+  }
+}
+
+
+TEST(bfp_mat, bfp_mat_complex_s32_hermitian)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t dataA[MAX_ELMS];
+  complex_s32_t dataB[MAX_ELMS];
+  bfp_mat_complex_s32_t A, B;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned M = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+
+    test_random_vect_complex_s32(dataB, &seed, M*N, M*N, 0, 20);
+
+    // Exercise the saturating negation
+    if(r % 4 == 0)
+      dataB[pseudo_rand_uint(&seed, 0, M*N)].im = INT32_MIN;
+
+    bfp_mat_complex_s32_init(&B, dataB, pseudo_rand_int(&seed, -30, 30), M, N, 1);
+    bfp_mat_complex_s32_init(&A, dataA, 0, N, M, 0);
+
+    bfp_mat_complex_s32_hermitian(&A, &B);
+
+    TEST_ASSERT_EQUAL(B.exp, A.exp);
+    TEST_ASSERT_EQUAL(vect_complex_s32_headroom(dataA, M*N), A.hr);
+
+    for(unsigned i = 0; i < M; i++){
+      for(unsigned j = 0; j < N; j++){
+        const int32_t im = dataB[i*N + j].im;
+        TEST_ASSERT_EQUAL_INT32(dataB[i*N + j].re, dataA[j*M + i].re);
+        TEST_ASSERT_EQUAL_INT32((im == INT32_MIN)? INT32_MAX : -im, dataA[j*M + i].im);
+      }
+    }
+  }
+}
+
+
+TEST(bfp_mat, bfp_mat_s32_mul_vect)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t dataA[MAX_DIM];
+  int32_t dataB[MAX_ELMS];
+  int32_t dataC[MAX_DIM];
+  int32_t expected[MAX_DIM];
+  double Af[MAX_DIM];
+
+  bfp_s32_t A, C;
+  bfp_mat_s32_t B;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned M = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+
+    test_random_vect_s32(dataB, &seed, M*N, M*N, 0, 12);
+    test_random_vect_s32(dataC, &seed, N, N, 0, 12);
+    bfp_mat_s32_init(&B, dataB, pseudo_rand_int(&seed, -30, 30), M, N, 1);
+    bfp_s32_init(&C, dataC, pseudo_rand_int(&seed, -30, 30), N, 1);
+    bfp_s32_init(&A, dataA, 0, M, 0);
+
+    for(unsigned i = 0; i < M; i++){
+      Af[i] = 0;
+      for(unsigned k = 0; k < N; k++)
+        Af[i] += ldexp(dataB[i*N + k], B.exp) * ldexp(dataC[k], C.exp);
+    }
+
+    bfp_mat_s32_mul_vect(&A, &B, &C);
+
+    TEST_ASSERT_EQUAL(vect_s32_headroom(dataA, M), A.hr);
+
+    test_s32_from_double(expected, Af, M, A.exp);
+
+    for(unsigned i = 0; i < M; i++)
+      TEST_ASSERT_INT32_WITHIN(THRESHOLD, expected[i], A.data[i]);
+  }
+}
+
+
+TEST(bfp_mat, bfp_mat_complex_s32_mul_vect)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t dataA[MAX_DIM];
+  complex_s32_t dataB[MAX_ELMS];
+  complex_s32_t dataC[MAX_DIM];
+  complex_s32_t expected[MAX_DIM];
+  double Af_re[MAX_DIM];
+  double Af_im[MAX_DIM];
+
+  bfp_complex_s32_t A, C;
+  bfp_mat_complex_s32_t B;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned M = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+
+    test_random_vect_complex_s32(dataB, &seed, M*N, M*N, 0, 12);
+    test_random_vect_complex_s32(dataC, &seed, N, N, 0, 12);
+    bfp_mat_complex_s32_init(&B, dataB, pseudo_rand_int(&seed, -30, 30), M, N, 1);
+    bfp_complex_s32_init(&C, dataC, pseudo_rand_int(&seed, -30, 30), N, 1);
+    bfp_complex_s32_init(&A, dataA, 0, M, 0);
+
+    for(unsigned i = 0; i < M; i++){
+      Af_re[i] = 0;
+      Af_im[i] = 0;
+      for(unsigned k = 0; k < N; k++){
+        const double b_re = ldexp(dataB[i*N + k].re, B.exp);
+        const double b_im = ldexp(dataB[i*N + k].im, B.exp);
+        const double c_re = ldexp(dataC[k].re, C.exp);
+        const double c_im = ldexp(dataC[k].im, C.exp);
+        Af_re[i] += b_re * c_re - b_im * c_im;
+        Af_im[i] += b_re * c_im + b_im * c_re;
+      }
+    }
+
+    bfp_mat_complex_s32_mul_vect(&A, &B, &C);
+
+    TEST_ASSERT_EQUAL(vect_complex_s32_headroom(dataA, M), A.hr);
+
+    test_complex_s32_from_double(expected, Af_re, Af_im, M, A.exp);
+
+    for(unsigned i = 0; i < M; i++){
+      TEST_ASSERT_INT32_WITHIN(THRESHOLD, expected[i].re, A.data[i].re);
+      TEST_ASSERT_INT32_WITHIN(THRESHOLD, expected[i].im, A.data[i].im);
+    }
+  }
+}
+
+
+TEST(bfp_mat, bfp_mat_s32_mul)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t dataA[MAX_ELMS];
+  int32_t dataB[MAX_ELMS];
+  int32_t dataC[MAX_ELMS];
+  int32_t expected[MAX_ELMS];
+  double Af[MAX_ELMS];
+
+  bfp_mat_s32_t A, B, C;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned M = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+    const unsigned K = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+
+    test_random_vect_s32(dataB, &seed, M*K, M*K, 0, 12);
+    test_random_vect_s32(dataC, &seed, K*N, K*N, 0, 12);
+    bfp_mat_s32_init(&B, dataB, pseudo_rand_int(&seed, -30, 30), M, K, 1);
+    bfp_mat_s32_init(&C, dataC, pseudo_rand_int(&seed, -30, 30), K, N, 1);
+    bfp_mat_s32_init(&A, dataA, 0, M, N, 0);
+
+    for(unsigned i = 0; i < M; i++){
+      for(unsigned j = 0; j < N; j++){
+        Af[i*N + j] = 0;
+        for(unsigned k = 0; k < K; k++)
+          Af[i*N + j] += ldexp(dataB[i*K + k], B.exp) * ldexp(dataC[k*N + j], C.exp);
+      }
+    }
+
+    bfp_mat_s32_mul(&A, &B, &C);
+
+    TEST_ASSERT_EQUAL(M, A.rows);
+    TEST_ASSERT_EQUAL(N, A.cols);
+    TEST_ASSERT_EQUAL(vect_s32_headroom(dataA, M*N), A.hr);
+
+    test_s32_from_double(expected, Af, M*N, A.exp);
+
+    for(unsigned i = 0; i < M*N; i++)
+      TEST_ASSERT_INT32_WITHIN(THRESHOLD, expected[i], A.data[i]);
+  }
+}
+
+
+TEST(bfp_mat, bfp_mat_complex_s32_mul)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t dataA[MAX_ELMS];
+  complex_s32_t dataB[MAX_ELMS];
+  complex_s32_t dataC[MAX_ELMS];
+  complex_s32_t expected[MAX_ELMS];
+  double Af_re[MAX_ELMS];
+  double Af_im[MAX_ELMS];
+
+  bfp_mat_complex_s32_t A, B, C;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned M = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+    const unsigned K = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_DIM+1);
+
+    test_random_vect_complex_s32(dataB, &seed, M*K, M*K, 0, 12);
+    test_random_vect_complex_s32(dataC, &seed, K*N, K*N, 0, 12);
+    bfp_mat_complex_s32_init(&B, dataB, pseudo_rand_int(&seed, -30, 30), M, K, 1);
+    bfp_mat_complex_s32_init(&C, dataC, pseudo_rand_int(&seed, -30, 30), K, N, 1);
+    bfp_mat_complex_s32_init(&A, dataA, 0, M, N, 0);
+
+    for(unsigned i = 0; i < M; i++){
+      for(unsigned j = 0; j < N; j++){
+        Af_re[i*N + j] = 0;
+        Af_im[i*N + j] = 0;
+        for(unsigned k = 0; k < K; k++){
+          const double b_re = ldexp(dataB[i*K + k].re, B.exp);
+          const double b_im = ldexp(dataB[i*K + k].im, B.exp);
+          const double c_re = ldexp(dataC[k*N + j].re, C.exp);
+          const double c_im = ldexp(dataC[k*N + j].im, C.exp);
+          Af_re[i*N + j] += b_re * c_re - b_im * c_im;
+          Af_im[i*N + j] += b_re * c_im + b_im * c_re;
+        }
+      }
+    }
+
+    bfp_mat_complex_s32_mul(&A, &B, &C);
+
+    TEST_ASSERT_EQUAL(vect_complex_s32_headroom(dataA, M*N), A.hr);
+
+    test_complex_s32_from_double(expected, Af_re, Af_im, M*N, A.exp);
+
+    for(unsigned i = 0; i < M*N; i++){
+      TEST_ASSERT_INT32_WITHIN(THRESHOLD, expected[i].re, A.data[i].re);
+      TEST_ASSERT_INT32_WITHIN(THRESHOLD, expected[i].im, A.data[i].im);
+    }
+  }
+}
+
+
+#define MAX_CHOL_DIM    (8)
+#define MAX_BINS        (40)
+
+
+/*
+ * Fills `R` with `count` random well-conditioned Hermitian positive-definite matrices, each with a
+ * random scale, and returns their mantissas with one exponent per matrix.
+ */
+static void random_hpd_batch(
+    bfp_mat_complex_s32_batch_t* R,
+    double R_re[],
+    double R_im[],
+    unsigned* seed)
+{
+  const unsigned N = R->rows;
+  const unsigned count = R->count;
+
+  double A_re[MAX_CHOL_DIM * MAX_CHOL_DIM];
+  double A_im[MAX_CHOL_DIM * MAX_CHOL_DIM];
+
+  for(unsigned b = 0; b < count; b++){
+    const double scale = ldexp(1.0, pseudo_rand_int(seed, -30, 30));
+
+    for(unsigned k = 0; k < N*N; k++){
+      A_re[k] = ldexp(pseudo_rand_int32(seed), -31);
+      A_im[k] = ldexp(pseudo_rand_int32(seed), -31);
+    }
+
+    // R = scale * (A * A^H + N * I)
+    double max_mag = 0;
+    for(unsigned i = 0; i < N; i++){
+      for(unsigned j = 0; j < N; j++){
+        double re = (i == j)? N : 0;
+        double im = 0;
+        for(unsigned k = 0; k < N; k++){
+          re += A_re[i*N+k] * A_re[j*N+k] + A_im[i*N+k] * A_im[j*N+k];
+          im += A_im[i*N+k] * A_re[j*N+k] - A_re[i*N+k] * A_im[j*N+k];
+        }
+        R_re[(i*N + j)*count + b] = scale * re;
+        R_im[(i*N + j)*count + b] = scale * im;
+        max_mag = MAX(max_mag, MAX(fabs(scale * re), fabs(scale * im)));
+      }
+    }
+
+    // Random headroom on top of the per-matrix exponent
+    int e;
+    frexp(max_mag, &e);
+    R->exp[b] = e - 31 + pseudo_rand_int(seed, 0, 6);
+
+    for(unsigned k = 0; k < N*N; k++){
+      R->data[k*count + b].re = (int32_t) round(ldexp(R_re[k*count + b], -R->exp[b]));
+      R->data[k*count + b].im = (int32_t) round(ldexp(R_im[k*count + b], -R->exp[b]));
+    }
+  }
+}
+
+
+TEST(bfp_mat, bfp_mat_complex_s32_cholesky_batch)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t dataR[MAX_CHOL_DIM * MAX_CHOL_DIM * MAX_BINS];
+  complex_s32_t dataL[MAX_CHOL_DIM * MAX_CHOL_DIM * MAX_BINS];
+  exponent_t expR[MAX_BINS];
+  exponent_t expL[MAX_BINS];
+  double R_re[MAX_CHOL_DIM * MAX_CHOL_DIM * MAX_BINS];
+  double R_im[MAX_CHOL_DIM * MAX_CHOL_DIM * MAX_BINS];
+
+  bfp_mat_complex_s32_batch_t R, L;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_CHOL_DIM+1);
+    const unsigned count = pseudo_rand_uint(&seed, 1, MAX_BINS+1);
+
+    bfp_mat_complex_s32_batch_init(&R, dataR, expR, N, N, count);
+    bfp_mat_complex_s32_batch_init(&L, dataL, expL, N, N, count);
+
+    random_hpd_batch(&R, R_re, R_im, &seed);
+
+    // Alternate between out-of-place and in-place
+    bfp_mat_complex_s32_batch_t* out = (r & 1)? &R : &L;
+    bfp_mat_complex_s32_cholesky_batch(out, &R);
+
+    for(unsigned b = 0; b < count; b++){
+      double norm = 0;
+      for(unsigned i = 0; i < N; i++)
+        norm = MAX(norm, R_re[(i*N + i)*count + b]);
+
+      for(unsigned i = 0; i < N; i++){
+        for(unsigned j = 0; j < N; j++){
+          const complex_s32_t l_ij = out->data[(i*N + j)*count + b];
+
+          if(j > i){
+            TEST_ASSERT_EQUAL_INT32(0, l_ij.re);
+            TEST_ASSERT_EQUAL_INT32(0, l_ij.im);
+            continue;
+          }
+          if(j == i){
+            TEST_ASSERT_GREATER_THAN_INT32(0, l_ij.re);
+            TEST_ASSERT_EQUAL_INT32(0, l_ij.im);
+          }
+
+          // (L * L^H)_ij
+          double re = 0, im = 0;
+          for(unsigned k = 0; k <= j; k++){
+            const complex_s32_t p = out->data[(i*N + k)*count + b];
+            const complex_s32_t q = out->data[(j*N + k)*count + b];
+            re += ldexp((double) p.re * q.re + (double) p.im * q.im, 2*out->exp[b]);
+            im += ldexp((double) p.im * q.re - (double) p.re * q.im, 2*out->exp[b]);
+          }
+
+          TEST_ASSERT_DOUBLE_WITHIN(norm * 1e-6, R_re[(i*N + j)*count + b], re);
+          TEST_ASSERT_DOUBLE_WITHIN(norm * 1e-6, R_im[(i*N + j)*count + b], im);
+        }
+      }
+    }
+  }
+}
+
+
+TEST(bfp_mat, bfp_mat_complex_s32_cholesky_solve_batch)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t dataR[MAX_CHOL_DIM * MAX_CHOL_DIM * MAX_BINS];
+  complex_s32_t dataY[MAX_CHOL_DIM * MAX_BINS];
+  complex_s32_t dataX[MAX_CHOL_DIM * MAX_BINS];
+  exponent_t expR[MAX_BINS];
+  exponent_t expY[MAX_BINS];
+  exponent_t expX[MAX_BINS];
+  double R_re[MAX_CHOL_DIM * MAX_CHOL_DIM * MAX_BINS];
+  double R_im[MAX_CHOL_DIM * MAX_CHOL_DIM * MAX_BINS];
+  double Y_re[MAX_CHOL_DIM * MAX_BINS];
+  double Y_im[MAX_CHOL_DIM * MAX_BINS];
+
+  bfp_mat_complex_s32_batch_t R, Y, X;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_CHOL_DIM+1);
+    const unsigned count = pseudo_rand_uint(&seed, 1, MAX_BINS+1);
+
+    bfp_mat_complex_s32_batch_init(&R, dataR, expR, N, N, count);
+    bfp_mat_complex_s32_batch_init(&Y, dataY, expY, N, 1, count);
+    bfp_mat_complex_s32_batch_init(&X, dataX, expX, N, 1, count);
+
+    random_hpd_batch(&R, R_re, R_im, &seed);
+
+    for(unsigned b = 0; b < count; b++){
+      expY[b] = pseudo_rand_int(&seed, -40, 0);
+      for(unsigned i = 0; i < N; i++){
+        dataY[i*count + b].re = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 8);
+        dataY[i*count + b].im = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 8);
+        Y_re[i*count + b] = ldexp(dataY[i*count + b].re, expY[b]);
+        Y_im[i*count + b] = ldexp(dataY[i*count + b].im, expY[b]);
+      }
+    }
+
+    bfp_mat_complex_s32_cholesky_batch(&R, &R);
+
+    // Alternate between out-of-place and in-place
+    bfp_mat_complex_s32_batch_t* out = (r & 1)? &Y : &X;
+    bfp_mat_complex_s32_cholesky_solve_batch(out, &R, &Y);
+
+    for(unsigned b = 0; b < count; b++){
+      double y_norm = 0;
+      for(unsigned i = 0; i < N; i++)
+        y_norm = MAX(y_norm, MAX(fabs(Y_re[i*count + b]), fabs(Y_im[i*count + b])));
+
+      // R * x should reproduce y
+      for(unsigned i = 0; i < N; i++){
+        double re = 0, im = 0;
+        for(unsigned j = 0; j < N; j++){
+          const double r_re = R_re[(i*N + j)*count + b];
+          const double r_im = R_im[(i*N + j)*count + b];
+          const double x_re = ldexp(out->data[j*count + b].re, out->exp[b]);
+          const double x_im = ldexp(out->data[j*count + b].im, out->exp[b]);
+          re += r_re * x_re - r_im * x_im;
+          im += r_re * x_im + r_im * x_re;
+        }
+        TEST_ASSERT_DOUBLE_WITHIN(y_norm * 1e-5, Y_re[i*count + b], re);
+        TEST_ASSERT_DOUBLE_WITHIN(y_norm * 1e-5, Y_im[i*count + b], im);
+      }
+    }
+  }
+}
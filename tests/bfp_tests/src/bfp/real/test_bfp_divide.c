@@ -0,0 +1,82 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdarg.h>
+
+#include "xmath/xmath.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_divide) {
+  RUN_TEST_CASE(bfp_divide, bfp_s32_divide);
+}
+
+TEST_GROUP(bfp_divide);
+TEST_SETUP(bfp_divide) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_divide) {}
+
+
+#define MAX_LEN     30
+#define REPS        30
+
+
+TEST(bfp_divide, bfp_s32_divide)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t A_data[MAX_LEN];
+    int32_t B_data[MAX_LEN];
+    int32_t C_data[MAX_LEN];
+
+
+    for(unsigned int v = 0; v < REPS; v++){
+        setExtraInfo_RS(v, seed);
+
+        bfp_s32_t A, B, C;
+
+        bfp_s32_init(&B, B_data,
+                          pseudo_rand_int(&seed, -30, 30),
+                          pseudo_rand_uint(&seed, 1, MAX_LEN-1), 0);
+        bfp_s32_init(&C, C_data, pseudo_rand_int(&seed, -30, 30), B.length, 0);
+        bfp_s32_init(&A, A_data, 0, B.length, 0);
+
+        B.hr = pseudo_rand_uint(&seed, 0, 28);
+        C.hr = pseudo_rand_uint(&seed, 0, 28);
+
+        for(unsigned int i = 0; i < B.length; i++){
+            B.data[i] = pseudo_rand_int32(&seed) >> B.hr;
+            C.data[i] = pseudo_rand_int32(&seed) >> C.hr;
+            if( C.data[i] == 0 )
+                C.data[i] = 1;
+        }
+
+        bfp_s32_headroom(&B);
+        bfp_s32_headroom(&C);
+
+        bfp_s32_divide(&A, &B, &C);
+
+        TEST_ASSERT_EQUAL(vect_s32_headroom(A.data, A.length), A.hr);
+
+        double expected_flt[MAX_LEN];
+
+        for(unsigned int i = 0; i < B.length; i++){
+            expected_flt[i] = ldexp(B.data[i], B.exp) / ldexp(C.data[i], C.exp);
+        }
+
+        int32_t expected[MAX_LEN];
+
+        test_s32_from_double(expected, expected_flt, A.length, A.exp);
+
+        for(unsigned int i = 0; i < B.length; i++){
+            TEST_ASSERT_INT32_WITHIN(1, expected[i], A.data[i]);
+        }
+    }
+}
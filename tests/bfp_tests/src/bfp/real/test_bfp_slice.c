@@ -0,0 +1,192 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xmath/xmath.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_slice) {
+  RUN_TEST_CASE(bfp_slice, bfp_s32_slice);
+  RUN_TEST_CASE(bfp_slice, bfp_s32_merge_slice);
+  RUN_TEST_CASE(bfp_slice, bfp_complex_s32_slice);
+  RUN_TEST_CASE(bfp_slice, bfp_complex_s32_merge_slice);
+}
+
+TEST_GROUP(bfp_slice);
+TEST_SETUP(bfp_slice) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_slice) {}
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (128)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (512)
+#endif
+
+
+TEST(bfp_slice, bfp_s32_slice)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t dataA[MAX_LEN];
+  bfp_s32_t A, S;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    const unsigned start = pseudo_rand_uint(&seed, 0, len);
+    const unsigned slice_len = pseudo_rand_uint(&seed, 1, len - start + 1);
+
+    test_random_vect_s32(dataA, &seed, len, len, 0, 20);
+    bfp_s32_init(&A, dataA, pseudo_rand_int(&seed, -30, 30), len, 1);
+
+    bfp_s32_slice(&S, &A, start, slice_len);
+
+    TEST_ASSERT_POINTERS_EQUAL(&dataA[start], S.data);
+    TEST_ASSERT_EQUAL(slice_len, S.length);
+    TEST_ASSERT_EQUAL(A.exp, S.exp);
+    TEST_ASSERT_LESS_OR_EQUAL(vect_s32_headroom(S.data, S.length), S.hr);
+    TEST_ASSERT_EQUAL(0, S.flags);
+
+    // A view never owns its buffer
+    bfp_s32_dealloc(&S);
+    TEST_ASSERT_POINTERS_EQUAL(&dataA[start], S.data);
+  }
+}
+
+
+TEST(bfp_slice, bfp_s32_merge_slice)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t dataA[MAX_LEN];
+  int32_t expected[MAX_LEN];
+  double Af[MAX_LEN];
+  bfp_s32_t A, S;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    const unsigned start = pseudo_rand_uint(&seed, 0, len);
+    const unsigned slice_len = pseudo_rand_uint(&seed, 1, len - start + 1);
+
+    test_random_vect_s32(dataA, &seed, len, len, 0, 20);
+    bfp_s32_init(&A, dataA, pseudo_rand_int(&seed, -30, 30), len, 1);
+
+    // Random gain, which may push the slice's exponent up or down
+    const float_s32_t gain = {
+      pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 20),
+      pseudo_rand_int(&seed, -40, 10) };
+
+    for(unsigned k = 0; k < len; k++){
+      Af[k] = ldexp(dataA[k], A.exp);
+      if(k >= start && k < start + slice_len)
+        Af[k] *= ldexp(gain.mant, gain.exp);
+    }
+
+    bfp_s32_slice(&S, &A, start, slice_len);
+    bfp_s32_scale(&S, &S, gain);
+
+    bfp_s32_merge_slice(&A, &S);
+
+    TEST_ASSERT_EQUAL(A.exp, S.exp);
+    TEST_ASSERT_LESS_OR_EQUAL(vect_s32_headroom(A.data, A.length), A.hr);
+    TEST_ASSERT_LESS_OR_EQUAL(vect_s32_headroom(S.data, S.length), S.hr);
+
+    test_s32_from_double(expected, Af, len, A.exp);
+
+    for(unsigned k = 0; k < len; k++)
+      TEST_ASSERT_INT32_WITHIN(2, expected[k], A.data[k]);
+  }
+}
+
+
+TEST(bfp_slice, bfp_complex_s32_slice)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t dataA[MAX_LEN];
+  bfp_complex_s32_t A, S;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    const unsigned start = pseudo_rand_uint(&seed, 0, len);
+    const unsigned slice_len = pseudo_rand_uint(&seed, 1, len - start + 1);
+
+    test_random_vect_complex_s32(dataA, &seed, len, len, 0, 20);
+    bfp_complex_s32_init(&A, dataA, pseudo_rand_int(&seed, -30, 30), len, 1);
+
+    bfp_complex_s32_slice(&S, &A, start, slice_len);
+
+    TEST_ASSERT_POINTERS_EQUAL(&dataA[start], S.data);
+    TEST_ASSERT_EQUAL(slice_len, S.length);
+    TEST_ASSERT_EQUAL(A.exp, S.exp);
+    TEST_ASSERT_LESS_OR_EQUAL(vect_complex_s32_headroom(S.data, S.length), S.hr);
+    TEST_ASSERT_EQUAL(0, S.flags);
+  }
+}
+
+
+TEST(bfp_slice, bfp_complex_s32_merge_slice)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t dataA[MAX_LEN];
+  complex_s32_t expected[MAX_LEN];
+  double Af_re[MAX_LEN];
+  double Af_im[MAX_LEN];
+  bfp_complex_s32_t A, S;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    const unsigned start = pseudo_rand_uint(&seed, 0, len);
+    const unsigned slice_len = pseudo_rand_uint(&seed, 1, len - start + 1);
+
+    test_random_vect_complex_s32(dataA, &seed, len, len, 0, 20);
+    bfp_complex_s32_init(&A, dataA, pseudo_rand_int(&seed, -30, 30), len, 1);
+
+    const float_s32_t gain = {
+      pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 20),
+      pseudo_rand_int(&seed, -40, 10) };
+
+    for(unsigned k = 0; k < len; k++){
+      Af_re[k] = ldexp(dataA[k].re, A.exp);
+      Af_im[k] = ldexp(dataA[k].im, A.exp);
+      if(k >= start && k < start + slice_len){
+        Af_re[k] *= ldexp(gain.mant, gain.exp);
+        Af_im[k] *= ldexp(gain.mant, gain.exp);
+      }
+    }
+
+    bfp_complex_s32_slice(&S, &A, start, slice_len);
+    bfp_complex_s32_real_scale(&S, &S, gain);
+
+    bfp_complex_s32_merge_slice(&A, &S);
+
+    TEST_ASSERT_EQUAL(A.exp, S.exp);
+    TEST_ASSERT_LESS_OR_EQUAL(vect_complex_s32_headroom(A.data, A.length), A.hr);
+
+    test_complex_s32_from_double(expected, Af_re, Af_im, len, A.exp);
+
+    for(unsigned k = 0; k < len; k++){
+      TEST_ASSERT_INT32_WITHIN(2, expected[k].re, A.data[k].re);
+      TEST_ASSERT_INT32_WITHIN(2, expected[k].im, A.data[k].im);
+    }
+  }
+}
@@ -0,0 +1,95 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_softmax) {
+  RUN_TEST_CASE(bfp_softmax, bfp_s32_softmax);
+  RUN_TEST_CASE(bfp_softmax, bfp_s32_softmax_large_inputs);
+}
+
+TEST_GROUP(bfp_softmax);
+TEST_SETUP(bfp_softmax) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_softmax) {}
+
+#define MAX_LEN     64
+#define REPS        100
+
+
+TEST(bfp_softmax, bfp_s32_softmax)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t DWORD_ALIGNED B_data[MAX_LEN];
+  int32_t DWORD_ALIGNED A_data[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    bfp_s32_t A, B;
+
+    // Inputs span up to (-16, 16)
+    bfp_s32_init(&B, B_data, -27 - pseudo_rand_int(&seed, 0, 8),
+                 pseudo_rand_uint(&seed, 1, MAX_LEN+1), 0);
+    bfp_s32_init(&A, A_data, 0, B.length, 0);
+
+    B.hr = pseudo_rand_uint(&seed, 0, 4);
+    for(unsigned int i = 0; i < B.length; i++)
+      B.data[i] = pseudo_rand_int32(&seed) >> B.hr;
+    bfp_s32_headroom(&B);
+
+    double expected[MAX_LEN];
+    double b_max = -INFINITY;
+    for(unsigned int i = 0; i < B.length; i++)
+      b_max = fmax(b_max, ldexp(B.data[i], B.exp));
+
+    double total = 0;
+    for(unsigned int i = 0; i < B.length; i++){
+      expected[i] = exp(ldexp(B.data[i], B.exp) - b_max);
+      total += expected[i];
+    }
+
+    bfp_s32_softmax(&A, &B);
+
+    TEST_ASSERT_EQUAL(vect_s32_headroom(A.data, A.length), A.hr);
+
+    double sum = 0;
+    for(unsigned int i = 0; i < A.length; i++){
+      const double result = ldexp(A.data[i], A.exp);
+      sum += result;
+      TEST_ASSERT_DOUBLE_WITHIN(1e-7, expected[i] / total, result);
+    }
+
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, 1.0, sum);
+  }
+}
+
+
+// Inputs whose exponentials overflow any fixed format must still give a valid distribution.
+TEST(bfp_softmax, bfp_s32_softmax_large_inputs)
+{
+  // 2^26, 2^26 - 1, -2^26, 0
+  int32_t DWORD_ALIGNED data[4] = { 0x40000000, 0x3FFFFFF0, -0x40000000, 0 };
+
+  bfp_s32_t A;
+  bfp_s32_init(&A, data, -4, 4, 1);
+
+  // In-place
+  bfp_s32_softmax(&A, &A);
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-7, 1.0 / (1.0 + exp(-1.0)), ldexp(A.data[0], A.exp));
+  TEST_ASSERT_DOUBLE_WITHIN(1e-7, exp(-1.0) / (1.0 + exp(-1.0)), ldexp(A.data[1], A.exp));
+  TEST_ASSERT_EQUAL_INT32(0, A.data[2]);
+  TEST_ASSERT_EQUAL_INT32(0, A.data[3]);
+}
@@ -27,6 +27,7 @@ xscope_config_io(XSCOPE_IO_BASIC);
   RUN_TEST_GROUP(bfp_use_exponent);
   RUN_TEST_GROUP(bfp_complex_use_exponent);
   RUN_TEST_GROUP(bfp_shl);
+  RUN_TEST_GROUP(bfp_slice);
 
   RUN_TEST_GROUP(bfp_add);
   RUN_TEST_GROUP(bfp_add_scalar);
@@ -50,6 +51,8 @@ xscope_config_io(XSCOPE_IO_BASIC);
   RUN_TEST_GROUP(bfp_argmax);
   RUN_TEST_GROUP(bfp_argmin);
   RUN_TEST_GROUP(bfp_inverse);
+  RUN_TEST_GROUP(bfp_divide);
+  RUN_TEST_GROUP(bfp_softmax);
   RUN_TEST_GROUP(bfp_macc);
 
   RUN_TEST_GROUP(bfp_complex_add);
@@ -62,6 +65,7 @@ xscope_config_io(XSCOPE_IO_BASIC);
   RUN_TEST_GROUP(bfp_complex_real_scale);
   RUN_TEST_GROUP(bfp_complex_squared_mag);
   RUN_TEST_GROUP(bfp_complex_mag);
+  RUN_TEST_GROUP(bfp_complex_polar);
   RUN_TEST_GROUP(bfp_complex_sum);
   RUN_TEST_GROUP(bfp_complex_macc);
   RUN_TEST_GROUP(bfp_complex_conj_macc);
@@ -76,6 +80,8 @@ xscope_config_io(XSCOPE_IO_BASIC);
   RUN_TEST_GROUP(bfp_convolve);
 
   RUN_TEST_GROUP(bfp_s16_accumulate);
+
+  RUN_TEST_GROUP(bfp_mat);
   
   return UNITY_END();
 }
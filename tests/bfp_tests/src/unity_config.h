@@ -3,6 +3,7 @@
 #pragma once
 
 #define UNITY_SUPPORT_64 1
+#define UNITY_INCLUDE_DOUBLE 1
 
 // Prevents Unity from taking control of malloc() and free()
 #define UNITY_FIXTURE_NO_EXTRAS  (1)
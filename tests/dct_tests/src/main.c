@@ -31,6 +31,12 @@ int main(int argc, const char* argv[])
   RUN_TEST_GROUP(dctXX_forward);
   RUN_TEST_GROUP(dctXX_inverse);
   RUN_TEST_GROUP(dct8x8);
+  RUN_TEST_GROUP(dct_arbitrary);
+  RUN_TEST_GROUP(mdct);
+  RUN_TEST_GROUP(dct_image);
+  RUN_TEST_GROUP(mfcc);
+  RUN_TEST_GROUP(dwt);
+  RUN_TEST_GROUP(lpc);
 
 #if WRITE_PERFORMANCE_INFO
   fclose(perf_file);
@@ -0,0 +1,169 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "xmath/xmath.h"
+#include "testing.h"
+#include "floating_dct.h"
+#include "tst_common.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+TEST_GROUP_RUNNER(dct_arbitrary) {
+  RUN_TEST_CASE(dct_arbitrary, dct_forward);
+  RUN_TEST_CASE(dct_arbitrary, dct_inverse);
+  RUN_TEST_CASE(dct_arbitrary, dct_round_trip);
+}
+
+TEST_GROUP(dct_arbitrary);
+TEST_SETUP(dct_arbitrary) { fflush(stdout); }
+TEST_TEAR_DOWN(dct_arbitrary) {}
+
+
+#define MAX_DCT_N   (256)
+
+#if SMOKE_TEST
+#  define REPS       (2)
+#else
+#  define REPS       (50)
+#endif
+
+// Fixed lengths, radix-2 lengths, and lengths with odd factors (e.g. 40 mel bands)
+static const unsigned dct_lengths[] = { 2, 4, 6, 8, 10, 12, 16, 20, 24, 26, 32, 40, 48, 64, 80, 96,
+                                        128, 200, 250, 256 };
+#define LENGTH_COUNT  (sizeof(dct_lengths) / sizeof(dct_lengths[0]))
+
+static char msg_buff[200];
+
+
+// Largest error allowed, relative to the largest magnitude reference output (the larger
+// fixed-length DCTs are the least precise)
+static const double rel_threshold = 0x1p-18;
+
+
+static void check_result(
+    const int32_t x[],
+    const exponent_t exp,
+    const double ref[],
+    const unsigned N)
+{
+  double ref_max = 0;
+  for(unsigned k = 0; k < N; k++)
+    ref_max = (fabs(ref[k]) > ref_max)? fabs(ref[k]) : ref_max;
+
+  // The fixed-length DCTs are allowed an error of up to N LSBs
+  const int32_t threshold = (int32_t) ceil(ldexp(rel_threshold * ref_max, -exp)) + N;
+
+  for(unsigned k = 0; k < N; k++)
+    TEST_ASSERT_INT32_WITHIN(threshold, (int32_t) llround(ldexp(ref[k], -exp)), x[k]);
+}
+
+
+TEST(dct_arbitrary, dct_forward)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x[MAX_DCT_N];
+  DWORD_ALIGNED int32_t scratch[MAX_DCT_N];
+  double ref_in[MAX_DCT_N];
+  double ref_out[MAX_DCT_N];
+
+  for(unsigned l = 0; l < LENGTH_COUNT; l++){
+    const unsigned N = dct_lengths[l];
+
+    for(int r = 0; r < REPS; r++){
+      sprintf(msg_buff, "( N: %u; rep: %d )", N, r);
+      UNITY_SET_DETAIL(msg_buff);
+
+      exponent_t exp = pseudo_rand_int(&seed, -40, 0);
+      const right_shift_t shr = pseudo_rand_uint(&seed, 0, 8);
+
+      for(unsigned i = 0; i < N; i++){
+        x[i] = pseudo_rand_int32(&seed) >> shr;
+        ref_in[i] = ldexp(x[i], exp);
+      }
+      headroom_t hr = vect_s32_headroom(x, N);
+
+      dbl_dct_forward(ref_out, ref_in, N);
+
+      dct_forward(x, scratch, N, &hr, &exp);
+
+      TEST_ASSERT_EQUAL(vect_s32_headroom(x, N), hr);
+
+      check_result(x, exp, ref_out, N);
+    }
+  }
+}
+
+
+TEST(dct_arbitrary, dct_inverse)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x[MAX_DCT_N];
+  DWORD_ALIGNED int32_t scratch[MAX_DCT_N];
+  double ref_in[MAX_DCT_N];
+  double ref_out[MAX_DCT_N];
+
+  for(unsigned l = 0; l < LENGTH_COUNT; l++){
+    const unsigned N = dct_lengths[l];
+
+    for(int r = 0; r < REPS; r++){
+      sprintf(msg_buff, "( N: %u; rep: %d )", N, r);
+      UNITY_SET_DETAIL(msg_buff);
+
+      exponent_t exp = pseudo_rand_int(&seed, -40, 0);
+      const right_shift_t shr = pseudo_rand_uint(&seed, 0, 8);
+
+      for(unsigned i = 0; i < N; i++){
+        x[i] = pseudo_rand_int32(&seed) >> shr;
+        ref_in[i] = ldexp(x[i], exp);
+      }
+      headroom_t hr = vect_s32_headroom(x, N);
+
+      dbl_dct_inverse(ref_out, ref_in, N);
+
+      dct_inverse(x, scratch, N, &hr, &exp);
+
+      TEST_ASSERT_EQUAL(vect_s32_headroom(x, N), hr);
+
+      check_result(x, exp, ref_out, N);
+    }
+  }
+}
+
+
+TEST(dct_arbitrary, dct_round_trip)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x[MAX_DCT_N];
+  DWORD_ALIGNED int32_t orig[MAX_DCT_N];
+  DWORD_ALIGNED int32_t scratch[MAX_DCT_N];
+
+  for(unsigned l = 0; l < LENGTH_COUNT; l++){
+    const unsigned N = dct_lengths[l];
+
+    for(int r = 0; r < REPS; r++){
+      sprintf(msg_buff, "( N: %u; rep: %d )", N, r);
+      UNITY_SET_DETAIL(msg_buff);
+
+      for(unsigned i = 0; i < N; i++)
+        orig[i] = x[i] = pseudo_rand_int32(&seed) >> 1;
+
+      exponent_t exp = -31;
+      headroom_t hr = vect_s32_headroom(x, N);
+
+      dct_forward(x, scratch, N, &hr, &exp);
+      dct_inverse(x, scratch, N, &hr, &exp);
+
+      // Scale the result back to the original exponent
+      vect_s32_shl(x, x, N, exp + 31);
+
+      TEST_ASSERT_INT32_ARRAY_WITHIN(1 << 15, orig, x, N);
+    }
+  }
+}
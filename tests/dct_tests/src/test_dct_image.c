@@ -0,0 +1,331 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "xmath/xmath.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+TEST_GROUP_RUNNER(dct_image) {
+  RUN_TEST_CASE(dct_image, dct16x16_forward);
+  RUN_TEST_CASE(dct_image, dct16x16_inverse);
+  RUN_TEST_CASE(dct_image, dct8x8_forward_image);
+  RUN_TEST_CASE(dct_image, dct8x8_inverse_image);
+  RUN_TEST_CASE(dct_image, dct16x16_forward_image);
+  RUN_TEST_CASE(dct_image, dct16x16_inverse_image);
+  RUN_TEST_CASE(dct_image, dct_forward_image_quant);
+}
+
+TEST_GROUP(dct_image);
+TEST_SETUP(dct_image) { fflush(stdout); }
+TEST_TEAR_DOWN(dct_image) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (4)
+#else
+#  define REPS       (100)
+#endif
+
+// Image dimensions (in pixels) and row stride used by the image tests
+#define IMG_WIDTH   (48)
+#define IMG_HEIGHT  (32)
+#define IMG_STRIDE  (53)
+
+static char msg_buff[200];
+
+
+// 2D DCT of the N-by-N block at x[] (with row stride x_stride), scaled as by dct8x8_forward() or
+// dct8x8_inverse() (with sat = 0) when N = 8, and dct16x16_forward() / dct16x16_inverse() when
+// N = 16.
+static void dbl_dct2d(
+    double y[],
+    const int8_t x[],
+    const unsigned x_stride,
+    const unsigned N,
+    const unsigned inverse)
+{
+  for(unsigned r = 0; r < N; r++){
+    for(unsigned c = 0; c < N; c++){
+      double acc = 0;
+      for(unsigned m = 0; m < N; m++){
+        for(unsigned n = 0; n < N; n++){
+          const double w = inverse? ((m == 0)? 0.5 : 1.0) * ((n == 0)? 0.5 : 1.0) : 1.0;
+          const double cr = inverse? cos(m * M_PI * (2*r + 1) / (2*N)) : cos(r * M_PI * (2*m + 1) / (2*N));
+          const double cc = inverse? cos(n * M_PI * (2*c + 1) / (2*N)) : cos(c * M_PI * (2*n + 1) / (2*N));
+          acc += w * x[m * x_stride + n] * cr * cc;
+        }
+      }
+      y[r * N + c] = inverse? acc / (N * N) : ldexp(4 * acc, -(int)(2 * (N / 8) + 6));
+    }
+  }
+}
+
+
+static void rand_block(
+    int8_t x[],
+    const unsigned count,
+    unsigned* seed)
+{
+  for(unsigned k = 0; k < count; k++)
+    x[k] = pseudo_rand_int8(seed);
+}
+
+
+static headroom_t block_headroom(
+    const int8_t x[],
+    const unsigned x_stride,
+    const unsigned rows,
+    const unsigned cols)
+{
+  headroom_t hr = 8;
+  for(unsigned r = 0; r < rows; r++)
+    for(unsigned c = 0; c < cols; c++)
+      hr = MIN(hr, HR_S8(x[r * x_stride + c]));
+  return hr;
+}
+
+
+TEST(dct_image, dct16x16_forward)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int8_t x[16][16];
+  DWORD_ALIGNED int8_t y[16][16];
+  double expected[16*16];
+
+  for(int t = 0; t < REPS; t++){
+    sprintf(msg_buff, "( rep: %d )", t);
+    UNITY_SET_DETAIL(msg_buff);
+
+    rand_block(&x[0][0], 16*16, &seed);
+    dbl_dct2d(expected, &x[0][0], 16, 16, 0);
+
+    headroom_t hr = dct16x16_forward(y, x, 0);
+
+    TEST_ASSERT_EQUAL(block_headroom(&y[0][0], 16, 16, 16), hr);
+    for(int k = 0; k < 16*16; k++)
+      TEST_ASSERT_INT32_WITHIN(2, (int32_t) round(expected[k]), y[k / 16][k % 16]);
+  }
+}
+
+
+TEST(dct_image, dct16x16_inverse)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int8_t x[16][16];
+  DWORD_ALIGNED int8_t y[16][16];
+  double expected[16*16];
+
+  for(int t = 0; t < REPS; t++){
+    sprintf(msg_buff, "( rep: %d )", t);
+    UNITY_SET_DETAIL(msg_buff);
+
+    rand_block(&x[0][0], 16*16, &seed);
+    dbl_dct2d(expected, &x[0][0], 16, 16, 1);
+
+    // Also check that it works in-place
+    memcpy(y, x, sizeof(y));
+    headroom_t hr = dct16x16_inverse(y, y, 0);
+
+    TEST_ASSERT_EQUAL(block_headroom(&y[0][0], 16, 16, 16), hr);
+    for(int k = 0; k < 16*16; k++)
+      TEST_ASSERT_INT32_WITHIN(2, (int32_t) round(expected[k]), y[k / 16][k % 16]);
+  }
+}
+
+
+// Batched forward DCT must give the same blocks as the single-block DCT.
+TEST(dct_image, dct8x8_forward_image)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  static int8_t image[IMG_HEIGHT * IMG_STRIDE];
+  static DWORD_ALIGNED int8_t y[(IMG_WIDTH/8) * (IMG_HEIGHT/8)][8][8];
+  DWORD_ALIGNED int8_t block[8][8];
+  DWORD_ALIGNED int8_t expected[8][8];
+
+  for(int t = 0; t < REPS; t++){
+    sprintf(msg_buff, "( rep: %d )", t);
+    UNITY_SET_DETAIL(msg_buff);
+
+    const right_shift_t sat = -pseudo_rand_int(&seed, 0, 3);
+    rand_block(image, sizeof(image), &seed);
+
+    headroom_t hr = dct8x8_forward_image(y, image, IMG_WIDTH, IMG_HEIGHT, IMG_STRIDE, sat, NULL);
+
+    headroom_t expected_hr = 8;
+    for(int b = 0; b < (IMG_WIDTH/8) * (IMG_HEIGHT/8); b++){
+      const unsigned row = 8 * (b / (IMG_WIDTH/8));
+      const unsigned col = 8 * (b % (IMG_WIDTH/8));
+      for(int r = 0; r < 8; r++)
+        memcpy(block[r], &image[(row + r) * IMG_STRIDE + col], 8);
+
+      expected_hr = MIN(expected_hr, dct8x8_forward(expected, block, sat));
+      TEST_ASSERT_EQUAL_INT8_ARRAY(&expected[0][0], &y[b][0][0], 8*8);
+    }
+    TEST_ASSERT_EQUAL(expected_hr, hr);
+  }
+}
+
+
+// Batched inverse DCT must give the same blocks as the single-block DCT, and leave the padding at
+// the end of each image row untouched.
+TEST(dct_image, dct8x8_inverse_image)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  static int8_t image[IMG_HEIGHT * IMG_STRIDE];
+  static DWORD_ALIGNED int8_t x[(IMG_WIDTH/8) * (IMG_HEIGHT/8)][8][8];
+  DWORD_ALIGNED int8_t expected[8][8];
+
+  for(int t = 0; t < REPS; t++){
+    sprintf(msg_buff, "( rep: %d )", t);
+    UNITY_SET_DETAIL(msg_buff);
+
+    const right_shift_t sat = -pseudo_rand_int(&seed, 0, 3);
+    rand_block(&x[0][0][0], sizeof(x), &seed);
+    memset(image, 0x55, sizeof(image));
+
+    headroom_t hr = dct8x8_inverse_image(image, x, IMG_WIDTH, IMG_HEIGHT, IMG_STRIDE, sat);
+
+    headroom_t expected_hr = 8;
+    for(int b = 0; b < (IMG_WIDTH/8) * (IMG_HEIGHT/8); b++){
+      const unsigned row = 8 * (b / (IMG_WIDTH/8));
+      const unsigned col = 8 * (b % (IMG_WIDTH/8));
+      expected_hr = MIN(expected_hr, dct8x8_inverse(expected, x[b], sat));
+      for(int r = 0; r < 8; r++)
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected[r], &image[(row + r) * IMG_STRIDE + col], 8);
+    }
+    TEST_ASSERT_EQUAL(expected_hr, hr);
+
+    for(int r = 0; r < IMG_HEIGHT; r++)
+      for(int c = IMG_WIDTH; c < IMG_STRIDE; c++)
+        TEST_ASSERT_EQUAL_INT8(0x55, image[r * IMG_STRIDE + c]);
+  }
+}
+
+
+TEST(dct_image, dct16x16_forward_image)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  static int8_t image[IMG_HEIGHT * IMG_STRIDE];
+  static DWORD_ALIGNED int8_t y[(IMG_WIDTH/16) * (IMG_HEIGHT/16)][16][16];
+  DWORD_ALIGNED int8_t block[16][16];
+  DWORD_ALIGNED int8_t expected[16][16];
+
+  for(int t = 0; t < REPS; t++){
+    sprintf(msg_buff, "( rep: %d )", t);
+    UNITY_SET_DETAIL(msg_buff);
+
+    const right_shift_t sat = -pseudo_rand_int(&seed, 0, 3);
+    rand_block(image, sizeof(image), &seed);
+
+    headroom_t hr = dct16x16_forward_image(y, image, IMG_WIDTH, IMG_HEIGHT, IMG_STRIDE, sat, NULL);
+
+    headroom_t expected_hr = 8;
+    for(int b = 0; b < (IMG_WIDTH/16) * (IMG_HEIGHT/16); b++){
+      const unsigned row = 16 * (b / (IMG_WIDTH/16));
+      const unsigned col = 16 * (b % (IMG_WIDTH/16));
+      for(int r = 0; r < 16; r++)
+        memcpy(block[r], &image[(row + r) * IMG_STRIDE + col], 16);
+
+      expected_hr = MIN(expected_hr, dct16x16_forward(expected, block, sat));
+      TEST_ASSERT_EQUAL_INT8_ARRAY(&expected[0][0], &y[b][0][0], 16*16);
+    }
+    TEST_ASSERT_EQUAL(expected_hr, hr);
+  }
+}
+
+
+TEST(dct_image, dct16x16_inverse_image)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  static int8_t image[IMG_HEIGHT * IMG_STRIDE];
+  static DWORD_ALIGNED int8_t x[(IMG_WIDTH/16) * (IMG_HEIGHT/16)][16][16];
+  DWORD_ALIGNED int8_t expected[16][16];
+
+  for(int t = 0; t < REPS; t++){
+    sprintf(msg_buff, "( rep: %d )", t);
+    UNITY_SET_DETAIL(msg_buff);
+
+    const right_shift_t sat = -pseudo_rand_int(&seed, 0, 3);
+    rand_block(&x[0][0][0], sizeof(x), &seed);
+    memset(image, 0x55, sizeof(image));
+
+    headroom_t hr = dct16x16_inverse_image(image, x, IMG_WIDTH, IMG_HEIGHT, IMG_STRIDE, sat);
+
+    headroom_t expected_hr = 8;
+    for(int b = 0; b < (IMG_WIDTH/16) * (IMG_HEIGHT/16); b++){
+      const unsigned row = 16 * (b / (IMG_WIDTH/16));
+      const unsigned col = 16 * (b % (IMG_WIDTH/16));
+      expected_hr = MIN(expected_hr, dct16x16_inverse(expected, x[b], sat));
+      for(int r = 0; r < 16; r++)
+        TEST_ASSERT_EQUAL_INT8_ARRAY(expected[r], &image[(row + r) * IMG_STRIDE + col], 16);
+    }
+    TEST_ASSERT_EQUAL(expected_hr, hr);
+
+    for(int r = 0; r < IMG_HEIGHT; r++)
+      for(int c = IMG_WIDTH; c < IMG_STRIDE; c++)
+        TEST_ASSERT_EQUAL_INT8(0x55, image[r * IMG_STRIDE + c]);
+  }
+}
+
+
+// With quantisation, each output should be the rounded quotient of the unquantised output and the
+// quantiser step.
+TEST(dct_image, dct_forward_image_quant)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  static int8_t image[IMG_HEIGHT * IMG_STRIDE];
+  static DWORD_ALIGNED int8_t y8[(IMG_WIDTH/8) * (IMG_HEIGHT/8)][8][8];
+  static DWORD_ALIGNED int8_t y16[(IMG_WIDTH/16) * (IMG_HEIGHT/16)][16][16];
+  uint8_t quant8[8][8];
+  uint8_t quant16[16][16];
+  double expected[16*16];
+
+  for(int t = 0; t < REPS; t++){
+    sprintf(msg_buff, "( rep: %d )", t);
+    UNITY_SET_DETAIL(msg_buff);
+
+    const right_shift_t sat = -pseudo_rand_int(&seed, 0, 3);
+    rand_block(image, sizeof(image), &seed);
+    for(int k = 0; k < 8*8; k++)
+      quant8[k / 8][k % 8] = pseudo_rand_uint(&seed, 1, 40);
+    for(int k = 0; k < 16*16; k++)
+      quant16[k / 16][k % 16] = pseudo_rand_uint(&seed, 1, 40);
+
+    for(unsigned N = 8; N <= 16; N += 8){
+      const uint8_t* quant = (N == 8)? &quant8[0][0] : &quant16[0][0];
+      const int8_t* y = (N == 8)? &y8[0][0][0] : &y16[0][0][0];
+
+      headroom_t hr = (N == 8)?
+          dct8x8_forward_image(y8, image, IMG_WIDTH, IMG_HEIGHT, IMG_STRIDE, sat, quant8)
+        : dct16x16_forward_image(y16, image, IMG_WIDTH, IMG_HEIGHT, IMG_STRIDE, sat, quant16);
+
+      const unsigned blocks = (IMG_WIDTH/N) * (IMG_HEIGHT/N);
+      TEST_ASSERT_EQUAL(block_headroom(y, N*N, blocks, N*N), hr);
+
+      for(unsigned b = 0; b < blocks; b++){
+        const unsigned row = N * (b / (IMG_WIDTH/N));
+        const unsigned col = N * (b % (IMG_WIDTH/N));
+        dbl_dct2d(expected, &image[row * IMG_STRIDE + col], IMG_STRIDE, N, 0);
+
+        for(unsigned k = 0; k < N*N; k++){
+          double q = round(ldexp(expected[k], -sat) / quant[k]);
+          q = (q > 127)? 127 : (q < -127)? -127 : q;
+          TEST_ASSERT_INT32_WITHIN(1, (int32_t) q, y[b * N * N + k]);
+        }
+      }
+    }
+  }
+}
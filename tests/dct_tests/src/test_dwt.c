@@ -0,0 +1,230 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "xmath/xmath.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+TEST_GROUP_RUNNER(dwt) {
+  RUN_TEST_CASE(dwt, bfp_s32_dwt_forward);
+  RUN_TEST_CASE(dwt, bfp_s32_dwt_inverse);
+  RUN_TEST_CASE(dwt, bfp_s32_dwt_constant);
+}
+
+TEST_GROUP(dwt);
+TEST_SETUP(dwt) { fflush(stdout); }
+TEST_TEAR_DOWN(dwt) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (20)
+#else
+#  define REPS       (300)
+#endif
+
+#define MAX_LEVELS  (6)
+#define MAX_LEN     (1 << 10)
+
+static char msg_buff[200];
+
+
+// Double-precision lifting, structured as in the description of each wavelet
+static void dbl_dwt_level(
+    double x[],
+    const unsigned n,
+    const unsigned stride,
+    const dwt_wavelet_e wavelet)
+{
+  const unsigned h = n / 2;
+  double s[MAX_LEN / 2];
+  double d[MAX_LEN / 2];
+
+  for(unsigned i = 0; i < h; i++){
+    s[i] = x[2 * i * stride];
+    d[i] = x[(2 * i + 1) * stride];
+  }
+
+  const double r2 = sqrt(2.0);
+  const double r3 = sqrt(3.0);
+  double ks, kd;
+
+  if(wavelet == DWT_HAAR){
+    for(unsigned i = 0; i < h; i++) d[i] -= s[i];
+    for(unsigned i = 0; i < h; i++) s[i] += d[i] / 2;
+    ks = r2;
+    kd = 1 / r2;
+  } else if(wavelet == DWT_DB4){
+    for(unsigned i = 0; i < h; i++) d[i] -= r3 * s[i];
+    for(unsigned i = 0; i < h; i++) s[i] += (r3 / 4) * d[i] + ((r3 - 2) / 4) * d[(i + 1) % h];
+    for(unsigned i = 0; i < h; i++) d[i] += s[(i + h - 1) % h];
+    ks = (r3 + 1) / r2;
+    kd = (r3 - 1) / r2;
+  } else {
+    const double c[4] = { -1.586134342059924, -0.052980118572961,
+                           0.882911075530934,  0.443506852043971 };
+    const double K = 1.230174104914001;
+    for(int k = 0; k < 4; k += 2){
+      for(unsigned i = 0; i < h; i++) d[i] += c[k] * (s[i] + s[(i + 1 < h)? i + 1 : h - 1]);
+      for(unsigned i = 0; i < h; i++) s[i] += c[k+1] * (d[(i > 0)? i - 1 : 0] + d[i]);
+    }
+    ks = r2 / K;
+    kd = K / r2;
+  }
+
+  for(unsigned i = 0; i < h; i++){
+    x[2 * i * stride] = s[i] * ks;
+    x[(2 * i + 1) * stride] = d[i] * kd;
+  }
+}
+
+
+// Reference forward DWT, with output in the given layout
+static void dbl_dwt_forward(
+    double x[],
+    const unsigned N,
+    const dwt_wavelet_e wavelet,
+    const unsigned levels,
+    const dwt_layout_e layout)
+{
+  for(unsigned l = 0; l < levels; l++){
+    const unsigned n = N >> l;
+    if(layout == DWT_LAYOUT_PACKED){
+      double tmp[MAX_LEN];
+      dbl_dwt_level(x, n, 1, wavelet);
+      for(unsigned i = 0; i < n / 2; i++){
+        tmp[i] = x[2 * i];
+        tmp[n / 2 + i] = x[2 * i + 1];
+      }
+      memcpy(x, tmp, n * sizeof(double));
+    } else {
+      dbl_dwt_level(x, n, 1 << l, wavelet);
+    }
+  }
+}
+
+
+static void rand_bfp(
+    bfp_s32_t* x,
+    int32_t data[],
+    double ref[],
+    const unsigned length,
+    unsigned* seed)
+{
+  bfp_s32_init(x, data, pseudo_rand_int(seed, -40, 0), length, 0);
+  const right_shift_t shr = pseudo_rand_uint(seed, 0, 10);
+  for(unsigned k = 0; k < length; k++){
+    data[k] = pseudo_rand_int32(seed) >> shr;
+    ref[k] = ldexp(data[k], x->exp);
+  }
+  bfp_s32_headroom(x);
+}
+
+
+TEST(dwt, bfp_s32_dwt_forward)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t data[MAX_LEN];
+  DWORD_ALIGNED int32_t scratch[MAX_LEN / 2];
+  double ref[MAX_LEN];
+
+  for(int t = 0; t < REPS; t++){
+    const dwt_wavelet_e wavelet = (dwt_wavelet_e) pseudo_rand_uint(&seed, 0, 3);
+    const dwt_layout_e layout = (dwt_layout_e) pseudo_rand_uint(&seed, 0, 2);
+    const unsigned levels = pseudo_rand_uint(&seed, 1, MAX_LEVELS + 1);
+    const unsigned N = pseudo_rand_uint(&seed, 1, (MAX_LEN >> levels) + 1) << levels;
+
+    sprintf(msg_buff, "( rep: %d; wavelet: %d; layout: %d; levels: %u; N: %u )",
+            t, wavelet, layout, levels, N);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_s32_t x;
+    rand_bfp(&x, data, ref, N, &seed);
+    dbl_dwt_forward(ref, N, wavelet, levels, layout);
+
+    bfp_s32_dwt_forward(&x, scratch, wavelet, levels, layout);
+
+    TEST_ASSERT_EQUAL(N, x.length);
+    TEST_ASSERT_EQUAL(vect_s32_headroom(x.data, N), x.hr);
+    // The output should be reasonably well normalised
+    TEST_ASSERT_LESS_OR_EQUAL(8, x.hr);
+
+    for(unsigned k = 0; k < N; k++)
+      TEST_ASSERT_INT32_WITHIN(8 * levels, (int32_t) llround(ldexp(ref[k], -x.exp)), x.data[k]);
+  }
+}
+
+
+TEST(dwt, bfp_s32_dwt_inverse)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t data[MAX_LEN];
+  DWORD_ALIGNED int32_t scratch[MAX_LEN / 2];
+  double ref[MAX_LEN];
+
+  for(int t = 0; t < REPS; t++){
+    const dwt_wavelet_e wavelet = (dwt_wavelet_e) pseudo_rand_uint(&seed, 0, 3);
+    const dwt_layout_e layout = (dwt_layout_e) pseudo_rand_uint(&seed, 0, 2);
+    const unsigned levels = pseudo_rand_uint(&seed, 1, MAX_LEVELS + 1);
+    const unsigned N = pseudo_rand_uint(&seed, 1, (MAX_LEN >> levels) + 1) << levels;
+
+    sprintf(msg_buff, "( rep: %d; wavelet: %d; layout: %d; levels: %u; N: %u )",
+            t, wavelet, layout, levels, N);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_s32_t x;
+    rand_bfp(&x, data, ref, N, &seed);
+
+    bfp_s32_dwt_forward(&x, scratch, wavelet, levels, layout);
+    bfp_s32_dwt_inverse(&x, scratch, wavelet, levels, layout);
+
+    TEST_ASSERT_EQUAL(N, x.length);
+    TEST_ASSERT_EQUAL(vect_s32_headroom(x.data, N), x.hr);
+
+    // The input is recovered, up to the rounding of the intermediate results
+    for(unsigned k = 0; k < N; k++)
+      TEST_ASSERT_INT32_WITHIN(16 * levels, (int32_t) llround(ldexp(ref[k], -x.exp)), x.data[k]);
+  }
+}
+
+
+TEST(dwt, bfp_s32_dwt_constant)
+{
+  DWORD_ALIGNED int32_t data[MAX_LEN];
+  DWORD_ALIGNED int32_t scratch[MAX_LEN / 2];
+
+  const unsigned N = 256;
+  const unsigned levels = 4;
+
+  for(int wavelet = DWT_HAAR; wavelet <= DWT_CDF97; wavelet++){
+    for(int layout = DWT_LAYOUT_PACKED; layout <= DWT_LAYOUT_STRIDED; layout++){
+      sprintf(msg_buff, "( wavelet: %d; layout: %d )", wavelet, layout);
+      UNITY_SET_DETAIL(msg_buff);
+
+      bfp_s32_t x;
+      bfp_s32_init(&x, data, -20, N, 0);
+      bfp_s32_set(&x, 0x12345678, -30);
+
+      bfp_s32_dwt_forward(&x, scratch, (dwt_wavelet_e) wavelet, levels, (dwt_layout_e) layout);
+
+      // A constant signal has no detail at any level, and each level scales the approximation
+      // by sqrt(2)
+      const double approx = ldexp(0x12345678, -30 + levels / 2);
+      const int32_t threshold = 8 * levels;
+
+      for(unsigned k = 0; k < N; k++){
+        const unsigned is_approx = (layout == DWT_LAYOUT_PACKED)? (k < (N >> levels))
+                                                                 : ((k % (1 << levels)) == 0);
+        const double expected = is_approx? approx : 0.0;
+        TEST_ASSERT_INT32_WITHIN(threshold, (int32_t) llround(ldexp(expected, -x.exp)), x.data[k]);
+      }
+    }
+  }
+}
@@ -0,0 +1,345 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "xmath/xmath.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+TEST_GROUP_RUNNER(lpc) {
+  RUN_TEST_CASE(lpc, vect_s32_autocorr);
+  RUN_TEST_CASE(lpc, bfp_s32_autocorr);
+  RUN_TEST_CASE(lpc, lpc_s32_levinson_durbin);
+  RUN_TEST_CASE(lpc, lpc_s32_to_lsf);
+}
+
+TEST_GROUP(lpc);
+TEST_SETUP(lpc) { fflush(stdout); }
+TEST_TEAR_DOWN(lpc) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (20)
+#else
+#  define REPS       (300)
+#endif
+
+#define MAX_LEN     (512)
+#define MAX_LAGS    (128)
+
+static char msg_buff[200];
+
+static DWORD_ALIGNED int32_t autocorr_scratch[AUTOCORR_S32_SCRATCH_WORDS(MAX_LEN, MAX_LAGS)];
+
+
+// Random signal with a non-flat spectrum, from a random order-2 all-pole filter
+static void rand_signal(
+    bfp_s32_t* x,
+    int32_t data[],
+    double ref[],
+    const unsigned length,
+    unsigned* seed)
+{
+  const double rho = ldexp(pseudo_rand_uint(seed, 0, 1 << 20), -20) * 0.95;
+  const double theta = ldexp(pseudo_rand_uint(seed, 0, 1 << 20), -20) * M_PI;
+  const double c1 = 2 * rho * cos(theta);
+  const double c2 = -rho * rho;
+
+  double y1 = 0, y2 = 0, peak = 0;
+  for(unsigned n = 0; n < length; n++){
+    const double y = ldexp(pseudo_rand_int32(seed), -31) + c1 * y1 + c2 * y2;
+    ref[n] = y;
+    y2 = y1;
+    y1 = y;
+    peak = MAX(peak, fabs(y));
+  }
+
+  const right_shift_t shr = pseudo_rand_uint(seed, 0, 8);
+  bfp_s32_init(x, data, pseudo_rand_int(seed, -40, -20), length, 0);
+  for(unsigned n = 0; n < length; n++){
+    data[n] = (int32_t) ldexp(ref[n] / peak, 30 - shr);
+    ref[n] = ldexp(data[n], x->exp);
+  }
+  bfp_s32_headroom(x);
+}
+
+
+static void dbl_autocorr(
+    double r[],
+    const double x[],
+    const unsigned length,
+    const unsigned lag_count)
+{
+  for(unsigned k = 0; k < lag_count; k++){
+    r[k] = 0;
+    for(unsigned n = 0; n < length - k; n++)
+      r[k] += x[n] * x[n + k];
+  }
+}
+
+
+// Returns the prediction error energy, or a negative value if the recursion became unstable
+static double dbl_levinson(
+    double a[],
+    double refl[],
+    const double r[],
+    const unsigned order)
+{
+  double tmp[LPC_MAX_ORDER + 1];
+  double err = r[0];
+
+  for(unsigned j = 0; j <= order; j++)
+    a[j] = 0;
+
+  for(unsigned i = 1; i <= order; i++){
+    double acc = r[i];
+    for(unsigned j = 1; j < i; j++)
+      acc += a[j] * r[i - j];
+    const double k = -acc / err;
+    if(fabs(k) >= 1)
+      return -1;
+
+    for(unsigned j = 1; j < i; j++)
+      tmp[j] = a[j] + k * a[i - j];
+    for(unsigned j = 1; j < i; j++)
+      a[j] = tmp[j];
+    a[i] = k;
+    refl[i - 1] = k;
+    err *= (1 - k * k);
+  }
+  return err;
+}
+
+
+TEST(lpc, vect_s32_autocorr)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t b[MAX_LEN];
+  DWORD_ALIGNED int32_t a[MAX_LAGS];
+
+  for(int t = 0; t < REPS; t++){
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_LEN + 1);
+    const unsigned K = pseudo_rand_uint(&seed, 1, MIN(N, MAX_LAGS) + 1);
+    const right_shift_t b_hr = pseudo_rand_uint(&seed, 0, 10);
+    const right_shift_t b_shr = pseudo_rand_int(&seed, -b_hr, 3);
+
+    for(unsigned n = 0; n < N; n++)
+      b[n] = pseudo_rand_int32(&seed) >> b_hr;
+
+    // Choose a_shr as bfp_s32_autocorr() would, or with a few bits either side of that
+    const int64_t energy = vect_s32_energy(b, N, b_shr);
+    int bits = 0;
+    while(bits < 64 && (energy >> bits) != 0)
+      bits++;
+    const right_shift_t a_shr = bits - 30 + pseudo_rand_int(&seed, -2, 3);
+
+    sprintf(msg_buff, "( rep: %d; N: %u; K: %u; b_shr: %d; a_shr: %d )", t, N, K, b_shr, a_shr);
+    UNITY_SET_DETAIL(msg_buff);
+
+    headroom_t hr = vect_s32_autocorr(a, b, N, K, b_shr, a_shr);
+
+    for(unsigned k = 0; k < K; k++){
+      int64_t acc = 0;
+      for(unsigned n = 0; n < N - k; n++){
+        const int64_t bn = (b_shr >= 0)? (b[n] >> b_shr) : (((int64_t) b[n]) << -b_shr);
+        const int64_t bnk = (b_shr >= 0)? (b[n + k] >> b_shr) : (((int64_t) b[n + k]) << -b_shr);
+        acc += (bn * bnk + (1 << 29)) >> 30;
+      }
+      const double expected = MAX(-INT32_MAX, MIN(INT32_MAX, round(ldexp((double) acc, -a_shr))));
+      TEST_ASSERT_INT32_WITHIN(1, (int32_t) expected, a[k]);
+    }
+
+    TEST_ASSERT_EQUAL(vect_s32_headroom(a, K), hr);
+  }
+}
+
+
+TEST(lpc, bfp_s32_autocorr)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x_data[MAX_LEN];
+  DWORD_ALIGNED int32_t r_data[MAX_LAGS];
+  double x_ref[MAX_LEN], r_ref[MAX_LAGS];
+
+  for(int t = 0; t < REPS; t++){
+    const unsigned N = pseudo_rand_uint(&seed, 16, MAX_LEN + 1);
+    const unsigned K = pseudo_rand_uint(&seed, 1, MIN(N, MAX_LAGS) + 1);
+    const int use_fft = pseudo_rand_uint(&seed, 0, 2);
+
+    sprintf(msg_buff, "( rep: %d; N: %u; K: %u; fft: %d )", t, N, K, use_fft);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_s32_t x, r;
+    rand_signal(&x, x_data, x_ref, N, &seed);
+    bfp_s32_init(&r, r_data, 0, K, 0);
+
+    dbl_autocorr(r_ref, x_ref, N, K);
+
+    bfp_s32_autocorr(&r, &x, use_fft? autocorr_scratch : NULL);
+
+    TEST_ASSERT_EQUAL(K, r.length);
+    TEST_ASSERT_EQUAL(vect_s32_headroom(r.data, K), r.hr);
+    TEST_ASSERT_INT32_WITHIN(1, 1, r.hr);
+
+    // Errors are relative to lag 0. The FFT path rounds at the block exponent of the spectrum, so
+    // loses a few more bits than the direct path.
+    const double threshold = ldexp(r_ref[0], -22);
+    for(unsigned k = 0; k < K; k++)
+      TEST_ASSERT_FLOAT_WITHIN(threshold, r_ref[k], ldexp(r.data[k], r.exp));
+  }
+}
+
+
+TEST(lpc, lpc_s32_levinson_durbin)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x_data[MAX_LEN];
+  DWORD_ALIGNED int32_t r_data[LPC_MAX_ORDER + 1];
+  DWORD_ALIGNED int32_t a_data[LPC_MAX_ORDER];
+  double x_ref[MAX_LEN], r_ref[LPC_MAX_ORDER + 1];
+  double a_ref[LPC_MAX_ORDER + 1], refl_ref[LPC_MAX_ORDER];
+  q2_30 refl[LPC_MAX_ORDER];
+
+  for(int t = 0; t < REPS; t++){
+    const unsigned P = pseudo_rand_uint(&seed, 1, 17);
+    const unsigned N = pseudo_rand_uint(&seed, 128, MAX_LEN + 1);
+
+    sprintf(msg_buff, "( rep: %d; N: %u; P: %u )", t, N, P);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_s32_t x, r, a;
+    rand_signal(&x, x_data, x_ref, N, &seed);
+    bfp_s32_init(&r, r_data, 0, P + 1, 0);
+    bfp_s32_init(&a, a_data, 0, P, 0);
+
+    bfp_s32_autocorr(&r, &x, NULL);
+
+    // The reference uses the same (quantized) autocorrelation
+    for(unsigned k = 0; k <= P; k++)
+      r_ref[k] = ldexp(r_data[k], r.exp);
+    const double err_ref = dbl_levinson(a_ref, refl_ref, r_ref, P);
+    TEST_ASSERT(err_ref > 0);
+
+    float_s32_t err = lpc_s32_levinson_durbin(&a, refl, &r);
+
+    TEST_ASSERT_EQUAL(P, a.length);
+    TEST_ASSERT_EQUAL(vect_s32_headroom(a.data, P), a.hr);
+    TEST_ASSERT_EQUAL(0, a.hr);
+
+    double a_max = 0;
+    for(unsigned j = 1; j <= P; j++)
+      a_max = MAX(a_max, fabs(a_ref[j]));
+
+    // Rounding in the float_s32_t recursion accumulates with the order, and the higher-order
+    // reflection coefficients are the most sensitive to it
+    for(unsigned j = 1; j <= P; j++)
+      TEST_ASSERT_FLOAT_WITHIN(ldexp(a_max, -16), a_ref[j], ldexp(a.data[j - 1], a.exp));
+    for(unsigned j = 0; j < P; j++)
+      TEST_ASSERT_FLOAT_WITHIN(ldexp(1.0, -16), refl_ref[j], ldexp(refl[j], -30));
+
+    TEST_ASSERT_FLOAT_WITHIN(ldexp(err_ref, -16), err_ref, ldexp(err.mant, err.exp));
+  }
+}
+
+
+// Build A(z) = (P(z) + Q(z)) / 2 from ascending line spectral frequencies, where the odd-numbered
+// frequencies are the roots of P(z) / (1 + z^-1) and the even-numbered ones those of
+// Q(z) / (1 - z^-1)
+static void dbl_lsf_to_lpc(
+    double a[],
+    const double lsf[],
+    const unsigned order)
+{
+  double p[LPC_MAX_ORDER + 2] = {1};
+  double q[LPC_MAX_ORDER + 2] = {1};
+  unsigned len = 1;
+
+  for(unsigned i = 0; i < order; i += 2){
+    // Multiply each by (1 - 2 cos(w) z^-1 + z^-2)
+    const double cp = -2 * cos(lsf[i]);
+    const double cq = -2 * cos(lsf[i + 1]);
+    for(int j = len + 1; j >= 0; j--){
+      double sp = (j < (int) len)? p[j] : 0;
+      double sq = (j < (int) len)? q[j] : 0;
+      if(j >= 1 && j - 1 < (int) len){ sp += cp * p[j - 1]; sq += cq * q[j - 1]; }
+      if(j >= 2){ sp += p[j - 2]; sq += q[j - 2]; }
+      p[j] = sp;
+      q[j] = sq;
+    }
+    len += 2;
+  }
+
+  // Multiply by (1 + z^-1) and (1 - z^-1) respectively
+  for(int j = len; j >= 1; j--){
+    p[j] = ((j < (int) len)? p[j] : 0) + p[j - 1];
+    q[j] = ((j < (int) len)? q[j] : 0) - q[j - 1];
+  }
+
+  for(unsigned j = 0; j <= order; j++)
+    a[j] = (p[j] + q[j]) / 2;
+}
+
+
+TEST(lpc, lpc_s32_to_lsf)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t a_data[LPC_MAX_ORDER];
+  double lsf_ref[LPC_MAX_ORDER];
+  double a_ref[LPC_MAX_ORDER + 1];
+  radian_q24_t lsf[LPC_MAX_ORDER];
+
+  for(int t = 0; t < REPS; t++){
+    const unsigned P = 2 * pseudo_rand_uint(&seed, 1, 9);
+
+    sprintf(msg_buff, "( rep: %d; P: %u )", t, P);
+    UNITY_SET_DETAIL(msg_buff);
+
+    // Ascending frequencies, each at least a few grid steps from its neighbours and from 0 and pi
+    const double min_gap = 4 * M_PI / LPC_LSF_GRID_POINTS;
+    const double spare = M_PI - (P + 1) * min_gap;
+    double u[LPC_MAX_ORDER];
+    double total = 0;
+    for(unsigned i = 0; i <= P; i++){
+      u[i] = ldexp(pseudo_rand_uint(&seed, 1, 1 << 16), -16);
+      total += u[i];
+    }
+    double w = 0;
+    for(unsigned i = 0; i < P; i++){
+      w += min_gap + spare * u[i] / total;
+      lsf_ref[i] = w;
+    }
+
+    dbl_lsf_to_lpc(a_ref, lsf_ref, P);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, 1.0, a_ref[0]);
+
+    bfp_s32_t a;
+    bfp_s32_init(&a, a_data, 0, P, 0);
+    double a_max = 0;
+    for(unsigned j = 1; j <= P; j++)
+      a_max = MAX(a_max, fabs(a_ref[j]));
+    int a_exp;
+    frexp(a_max, &a_exp);
+    a.exp = a_exp - 31;
+    for(unsigned j = 1; j <= P; j++)
+      a_data[j - 1] = (int32_t) lround(ldexp(a_ref[j], -a.exp));
+    bfp_s32_headroom(&a);
+
+    const unsigned count = lpc_s32_to_lsf(lsf, &a);
+
+    TEST_ASSERT_EQUAL(P, count);
+    for(unsigned i = 0; i < P; i++){
+      TEST_ASSERT_FLOAT_WITHIN(1e-4, lsf_ref[i], ldexp(lsf[i], -24));
+      if(i > 0)
+        TEST_ASSERT_GREATER_THAN(lsf[i - 1], lsf[i]);
+    }
+  }
+}
@@ -0,0 +1,227 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "xmath/xmath.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+TEST_GROUP_RUNNER(mdct) {
+  RUN_TEST_CASE(mdct, mdct_forward);
+  RUN_TEST_CASE(mdct, mdct_inverse);
+  RUN_TEST_CASE(mdct, mdct_round_trip);
+}
+
+TEST_GROUP(mdct);
+TEST_SETUP(mdct) { fflush(stdout); }
+TEST_TEAR_DOWN(mdct) {}
+
+
+#define MAX_FRAME   (192)
+
+#if SMOKE_TEST
+#  define FRAMES     (3)
+#else
+#  define FRAMES     (20)
+#endif
+
+static const unsigned frame_lengths[] = { 8, 16, 32, 64, 128, 24, 48, 96, 192 };
+#define LENGTH_COUNT  (sizeof(frame_lengths) / sizeof(frame_lengths[0]))
+
+static char msg_buff[200];
+
+static DWORD_ALIGNED int32_t mdct_buffer[MDCT_S32_BUFFER_WORDS(MAX_FRAME)];
+static DWORD_ALIGNED int32_t imdct_buffer[MDCT_S32_BUFFER_WORDS(MAX_FRAME)];
+static q2_30 window[2 * MAX_FRAME];
+static double window_dbl[2 * MAX_FRAME];
+
+
+// Sine window, which satisfies the Princen-Bradley condition
+static void make_window(
+    const unsigned F)
+{
+  for(unsigned n = 0; n < 2*F; n++){
+    window_dbl[n] = sin(M_PI * (n + 0.5) / (2*F));
+    window[n] = (q2_30) llround(ldexp(window_dbl[n], 30));
+    window_dbl[n] = ldexp(window[n], -30);
+  }
+}
+
+
+static double mdct_basis(
+    const unsigned F,
+    const unsigned n,
+    const unsigned k)
+{
+  return cos(M_PI / F * (n + 0.5 + F / 2.0) * (k + 0.5));
+}
+
+
+TEST(mdct, mdct_forward)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x_data[MAX_FRAME];
+  DWORD_ALIGNED int32_t X_data[MAX_FRAME];
+  double block[2 * MAX_FRAME];
+
+  for(unsigned l = 0; l < LENGTH_COUNT; l++){
+    const unsigned F = frame_lengths[l];
+
+    make_window(F);
+
+    mdct_s32_t mdct;
+    mdct_init(&mdct, mdct_buffer, window, F);
+
+    memset(block, 0, sizeof(block));
+
+    for(int t = 0; t < FRAMES; t++){
+      sprintf(msg_buff, "( F: %u; frame: %d )", F, t);
+      UNITY_SET_DETAIL(msg_buff);
+
+      bfp_s32_t x, X;
+      bfp_s32_init(&x, x_data, pseudo_rand_int(&seed, -40, -20), F, 0);
+      bfp_s32_init(&X, X_data, 0, F, 0);
+
+      const right_shift_t shr = pseudo_rand_uint(&seed, 0, 12);
+      for(unsigned i = 0; i < F; i++)
+        x.data[i] = pseudo_rand_int32(&seed) >> shr;
+      bfp_s32_headroom(&x);
+
+      memmove(&block[0], &block[F], F * sizeof(double));
+      for(unsigned i = 0; i < F; i++)
+        block[F + i] = ldexp(x.data[i], x.exp);
+
+      mdct_forward(&mdct, &X, &x);
+
+      TEST_ASSERT_EQUAL(F, X.length);
+      TEST_ASSERT_EQUAL(vect_s32_headroom(X.data, F), X.hr);
+
+      double expected[MAX_FRAME];
+      double max_mag = 0;
+      for(unsigned k = 0; k < F; k++){
+        expected[k] = 0;
+        for(unsigned n = 0; n < 2*F; n++)
+          expected[k] += window_dbl[n] * block[n] * mdct_basis(F, n, k);
+        max_mag = (fabs(expected[k]) > max_mag)? fabs(expected[k]) : max_mag;
+      }
+
+      const int32_t threshold = (int32_t) ceil(ldexp(max_mag, -20 - X.exp)) + 1;
+      for(unsigned k = 0; k < F; k++)
+        TEST_ASSERT_INT32_WITHIN(threshold, (int32_t) llround(ldexp(expected[k], -X.exp)), X.data[k]);
+    }
+  }
+}
+
+
+TEST(mdct, mdct_inverse)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t X_data[MAX_FRAME];
+  DWORD_ALIGNED int32_t y_data[MAX_FRAME];
+  double overlap[MAX_FRAME];
+
+  for(unsigned l = 0; l < LENGTH_COUNT; l++){
+    const unsigned F = frame_lengths[l];
+
+    make_window(F);
+
+    mdct_s32_t mdct;
+    mdct_init(&mdct, imdct_buffer, window, F);
+
+    memset(overlap, 0, sizeof(overlap));
+
+    for(int t = 0; t < FRAMES; t++){
+      sprintf(msg_buff, "( F: %u; frame: %d )", F, t);
+      UNITY_SET_DETAIL(msg_buff);
+
+      bfp_s32_t X, y;
+      bfp_s32_init(&X, X_data, pseudo_rand_int(&seed, -40, -20), F, 0);
+      bfp_s32_init(&y, y_data, 0, F, 0);
+
+      const right_shift_t shr = pseudo_rand_uint(&seed, 0, 12);
+      for(unsigned k = 0; k < F; k++)
+        X.data[k] = pseudo_rand_int32(&seed) >> shr;
+      bfp_s32_headroom(&X);
+
+      double block[2 * MAX_FRAME];
+      for(unsigned n = 0; n < 2*F; n++){
+        block[n] = 0;
+        for(unsigned k = 0; k < F; k++)
+          block[n] += ldexp(X.data[k], X.exp) * mdct_basis(F, n, k);
+        block[n] *= window_dbl[n] * 2.0 / F;
+      }
+
+      mdct_inverse(&mdct, &y, &X);
+
+      TEST_ASSERT_EQUAL(F, y.length);
+      TEST_ASSERT_EQUAL(vect_s32_headroom(y.data, F), y.hr);
+
+      double expected[MAX_FRAME];
+      double max_mag = 0;
+      for(unsigned n = 0; n < F; n++){
+        expected[n] = block[n] + overlap[n];
+        overlap[n] = block[F + n];
+        max_mag = (fabs(expected[n]) > max_mag)? fabs(expected[n]) : max_mag;
+      }
+
+      const int32_t threshold = (int32_t) ceil(ldexp(max_mag, -20 - y.exp)) + 1;
+      for(unsigned n = 0; n < F; n++)
+        TEST_ASSERT_INT32_WITHIN(threshold, (int32_t) llround(ldexp(expected[n], -y.exp)), y.data[n]);
+    }
+  }
+}
+
+
+// With a Princen-Bradley window, the IMDCT of the MDCT gives back the input, one frame later.
+TEST(mdct, mdct_round_trip)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x_data[MAX_FRAME];
+  DWORD_ALIGNED int32_t X_data[MAX_FRAME];
+  DWORD_ALIGNED int32_t y_data[MAX_FRAME];
+  double prev[MAX_FRAME];
+
+  for(unsigned l = 0; l < LENGTH_COUNT; l++){
+    const unsigned F = frame_lengths[l];
+
+    make_window(F);
+
+    mdct_s32_t fwd, inv;
+    mdct_init(&fwd, mdct_buffer, window, F);
+    mdct_init(&inv, imdct_buffer, window, F);
+
+    memset(prev, 0, sizeof(prev));
+
+    for(int t = 0; t < FRAMES; t++){
+      sprintf(msg_buff, "( F: %u; frame: %d )", F, t);
+      UNITY_SET_DETAIL(msg_buff);
+
+      bfp_s32_t x, X, y;
+      bfp_s32_init(&x, x_data, -31, F, 0);
+      bfp_s32_init(&X, X_data, 0, F, 0);
+      bfp_s32_init(&y, y_data, 0, F, 0);
+
+      for(unsigned i = 0; i < F; i++)
+        x.data[i] = pseudo_rand_int32(&seed) >> 1;
+      bfp_s32_headroom(&x);
+
+      mdct_forward(&fwd, &X, &x);
+      mdct_inverse(&inv, &y, &X);
+
+      for(unsigned i = 0; i < F; i++)
+        TEST_ASSERT_INT32_WITHIN(1 << 10, (int32_t) llround(ldexp(prev[i], 31)),
+                                 (int32_t) llround(ldexp(y.data[i], y.exp + 31)));
+
+      for(unsigned i = 0; i < F; i++)
+        prev[i] = ldexp(x.data[i], x.exp);
+    }
+  }
+}
@@ -0,0 +1,273 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "xmath/xmath.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+TEST_GROUP_RUNNER(mfcc) {
+  RUN_TEST_CASE(mfcc, mel_filterbank_init);
+  RUN_TEST_CASE(mfcc, mel_filterbank_energy);
+  RUN_TEST_CASE(mfcc, mel_filterbank_log_energy);
+  RUN_TEST_CASE(mfcc, mfcc_s32);
+}
+
+TEST_GROUP(mfcc);
+TEST_SETUP(mfcc) { fflush(stdout); }
+TEST_TEAR_DOWN(mfcc) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (3)
+#else
+#  define REPS       (40)
+#endif
+
+#define MAX_FFT     (1024)
+#define MAX_BANDS   (64)
+
+typedef struct {
+  unsigned fft_length;
+  unsigned band_count;
+  unsigned coef_count;
+  float sample_rate;
+  float min_freq;
+  float max_freq;
+} mfcc_config_t;
+
+static const mfcc_config_t configs[] = {
+  {  512, 40, 13, 16000.0f,   20.0f, 8000.0f },
+  {  256, 23, 12,  8000.0f,    0.0f, 4000.0f },
+  { 1024, 64, 20, 16000.0f,  100.0f, 7000.0f },
+  {  128, 10, 10, 16000.0f,  300.0f, 8000.0f },
+};
+#define CONFIG_COUNT  (sizeof(configs) / sizeof(configs[0]))
+
+static char msg_buff[200];
+
+static int32_t fb_buffer[MEL_FILTERBANK_BUFFER_WORDS(MAX_FFT, MAX_BANDS)];
+static DWORD_ALIGNED int32_t mfcc_buffer[MFCC_S32_BUFFER_WORDS(MAX_BANDS, MAX_BANDS)];
+
+
+static double dbl_mel(
+    const double freq)
+{
+  return log(1.0 + freq / 700.0);
+}
+
+
+// Random spectrum, with each bin's magnitude within a factor of 2^4 of full scale
+static void rand_spectrum(
+    bfp_complex_s32_t* X,
+    complex_s32_t data[],
+    const unsigned fft_length,
+    unsigned* seed)
+{
+  bfp_complex_s32_init(X, data, pseudo_rand_int(seed, -40, -10), fft_length / 2, 0);
+  for(unsigned k = 0; k < fft_length / 2; k++){
+    const right_shift_t shr = pseudo_rand_uint(seed, 1, 5);
+    data[k].re = pseudo_rand_int32(seed) >> shr;
+    data[k].im = pseudo_rand_int32(seed) >> shr;
+  }
+  bfp_complex_s32_headroom(X);
+}
+
+
+// Reference band energies, using the filterbank's own weights
+static void dbl_mel_energy(
+    double E[],
+    const mel_filterbank_t* fb,
+    const bfp_complex_s32_t* X)
+{
+  const unsigned half = fb->fft_length / 2;
+  const q2_30* weight = fb->weight;
+
+  for(unsigned m = 0; m < fb->band_count; m++){
+    E[m] = 0;
+    for(unsigned i = 0; i < fb->band_length[m]; i++){
+      const unsigned k = fb->band_start[m] + i;
+      const double re = ldexp((k == half)? X->data[0].im : X->data[k].re, X->exp);
+      const double im = ((k == 0) || (k == half))? 0 : ldexp(X->data[k].im, X->exp);
+      E[m] += ldexp(weight[i], -30) * (re * re + im * im);
+    }
+    weight += fb->band_length[m];
+  }
+}
+
+
+TEST(mfcc, mel_filterbank_init)
+{
+  for(unsigned c = 0; c < CONFIG_COUNT; c++){
+    const mfcc_config_t* cfg = &configs[c];
+    sprintf(msg_buff, "( config: %u )", c);
+    UNITY_SET_DETAIL(msg_buff);
+
+    mel_filterbank_t fb;
+    mel_filterbank_init(&fb, fb_buffer, cfg->fft_length, cfg->band_count,
+                        cfg->sample_rate, cfg->min_freq, cfg->max_freq);
+
+    TEST_ASSERT_EQUAL(cfg->fft_length, fb.fft_length);
+    TEST_ASSERT_EQUAL(cfg->band_count, fb.band_count);
+
+    const unsigned bins = cfg->fft_length / 2 + 1;
+    const double mel_min = dbl_mel(cfg->min_freq);
+    const double step = (dbl_mel(cfg->max_freq) - mel_min) / (cfg->band_count + 1);
+    // Weights are computed in single precision, from the approximate f32_log2()
+    const int32_t tolerance = 1 << 21;
+
+    const q2_30* weight = fb.weight;
+    unsigned total = 0;
+
+    for(unsigned m = 0; m < cfg->band_count; m++){
+      if(m)
+        TEST_ASSERT_GREATER_OR_EQUAL(fb.band_start[m-1], fb.band_start[m]);
+      TEST_ASSERT_LESS_OR_EQUAL(bins, fb.band_start[m] + fb.band_length[m]);
+
+      // Every bin should have the triangular weight if it's in the span, and (nearly) 0 otherwise
+      const double lower = mel_min + m * step;
+      for(unsigned k = 0; k < bins; k++){
+        const double mel = dbl_mel(k * (double) cfg->sample_rate / cfg->fft_length);
+        double expected = (mel <= lower + step)? (mel - lower) / step : (lower + 2*step - mel) / step;
+        expected = (expected < 0)? 0 : expected;
+
+        const unsigned in_span = (k >= fb.band_start[m]) && (k < fb.band_start[m] + fb.band_length[m]);
+        const int32_t actual = in_span? weight[k - fb.band_start[m]] : 0;
+
+        TEST_ASSERT_INT32_WITHIN(tolerance, (int32_t) llround(ldexp(expected, 30)), actual);
+        TEST_ASSERT_GREATER_OR_EQUAL(0, actual);
+      }
+
+      weight += fb.band_length[m];
+      total += fb.band_length[m];
+    }
+
+    TEST_ASSERT_LESS_OR_EQUAL(cfg->fft_length + 2, total);
+  }
+}
+
+
+TEST(mfcc, mel_filterbank_energy)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED complex_s32_t X_data[MAX_FFT / 2];
+  DWORD_ALIGNED int32_t mel_data[MAX_BANDS];
+  double expected[MAX_BANDS];
+
+  for(unsigned c = 0; c < CONFIG_COUNT; c++){
+    const mfcc_config_t* cfg = &configs[c];
+
+    mel_filterbank_t fb;
+    mel_filterbank_init(&fb, fb_buffer, cfg->fft_length, cfg->band_count,
+                        cfg->sample_rate, cfg->min_freq, cfg->max_freq);
+
+    for(int t = 0; t < REPS; t++){
+      sprintf(msg_buff, "( config: %u; rep: %d )", c, t);
+      UNITY_SET_DETAIL(msg_buff);
+
+      bfp_complex_s32_t X;
+      bfp_s32_t mel;
+      rand_spectrum(&X, X_data, cfg->fft_length, &seed);
+      bfp_s32_init(&mel, mel_data, 0, cfg->band_count, 0);
+
+      dbl_mel_energy(expected, &fb, &X);
+
+      mel_filterbank_energy(&fb, &mel, &X);
+
+      TEST_ASSERT_EQUAL(cfg->band_count, mel.length);
+      TEST_ASSERT_EQUAL(vect_s32_headroom(mel.data, mel.length), mel.hr);
+      TEST_ASSERT_EQUAL(0, mel.hr);
+
+      for(unsigned m = 0; m < cfg->band_count; m++)
+        TEST_ASSERT_INT32_WITHIN(8, (int32_t) llround(ldexp(expected[m], -mel.exp)), mel.data[m]);
+    }
+  }
+}
+
+
+TEST(mfcc, mel_filterbank_log_energy)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED complex_s32_t X_data[MAX_FFT / 2];
+  DWORD_ALIGNED q8_24 log_mel[MAX_BANDS];
+  double expected[MAX_BANDS];
+
+  for(unsigned c = 0; c < CONFIG_COUNT; c++){
+    const mfcc_config_t* cfg = &configs[c];
+
+    mel_filterbank_t fb;
+    mel_filterbank_init(&fb, fb_buffer, cfg->fft_length, cfg->band_count,
+                        cfg->sample_rate, cfg->min_freq, cfg->max_freq);
+
+    for(int t = 0; t < REPS; t++){
+      sprintf(msg_buff, "( config: %u; rep: %d )", c, t);
+      UNITY_SET_DETAIL(msg_buff);
+
+      bfp_complex_s32_t X;
+      rand_spectrum(&X, X_data, cfg->fft_length, &seed);
+
+      dbl_mel_energy(expected, &fb, &X);
+
+      mel_filterbank_log_energy(&fb, log_mel, &X);
+
+      // vect_s32_log() is accurate to a few parts in 10^3
+      for(unsigned m = 0; m < cfg->band_count; m++)
+        TEST_ASSERT_INT32_WITHIN(1 << 16, (int32_t) llround(ldexp(log(expected[m]), 24)), log_mel[m]);
+    }
+  }
+}
+
+
+TEST(mfcc, mfcc_s32)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED complex_s32_t X_data[MAX_FFT / 2];
+  DWORD_ALIGNED int32_t coef_data[MAX_BANDS];
+  double E[MAX_BANDS];
+
+  for(unsigned c = 0; c < CONFIG_COUNT; c++){
+    const mfcc_config_t* cfg = &configs[c];
+    const unsigned M = cfg->band_count;
+
+    mel_filterbank_t fb;
+    mel_filterbank_init(&fb, fb_buffer, cfg->fft_length, M,
+                        cfg->sample_rate, cfg->min_freq, cfg->max_freq);
+
+    mfcc_s32_t mfcc;
+    mfcc_s32_init(&mfcc, mfcc_buffer, &fb, cfg->coef_count);
+
+    for(int t = 0; t < REPS; t++){
+      sprintf(msg_buff, "( config: %u; frame: %d )", c, t);
+      UNITY_SET_DETAIL(msg_buff);
+
+      bfp_complex_s32_t X;
+      bfp_s32_t coef;
+      rand_spectrum(&X, X_data, cfg->fft_length, &seed);
+      bfp_s32_init(&coef, coef_data, 0, cfg->coef_count, 0);
+
+      dbl_mel_energy(E, &fb, &X);
+
+      mfcc_s32(&mfcc, &coef, &X);
+
+      TEST_ASSERT_EQUAL(cfg->coef_count, coef.length);
+      TEST_ASSERT_EQUAL(vect_s32_headroom(coef.data, coef.length), coef.hr);
+
+      for(unsigned i = 0; i < cfg->coef_count; i++){
+        double expected = 0;
+        for(unsigned m = 0; m < M; m++)
+          expected += log(E[m]) * cos(M_PI * i * (2*m + 1) / (2*M));
+
+        const int32_t threshold = (int32_t) ceil(ldexp(M, -8 - coef.exp));
+        TEST_ASSERT_INT32_WITHIN(threshold, (int32_t) llround(ldexp(expected, -coef.exp)), coef.data[i]);
+      }
+    }
+  }
+}
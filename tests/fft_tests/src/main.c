@@ -35,6 +35,9 @@ int main(int argc, const char* argv[])
 
   RUN_TEST_GROUP(bfp_fft);
   RUN_TEST_GROUP(bfp_fft_packing);
+  RUN_TEST_GROUP(czt);
+  RUN_TEST_GROUP(xcorr);
+  RUN_TEST_GROUP(fft_analytic);
   
   RUN_TEST_GROUP(vect_f32_fft);
   
@@ -0,0 +1,228 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "xmath/xmath.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+TEST_GROUP_RUNNER(czt) {
+  RUN_TEST_CASE(czt, czt_s32_complex);
+  RUN_TEST_CASE(czt, czt_s32_mono);
+  RUN_TEST_CASE(czt, czt_s32_arbitrary_dft);
+}
+
+TEST_GROUP(czt);
+TEST_SETUP(czt) { fflush(stdout); }
+TEST_TEAR_DOWN(czt) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (10)
+#else
+#  define REPS       (200)
+#endif
+
+#define MAX_FFT     (512)
+#define MAX_N       (300)
+#define MAX_M       (256)
+
+static char msg_buff[200];
+
+static DWORD_ALIGNED int32_t czt_buffer[CZT_S32_BUFFER_WORDS(MAX_FFT, MAX_N, MAX_M)];
+
+
+static unsigned fft_length_for(
+    const unsigned N,
+    const unsigned M)
+{
+  unsigned L = 1;
+  while(L < N + M - 1)
+    L <<= 1;
+  return L;
+}
+
+
+// Direct evaluation of X_k = sum_n x_n exp(-j 2 pi n (f0 + k df))
+static void dbl_czt(
+    double X_re[],
+    double X_im[],
+    const double x_re[],
+    const double x_im[],
+    const unsigned N,
+    const unsigned M,
+    const float f0,
+    const float df)
+{
+  for(unsigned k = 0; k < M; k++){
+    X_re[k] = 0;
+    X_im[k] = 0;
+    for(unsigned n = 0; n < N; n++){
+      // Reduce the phase modulo one turn before scaling by 2 pi
+      double turns = n * ((double) f0 + k * (double) df);
+      turns -= floor(turns);
+      const double c = cos(2 * M_PI * turns);
+      const double s = sin(2 * M_PI * turns);
+      X_re[k] += x_re[n] * c + x_im[n] * s;
+      X_im[k] += x_im[n] * c - x_re[n] * s;
+    }
+  }
+}
+
+
+// Errors are allowed relative to the largest possible output magnitude. The FFT, spectrum product
+// and IFFT each round at the block exponent, so a few bits are lost against that bound.
+static void check_bins(
+    const bfp_complex_s32_t* X,
+    const double X_re[],
+    const double X_im[],
+    const unsigned M,
+    const double bound)
+{
+  const double threshold = ldexp(bound, -18);
+
+  TEST_ASSERT_EQUAL(M, X->length);
+  TEST_ASSERT_EQUAL(vect_complex_s32_headroom(X->data, M), X->hr);
+
+  for(unsigned k = 0; k < M; k++){
+    TEST_ASSERT_FLOAT_WITHIN(threshold, X_re[k], ldexp(X->data[k].re, X->exp));
+    TEST_ASSERT_FLOAT_WITHIN(threshold, X_im[k], ldexp(X->data[k].im, X->exp));
+  }
+}
+
+
+TEST(czt, czt_s32_complex)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED complex_s32_t x_data[MAX_N];
+  DWORD_ALIGNED complex_s32_t X_data[MAX_M];
+  double x_re[MAX_N], x_im[MAX_N], X_re[MAX_M], X_im[MAX_M];
+
+  for(int t = 0; t < REPS; t++){
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_N + 1);
+    const unsigned M = pseudo_rand_uint(&seed, 1, MIN(MAX_M, MAX_FFT + 1 - N) + 1);
+    const unsigned L = fft_length_for(N, M);
+    const float f0 = ldexp(pseudo_rand_int32(&seed), -32);
+    const float df = ldexp(pseudo_rand_int32(&seed), -32 - pseudo_rand_uint(&seed, 0, 10));
+
+    sprintf(msg_buff, "( rep: %d; N: %u; M: %u; f0: %f; df: %e )", t, N, M, f0, df);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_complex_s32_t x, X;
+    bfp_complex_s32_init(&x, x_data, pseudo_rand_int(&seed, -40, -20), N, 0);
+    const right_shift_t shr = pseudo_rand_uint(&seed, 0, 8);
+    for(unsigned n = 0; n < N; n++){
+      x_data[n].re = pseudo_rand_int32(&seed) >> shr;
+      x_data[n].im = pseudo_rand_int32(&seed) >> shr;
+      x_re[n] = ldexp(x_data[n].re, x.exp);
+      x_im[n] = ldexp(x_data[n].im, x.exp);
+    }
+    bfp_complex_s32_headroom(&x);
+    bfp_complex_s32_init(&X, X_data, 0, M, 0);
+
+    czt_s32_t czt;
+    czt_s32_init(&czt, czt_buffer, L, N, M, f0, df);
+
+    dbl_czt(X_re, X_im, x_re, x_im, N, M, f0, df);
+
+    czt_s32_complex(&czt, &X, &x);
+
+    // The input is unchanged
+    TEST_ASSERT_EQUAL_INT32(x_data[0].re, (int32_t) ldexp(x_re[0], -x.exp));
+
+    check_bins(&X, X_re, X_im, M, N * ldexp(1.0, 32 - shr + x.exp));
+  }
+}
+
+
+TEST(czt, czt_s32_mono)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x_data[MAX_N];
+  DWORD_ALIGNED complex_s32_t X_data[MAX_M];
+  double x_re[MAX_N], x_im[MAX_N], X_re[MAX_M], X_im[MAX_M];
+
+  for(int t = 0; t < REPS; t++){
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_N + 1);
+    const unsigned M = pseudo_rand_uint(&seed, 1, MIN(MAX_M, MAX_FFT + 1 - N) + 1);
+    const unsigned L = fft_length_for(N, M);
+    const float f0 = ldexp(pseudo_rand_int32(&seed), -32);
+    const float df = ldexp(pseudo_rand_int32(&seed), -32 - pseudo_rand_uint(&seed, 0, 10));
+
+    sprintf(msg_buff, "( rep: %d; N: %u; M: %u; f0: %f; df: %e )", t, N, M, f0, df);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_s32_t x;
+    bfp_complex_s32_t X;
+    bfp_s32_init(&x, x_data, pseudo_rand_int(&seed, -40, -20), N, 0);
+    const right_shift_t shr = pseudo_rand_uint(&seed, 0, 8);
+    for(unsigned n = 0; n < N; n++){
+      x_data[n] = pseudo_rand_int32(&seed) >> shr;
+      x_re[n] = ldexp(x_data[n], x.exp);
+      x_im[n] = 0;
+    }
+    bfp_s32_headroom(&x);
+    bfp_complex_s32_init(&X, X_data, 0, M, 0);
+
+    czt_s32_t czt;
+    czt_s32_init(&czt, czt_buffer, L, N, M, f0, df);
+
+    dbl_czt(X_re, X_im, x_re, x_im, N, M, f0, df);
+
+    czt_s32_mono(&czt, &X, &x);
+
+    check_bins(&X, X_re, X_im, M, N * ldexp(1.0, 31 - shr + x.exp));
+  }
+}
+
+
+// With f0 = 0, df = 1/N and M = N, the chirp-z transform is a DFT of any length
+TEST(czt, czt_s32_arbitrary_dft)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  const unsigned lengths[] = { 3, 12, 100, 205, 256 };
+
+  DWORD_ALIGNED complex_s32_t x_data[MAX_N];
+  DWORD_ALIGNED complex_s32_t X_data[MAX_N];
+  double x_re[MAX_N], x_im[MAX_N], X_re[MAX_N], X_im[MAX_N];
+
+  for(unsigned i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++){
+    const unsigned N = lengths[i];
+    const unsigned L = fft_length_for(N, N);
+
+    sprintf(msg_buff, "( N: %u )", N);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_complex_s32_t x, X;
+    bfp_complex_s32_init(&x, x_data, -31, N, 0);
+    for(unsigned n = 0; n < N; n++){
+      x_data[n].re = pseudo_rand_int32(&seed) >> 1;
+      x_data[n].im = pseudo_rand_int32(&seed) >> 1;
+      x_re[n] = ldexp(x_data[n].re, x.exp);
+      x_im[n] = ldexp(x_data[n].im, x.exp);
+    }
+    bfp_complex_s32_headroom(&x);
+    bfp_complex_s32_init(&X, X_data, 0, N, 0);
+
+    // The buffer is large enough for these lengths
+    TEST_ASSERT_LESS_OR_EQUAL(CZT_S32_BUFFER_WORDS(MAX_FFT, MAX_N, MAX_M),
+                              CZT_S32_BUFFER_WORDS(L, N, N));
+
+    czt_s32_t czt;
+    czt_s32_init(&czt, czt_buffer, L, N, N, 0.0f, 1.0f / N);
+
+    dbl_czt(X_re, X_im, x_re, x_im, N, N, 0.0f, 1.0f / N);
+
+    czt_s32_complex(&czt, &X, &x);
+
+    check_bins(&X, X_re, X_im, N, N);
+  }
+}
@@ -0,0 +1,139 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "xmath/xmath.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+TEST_GROUP_RUNNER(fft_analytic) {
+  RUN_TEST_CASE(fft_analytic, bfp_fft_analytic_mono);
+  RUN_TEST_CASE(fft_analytic, bfp_fft_analytic_mono_tone);
+}
+
+TEST_GROUP(fft_analytic);
+TEST_SETUP(fft_analytic) { fflush(stdout); }
+TEST_TEAR_DOWN(fft_analytic) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (10)
+#else
+#  define REPS       (100)
+#endif
+
+#define MAX_FFT_LOG2  (10)
+#define MAX_FFT       (1 << MAX_FFT_LOG2)
+
+static char msg_buff[200];
+
+
+// Hilbert transform by direct DFT: -j on positive frequencies and +j on negative ones
+static void dbl_hilbert(
+    double h[],
+    const double x[],
+    const unsigned N)
+{
+  double X_re[MAX_FFT / 2], X_im[MAX_FFT / 2];
+
+  for(unsigned f = 1; f < N / 2; f++){
+    X_re[f] = 0;
+    X_im[f] = 0;
+    for(unsigned n = 0; n < N; n++){
+      const double theta = 2 * M_PI * (double) ((f * n) % N) / N;
+      X_re[f] += x[n] * cos(theta);
+      X_im[f] -= x[n] * sin(theta);
+    }
+  }
+
+  // The negative frequencies are the conjugates of the positive ones, so each pair contributes
+  // twice the real part of its positive term
+  for(unsigned n = 0; n < N; n++){
+    h[n] = 0;
+    for(unsigned f = 1; f < N / 2; f++){
+      const double theta = 2 * M_PI * (double) ((f * n) % N) / N;
+      h[n] += 2 * (X_im[f] * cos(theta) + X_re[f] * sin(theta));
+    }
+    h[n] /= N;
+  }
+}
+
+
+TEST(fft_analytic, bfp_fft_analytic_mono)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x_data[MAX_FFT];
+  DWORD_ALIGNED complex_s32_t z_data[MAX_FFT];
+  double x_ref[MAX_FFT], h_ref[MAX_FFT];
+
+  for(int t = 0; t < REPS; t++){
+    const unsigned N = 1 << pseudo_rand_uint(&seed, 4, MAX_FFT_LOG2 + 1);
+
+    sprintf(msg_buff, "( rep: %d; N: %u )", t, N);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_s32_t x;
+    bfp_complex_s32_t z;
+    bfp_s32_init(&x, x_data, pseudo_rand_int(&seed, -40, 0), N, 0);
+    const right_shift_t shr = pseudo_rand_uint(&seed, 0, 8);
+    for(unsigned n = 0; n < N; n++){
+      x_data[n] = pseudo_rand_int32(&seed) >> shr;
+      x_ref[n] = ldexp(x_data[n], x.exp);
+    }
+    bfp_s32_headroom(&x);
+    bfp_complex_s32_init(&z, z_data, 0, N, 0);
+
+    dbl_hilbert(h_ref, x_ref, N);
+
+    bfp_fft_analytic_mono(&z, &x);
+
+    TEST_ASSERT_EQUAL(N, z.length);
+    TEST_ASSERT_EQUAL(vect_complex_s32_headroom(z.data, N), z.hr);
+    TEST_ASSERT_EQUAL(0, z.hr);
+
+    // The real part is the input, and the imaginary part is rounded by the forward and inverse FFTs
+    const double peak = ldexp(1.0, 31 - shr + x.exp);
+    for(unsigned n = 0; n < N; n++){
+      TEST_ASSERT_FLOAT_WITHIN(ldexp(1.0, z.exp), x_ref[n], ldexp(z.data[n].re, z.exp));
+      TEST_ASSERT_FLOAT_WITHIN(ldexp(peak, -20), h_ref[n], ldexp(z.data[n].im, z.exp));
+    }
+  }
+}
+
+
+// The analytic signal of a cosine on a bin is a complex exponential
+TEST(fft_analytic, bfp_fft_analytic_mono_tone)
+{
+  const unsigned N = 256;
+
+  DWORD_ALIGNED int32_t x_data[256];
+  DWORD_ALIGNED complex_s32_t z_data[256];
+
+  for(unsigned bin = 1; bin < N / 2; bin += 9){
+    sprintf(msg_buff, "( bin: %u )", bin);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_s32_t x;
+    bfp_complex_s32_t z;
+    bfp_s32_init(&x, x_data, -30, N, 0);
+    for(unsigned n = 0; n < N; n++)
+      x_data[n] = (int32_t) lround(ldexp(cos(2 * M_PI * bin * n / N + 0.3) + 0.25, 29));
+    bfp_s32_headroom(&x);
+    bfp_complex_s32_init(&z, z_data, 0, N, 0);
+
+    bfp_fft_analytic_mono(&z, &x);
+
+    // The DC offset appears only in the real part
+    for(unsigned n = 0; n < N; n++){
+      const double phase = 2 * M_PI * bin * n / N + 0.3;
+      TEST_ASSERT_FLOAT_WITHIN(ldexp(1, -20), 0.5 * cos(phase) + 0.125, ldexp(z.data[n].re, z.exp));
+      TEST_ASSERT_FLOAT_WITHIN(ldexp(1, -20), 0.5 * sin(phase), ldexp(z.data[n].im, z.exp));
+    }
+  }
+}
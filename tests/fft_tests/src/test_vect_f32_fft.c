@@ -15,6 +15,8 @@
 TEST_GROUP_RUNNER(vect_f32_fft) {
   RUN_TEST_CASE(vect_f32_fft, fft_f32_forward);
   RUN_TEST_CASE(vect_f32_fft, fft_f32_inverse);
+  RUN_TEST_CASE(vect_f32_fft, fft_f32_forward_complex);
+  RUN_TEST_CASE(vect_f32_fft, fft_f32_inverse_complex);
 }
 
 TEST_GROUP(vect_f32_fft);
@@ -209,3 +211,142 @@ TEST(vect_f32_fft, fft_f32_inverse)
 
 #undef FUNC_NAME
 }
+
+
+
+
+
+TEST(vect_f32_fft, fft_f32_forward_complex)
+{
+#define FUNC_NAME "fft_f32_forward_complex"
+
+#if PRINT_FUNC_NAMES
+  printf("\n%s..\n", FUNC_NAME);
+#endif
+
+  unsigned r = 1;
+
+  for(unsigned k = 2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+    unsigned FFT_N = (1<<k);
+    float worst_timing = 0.0f;
+
+    double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+    flt_make_sine_table_double(sine_table, FFT_N);
+
+    for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+
+      DWORD_ALIGNED
+      complex_float_t a[MAX_PROC_FRAME_LENGTH];
+      DWORD_ALIGNED
+      complex_double_t ref[MAX_PROC_FRAME_LENGTH];
+
+      const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+
+      for(unsigned i = 0; i < FFT_N; i++){
+        ref[i].re = a[i].re = ldexpf((float) pseudo_rand_int32(&r), initial_exponent);
+        ref[i].im = a[i].im = ldexpf((float) pseudo_rand_int32(&r), initial_exponent);
+      }
+
+      flt_bit_reverse_indexes_double(ref, FFT_N);
+      flt_fft_forward_double(ref, FFT_N, sine_table);
+
+      unsigned ts1 = getTimestamp();
+      fft_f32_forward_complex(a, FFT_N);
+      unsigned ts2 = getTimestamp();
+
+      float timing = (float) ((ts2-ts1)/100.0);
+      if(timing > worst_timing) worst_timing = timing;
+
+      double ref_max = 0.0;
+      for(unsigned int f = 0; f < FFT_N; f++){
+        ref_max = MAX(ref_max, fabs(ref[f].re));
+        ref_max = MAX(ref_max, fabs(ref[f].im));
+      }
+
+      // Floating-point butterflies should do considerably better than the BFP implementation
+      double max_diff = ldexp(1, -20) * ref_max;
+
+      for(unsigned int f = 0; f < FFT_N; f++){
+        TEST_ASSERT( fabs(ref[f].re - a[f].re) <= max_diff );
+        TEST_ASSERT( fabs(ref[f].im - a[f].im) <= max_diff );
+      }
+    }
+
+#if TIME_FUNCS
+    printf("    %s (%u-point): %f us\n", FUNC_NAME, FFT_N, worst_timing);
+#endif
+  }
+
+#undef FUNC_NAME
+}
+
+
+
+
+
+TEST(vect_f32_fft, fft_f32_inverse_complex)
+{
+#define FUNC_NAME "fft_f32_inverse_complex"
+
+#if PRINT_FUNC_NAMES
+  printf("\n%s..\n", FUNC_NAME);
+#endif
+
+  unsigned r = 1;
+
+  for(unsigned k = 2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+    unsigned FFT_N = (1<<k);
+    float worst_timing = 0.0f;
+
+    double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+    flt_make_sine_table_double(sine_table, FFT_N);
+
+    for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+
+      DWORD_ALIGNED
+      complex_float_t a[MAX_PROC_FRAME_LENGTH];
+      DWORD_ALIGNED
+      complex_double_t ref[MAX_PROC_FRAME_LENGTH];
+
+      const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+
+      for(unsigned i = 0; i < FFT_N; i++){
+        ref[i].re = a[i].re = ldexpf((float) pseudo_rand_int32(&r), initial_exponent);
+        ref[i].im = a[i].im = ldexpf((float) pseudo_rand_int32(&r), initial_exponent);
+      }
+
+      flt_bit_reverse_indexes_double(ref, FFT_N);
+      flt_fft_inverse_double(ref, FFT_N, sine_table);
+
+      unsigned ts1 = getTimestamp();
+      fft_f32_inverse_complex(a, FFT_N);
+      unsigned ts2 = getTimestamp();
+
+      float timing = (float) ((ts2-ts1)/100.0);
+      if(timing > worst_timing) worst_timing = timing;
+
+      double ref_max = 0.0;
+      for(unsigned int n = 0; n < FFT_N; n++){
+        ref_max = MAX(ref_max, fabs(ref[n].re));
+        ref_max = MAX(ref_max, fabs(ref[n].im));
+      }
+
+      double max_diff = ldexp(1, -20) * ref_max;
+
+      for(unsigned int n = 0; n < FFT_N; n++){
+        TEST_ASSERT( fabs(ref[n].re - a[n].re) <= max_diff );
+        TEST_ASSERT( fabs(ref[n].im - a[n].im) <= max_diff );
+      }
+    }
+
+#if TIME_FUNCS
+    printf("    %s (%u-point): %f us\n", FUNC_NAME, FFT_N, worst_timing);
+#endif
+  }
+
+#undef FUNC_NAME
+}
@@ -0,0 +1,318 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "xmath/xmath.h"
+#include "testing.h"
+#include "tst_common.h"
+#include "unity_fixture.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+TEST_GROUP_RUNNER(xcorr) {
+  RUN_TEST_CASE(xcorr, bfp_fft_xcorr_none);
+  RUN_TEST_CASE(xcorr, bfp_fft_xcorr_phat);
+  RUN_TEST_CASE(xcorr, bfp_fft_xcorr_pairs);
+  RUN_TEST_CASE(xcorr, bfp_s32_xcorr_peak_fractional);
+}
+
+TEST_GROUP(xcorr);
+TEST_SETUP(xcorr) { fflush(stdout); }
+TEST_TEAR_DOWN(xcorr) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (10)
+#else
+#  define REPS       (100)
+#endif
+
+#define MAX_FFT_LOG2  (9)
+#define MAX_FFT       (1 << MAX_FFT_LOG2)
+#define MICS          (4)
+
+static char msg_buff[200];
+
+static DWORD_ALIGNED int32_t xcorr_buffer[XCORR_S32_BUFFER_WORDS(MAX_FFT)];
+
+
+// Full-length DFT of a real signal
+static void dbl_dft(
+    double X_re[],
+    double X_im[],
+    const double x[],
+    const unsigned N)
+{
+  for(unsigned f = 0; f < N; f++){
+    X_re[f] = 0;
+    X_im[f] = 0;
+    for(unsigned n = 0; n < N; n++){
+      const double theta = 2 * M_PI * ((f * n) % N) / N;
+      X_re[f] += x[n] * cos(theta);
+      X_im[f] -= x[n] * sin(theta);
+    }
+  }
+}
+
+
+// Inverse DFT of (weighted) X * conj(Y), keeping the real part
+static void dbl_xcorr(
+    double r[],
+    const double x[],
+    const double y[],
+    const unsigned N,
+    const xcorr_weighting_e weighting)
+{
+  double X_re[MAX_FFT], X_im[MAX_FFT], Y_re[MAX_FFT], Y_im[MAX_FFT];
+  double C_re[MAX_FFT], C_im[MAX_FFT];
+  dbl_dft(X_re, X_im, x, N);
+  dbl_dft(Y_re, Y_im, y, N);
+
+  for(unsigned f = 0; f < N; f++){
+    C_re[f] = X_re[f] * Y_re[f] + X_im[f] * Y_im[f];
+    C_im[f] = X_im[f] * Y_re[f] - X_re[f] * Y_im[f];
+    if(weighting == XCORR_WEIGHT_PHAT){
+      const double mag = sqrt(C_re[f] * C_re[f] + C_im[f] * C_im[f]);
+      C_re[f] = (mag == 0)? 0 : C_re[f] / mag;
+      C_im[f] = (mag == 0)? 0 : C_im[f] / mag;
+    }
+  }
+
+  for(unsigned n = 0; n < N; n++){
+    r[n] = 0;
+    for(unsigned f = 0; f < N; f++){
+      const double theta = 2 * M_PI * ((f * n) % N) / N;
+      r[n] += C_re[f] * cos(theta) - C_im[f] * sin(theta);
+    }
+    r[n] /= N;
+  }
+}
+
+
+// Random signal, and its spectrum as computed by bfp_fft_forward_mono()
+static void rand_signal(
+    bfp_complex_s32_t* X,
+    int32_t data[],
+    double x[],
+    const unsigned N,
+    unsigned* seed)
+{
+  bfp_s32_t t;
+  bfp_s32_init(&t, data, pseudo_rand_int(seed, -40, -20), N, 0);
+  const right_shift_t shr = pseudo_rand_uint(seed, 0, 8);
+  for(unsigned n = 0; n < N; n++){
+    data[n] = pseudo_rand_int32(seed) >> shr;
+    x[n] = ldexp(data[n], t.exp);
+  }
+  bfp_s32_headroom(&t);
+  *X = *bfp_fft_forward_mono(&t);
+}
+
+
+// Spectrum of a signal given in double precision
+static void signal_spectrum(
+    bfp_complex_s32_t* X,
+    int32_t data[],
+    const double x[],
+    const unsigned N)
+{
+  bfp_s32_t t;
+  bfp_s32_init(&t, data, -24, N, 0);
+  for(unsigned n = 0; n < N; n++)
+    data[n] = (int32_t) lround(ldexp(x[n], 24));
+  bfp_s32_headroom(&t);
+  *X = *bfp_fft_forward_mono(&t);
+}
+
+
+static void check_xcorr(
+    const bfp_s32_t* r,
+    const double expected[],
+    const unsigned N,
+    const double threshold)
+{
+  TEST_ASSERT_EQUAL(N, r->length);
+  TEST_ASSERT(r->data == xcorr_buffer);
+  TEST_ASSERT_EQUAL(vect_s32_headroom(r->data, N), r->hr);
+
+  for(unsigned n = 0; n < N; n++)
+    TEST_ASSERT_FLOAT_WITHIN(threshold, expected[n], ldexp(r->data[n], r->exp));
+}
+
+
+TEST(xcorr, bfp_fft_xcorr_none)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x_data[MAX_FFT];
+  DWORD_ALIGNED int32_t y_data[MAX_FFT];
+  double x[MAX_FFT], y[MAX_FFT], expected[MAX_FFT];
+
+  for(int t = 0; t < REPS; t++){
+    const unsigned N = 1 << pseudo_rand_uint(&seed, 4, MAX_FFT_LOG2 + 1);
+
+    sprintf(msg_buff, "( rep: %d; N: %u )", t, N);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_complex_s32_t X, Y;
+    rand_signal(&X, x_data, x, N, &seed);
+    rand_signal(&Y, y_data, y, N, &seed);
+
+    // r[tau] = sum_n x[n + tau] y[n]
+    for(unsigned tau = 0; tau < N; tau++){
+      expected[tau] = 0;
+      for(unsigned n = 0; n < N; n++)
+        expected[tau] += x[(n + tau) % N] * y[n];
+    }
+
+    double bound = 0;
+    for(unsigned n = 0; n < N; n++)
+      bound += fabs(x[n]) * fabs(y[n]);
+
+    const complex_s32_t X0 = X.data[0];
+
+    bfp_s32_t r;
+    bfp_fft_xcorr(&r, xcorr_buffer, &X, &Y, XCORR_WEIGHT_NONE);
+
+    // The spectra are not modified
+    TEST_ASSERT_EQUAL_INT32(X0.re, X.data[0].re);
+    TEST_ASSERT_EQUAL_INT32(X0.im, X.data[0].im);
+
+    check_xcorr(&r, expected, N, ldexp(bound, -20));
+  }
+}
+
+
+TEST(xcorr, bfp_fft_xcorr_phat)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED int32_t x_data[MAX_FFT];
+  DWORD_ALIGNED int32_t y_data[MAX_FFT];
+  double x[MAX_FFT], y[MAX_FFT], expected[MAX_FFT];
+
+  for(int t = 0; t < REPS; t++){
+    const unsigned N = 1 << pseudo_rand_uint(&seed, 4, MAX_FFT_LOG2 + 1);
+
+    sprintf(msg_buff, "( rep: %d; N: %u )", t, N);
+    UNITY_SET_DETAIL(msg_buff);
+
+    bfp_complex_s32_t X, Y;
+    rand_signal(&X, x_data, x, N, &seed);
+    rand_signal(&Y, y_data, y, N, &seed);
+
+    dbl_xcorr(expected, x, y, N, XCORR_WEIGHT_PHAT);
+
+    bfp_s32_t r;
+    bfp_fft_xcorr(&r, xcorr_buffer, &X, &Y, XCORR_WEIGHT_PHAT);
+
+    // The weighted cross-spectrum has unit magnitude, so the result is at most 1
+    check_xcorr(&r, expected, N, ldexp(1.0, -16));
+  }
+}
+
+
+// Each microphone hears the same source with a different (circular) delay and some noise
+TEST(xcorr, bfp_fft_xcorr_pairs)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  const unsigned N = MAX_FFT;
+  const unsigned max_lag = 40;
+  static const unsigned pairs[][2] = { {0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3} };
+  const unsigned pair_count = sizeof(pairs) / sizeof(pairs[0]);
+
+  DWORD_ALIGNED int32_t mic_data[MICS][MAX_FFT];
+  double source[MAX_FFT], mic[MAX_FFT];
+
+  for(int t = 0; t < REPS; t++){
+    int delay[MICS];
+
+    for(unsigned n = 0; n < N; n++)
+      source[n] = ldexp(pseudo_rand_int32(&seed), -31);
+
+    bfp_complex_s32_t spectra[MICS];
+    for(int m = 0; m < MICS; m++){
+      delay[m] = pseudo_rand_int(&seed, -(int) max_lag / 2, (int) max_lag / 2 + 1);
+      for(unsigned n = 0; n < N; n++)
+        mic[n] = source[(n + N - delay[m]) % N] + ldexp(pseudo_rand_int32(&seed), -34);
+      signal_spectrum(&spectra[m], mic_data[m], mic, N);
+    }
+
+    sprintf(msg_buff, "( rep: %d; delays: %d, %d, %d, %d )", t,
+            delay[0], delay[1], delay[2], delay[3]);
+    UNITY_SET_DETAIL(msg_buff);
+
+    for(int w = XCORR_WEIGHT_NONE; w <= XCORR_WEIGHT_PHAT; w++){
+      xcorr_peak_t peaks[6];
+      bfp_fft_xcorr_pairs(peaks, xcorr_buffer, spectra, pairs, pair_count,
+                          (xcorr_weighting_e) w, max_lag);
+
+      for(unsigned p = 0; p < pair_count; p++){
+        const int expected = delay[pairs[p][0]] - delay[pairs[p][1]];
+        TEST_ASSERT_FLOAT_WITHIN(0.25, expected, peaks[p].lag);
+
+        // The peak value is the correlation at the nearest lag
+        bfp_s32_t r;
+        bfp_fft_xcorr(&r, xcorr_buffer, &spectra[pairs[p][0]], &spectra[pairs[p][1]],
+                      (xcorr_weighting_e) w);
+        const unsigned k = (expected < 0)? N + expected : (unsigned) expected;
+        TEST_ASSERT_EQUAL_INT32(r.data[k], peaks[p].value.mant);
+        TEST_ASSERT_EQUAL_INT32(r.exp, peaks[p].value.exp);
+      }
+    }
+  }
+}
+
+
+// A band-limited source delayed by a fraction of a sample
+TEST(xcorr, bfp_s32_xcorr_peak_fractional)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  const unsigned N = 256;
+  const unsigned max_lag = 20;
+
+  DWORD_ALIGNED int32_t x_data[MAX_FFT];
+  DWORD_ALIGNED int32_t y_data[MAX_FFT];
+  double x[MAX_FFT], y[MAX_FFT];
+  double amp[MAX_FFT / 2], phase[MAX_FFT / 2];
+
+  for(int t = 0; t < REPS; t++){
+    // Multiples of 1/256 of a sample, up to max_lag / 2
+    const int max_delay = (int) (max_lag << 7);
+    const double delay = ldexp(pseudo_rand_int(&seed, -max_delay, max_delay), -8);
+
+    sprintf(msg_buff, "( rep: %d; delay: %f )", t, delay);
+    UNITY_SET_DETAIL(msg_buff);
+
+    // Components up to a quarter of the sample rate
+    for(unsigned f = 1; f < N / 4; f++){
+      amp[f] = ldexp(pseudo_rand_uint(&seed, 1, 1 << 16), -20);
+      phase[f] = ldexp(pseudo_rand_int32(&seed), -31) * M_PI;
+    }
+    for(unsigned n = 0; n < N; n++){
+      x[n] = 0;
+      y[n] = 0;
+      for(unsigned f = 1; f < N / 4; f++){
+        const double w = 2 * M_PI * f / N;
+        x[n] += amp[f] * cos(w * (n - delay) + phase[f]);
+        y[n] += amp[f] * cos(w * n + phase[f]);
+      }
+    }
+
+    bfp_complex_s32_t X, Y;
+    signal_spectrum(&X, x_data, x, N);
+    signal_spectrum(&Y, y_data, y, N);
+
+    for(int w = XCORR_WEIGHT_NONE; w <= XCORR_WEIGHT_PHAT; w++){
+      bfp_s32_t r;
+      bfp_fft_xcorr(&r, xcorr_buffer, &X, &Y, (xcorr_weighting_e) w);
+      const xcorr_peak_t peak = bfp_s32_xcorr_peak(&r, max_lag);
+
+      TEST_ASSERT_FLOAT_WITHIN(0.1, delay, peak.lag);
+    }
+  }
+}
@@ -0,0 +1,164 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(filter_fdaf_s32) {
+  RUN_TEST_CASE(filter_fdaf_s32, no_adapt);
+  RUN_TEST_CASE(filter_fdaf_s32, identify_constrain_all);
+  RUN_TEST_CASE(filter_fdaf_s32, identify_constrain_alternating);
+}
+
+TEST_GROUP(filter_fdaf_s32);
+TEST_SETUP(filter_fdaf_s32) { fflush(stdout); }
+TEST_TEAR_DOWN(filter_fdaf_s32) {}
+
+
+#define FRAME       (32)
+#define PARTS       (4)
+#define TAPS        (100)
+
+#if SMOKE_TEST
+#  define FRAMES    (200)
+#else
+#  define FRAMES    (400)
+#endif
+
+// Frames at the end of the run over which the residual error is measured.
+#define TAIL        (20)
+
+
+static int32_t DWORD_ALIGNED buffer[FILTER_FDAF_S32_BUFFER_WORDS(FRAME, PARTS)];
+static bfp_complex_s32_t X[PARTS];
+static bfp_complex_s32_t W[PARTS];
+
+
+static double frame_energy(
+    const bfp_s32_t* v)
+{
+  double total = 0;
+  for(unsigned k = 0; k < v->length; k++){
+    const double s = ldexp(v->data[k], v->exp);
+    total += s * s;
+  }
+  return total;
+}
+
+
+// Runs a system identification of a random FIR and returns the final error attenuation in dB.
+static double identify(
+    unsigned* seed,
+    const filter_fdaf_constraint_e constraint)
+{
+  filter_fdaf_s32_t filter;
+  const float_s32_t mu = { 0x40000000 / (2 * PARTS), -30 };
+  const float_s32_t delta = { 1, -30 };
+
+  filter_fdaf_s32_init(&filter, X, W, buffer, FRAME, PARTS, mu, delta, 0x3C000000, constraint);
+
+  double h[TAPS];
+  for(int k = 0; k < TAPS; k++)
+    h[k] = ldexp(pseudo_rand_int32(seed), -31) * exp(-k / 30.0);
+
+  double x_hist[TAPS] = { 0 };
+
+  int32_t x_data[FRAME], d_data[FRAME], e_data[FRAME];
+  bfp_s32_t x_vec, d_vec, e_vec;
+
+  double e_energy = 0;
+  double d_energy = 0;
+
+  for(int t = 0; t < FRAMES; t++){
+    for(int n = 0; n < FRAME; n++){
+      x_data[n] = pseudo_rand_int32(seed) >> 4;
+
+      memmove(&x_hist[1], &x_hist[0], sizeof(double) * (TAPS - 1));
+      x_hist[0] = ldexp(x_data[n], -31);
+
+      double acc = 0;
+      for(int k = 0; k < TAPS; k++)
+        acc += h[k] * x_hist[k];
+      d_data[n] = conv_double_to_s32(acc, -31, NULL);
+    }
+
+    bfp_s32_init(&x_vec, x_data, -31, FRAME, 1);
+    bfp_s32_init(&d_vec, d_data, -31, FRAME, 1);
+    bfp_s32_init(&e_vec, e_data, 0, FRAME, 0);
+
+    filter_fdaf_s32(&filter, &e_vec, &d_vec, &x_vec, 1);
+
+    if(t >= FRAMES - TAIL){
+      e_energy += frame_energy(&e_vec);
+      d_energy += frame_energy(&d_vec);
+    }
+  }
+
+  return 10 * log10(d_energy / e_energy);
+}
+
+
+TEST(filter_fdaf_s32, no_adapt)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  filter_fdaf_s32_t filter;
+  const float_s32_t mu = { 0x40000000, -30 };
+  const float_s32_t delta = { 1, -30 };
+
+  filter_fdaf_s32_init(&filter, X, W, buffer, FRAME, PARTS, mu, delta, 0x3C000000,
+                       FDAF_CONSTRAIN_ALL);
+
+  int32_t x_data[FRAME], d_data[FRAME], e_data[FRAME];
+  bfp_s32_t x_vec, d_vec, e_vec;
+
+  for(int t = 0; t < 10; t++){
+    for(int n = 0; n < FRAME; n++){
+      x_data[n] = pseudo_rand_int32(&seed) >> 2;
+      d_data[n] = pseudo_rand_int32(&seed) >> 6;
+    }
+
+    bfp_s32_init(&x_vec, x_data, -31, FRAME, 1);
+    bfp_s32_init(&d_vec, d_data, -31, FRAME, 1);
+    bfp_s32_init(&e_vec, e_data, 0, FRAME, 0);
+
+    // With zero weights the error is just the desired signal.
+    filter_fdaf_s32(&filter, &e_vec, &d_vec, &x_vec, 0);
+
+    bfp_s32_use_exponent(&e_vec, -31);
+
+    TEST_ASSERT_INT32_ARRAY_WITHIN(1, d_data, e_data, FRAME);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(0, filter.frame_count);
+}
+
+
+TEST(filter_fdaf_s32, identify_constrain_all)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  const double erle = identify(&seed, FDAF_CONSTRAIN_ALL);
+
+  TEST_ASSERT_GREATER_THAN_INT32(60, (int32_t) erle);
+}
+
+
+TEST(filter_fdaf_s32, identify_constrain_alternating)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  const double erle = identify(&seed, FDAF_CONSTRAIN_ALTERNATING);
+
+  // The unconstrained updates leave some circular-convolution misadjustment.
+  TEST_ASSERT_GREATER_THAN_INT32(15, (int32_t) erle);
+}
@@ -0,0 +1,201 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(filter_goertzel_s32) {
+  RUN_TEST_CASE(filter_goertzel_s32, goertzel_block);
+  RUN_TEST_CASE(filter_goertzel_s32, goertzel_tone);
+  RUN_TEST_CASE(filter_goertzel_s32, sdft_tracking);
+}
+
+TEST_GROUP(filter_goertzel_s32);
+TEST_SETUP(filter_goertzel_s32) { fflush(stdout); }
+TEST_TEAR_DOWN(filter_goertzel_s32) {}
+
+
+#define MAX_BINS    (32)
+#define MAX_LEN     (512)
+
+#if SMOKE_TEST
+#  define REPS      (10)
+#else
+#  define REPS      (100)
+#endif
+
+static char msg_buff[200];
+
+static int32_t state[FILTER_SDFT_S32_STATE_WORDS(MAX_BINS, MAX_LEN)];
+
+
+// DFT bin of x[0:N], i.e. sum of x[n] e^(-j 2 pi bin n / N)
+static void dbl_dft_bin(
+    double* re,
+    double* im,
+    const int32_t x[],
+    const unsigned N,
+    const unsigned bin)
+{
+  *re = 0;
+  *im = 0;
+  for(unsigned n = 0; n < N; n++){
+    const double theta = 2 * M_PI * (double) ((bin * n) % N) / N;
+    *re += x[n] * cos(theta);
+    *im -= x[n] * sin(theta);
+  }
+}
+
+
+static void rand_bins(
+    unsigned bins[],
+    const unsigned K,
+    const unsigned N,
+    unsigned* seed)
+{
+  for(unsigned k = 0; k < K; k++)
+    bins[k] = pseudo_rand_uint(seed, 1, (N + 1) / 2);
+}
+
+
+TEST(filter_goertzel_s32, goertzel_block)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  unsigned bins[MAX_BINS];
+  int32_t x[MAX_LEN];
+  DWORD_ALIGNED complex_s32_t X_data[MAX_BINS];
+
+  for(int r = 0; r < REPS; r++){
+    const unsigned N = pseudo_rand_uint(&seed, 16, MAX_LEN + 1);
+    const unsigned K = pseudo_rand_uint(&seed, 1, MAX_BINS + 1);
+    const right_shift_t x_shr = pseudo_rand_uint(&seed, 0, 8);
+
+    sprintf(msg_buff, "( rep: %d; N: %u; K: %u )", r, N, K);
+    UNITY_SET_DETAIL(msg_buff);
+
+    rand_bins(bins, K, N, &seed);
+
+    filter_goertzel_s32_t filter;
+    filter_goertzel_s32_init(&filter, state, bins, K, N);
+
+    bfp_complex_s32_t X;
+    bfp_complex_s32_init(&X, X_data, 0, K, 0);
+
+    // Blocks are independent
+    for(int b = 0; b < 2; b++){
+      for(unsigned n = 0; n < N; n++)
+        x[n] = pseudo_rand_int32(&seed) >> x_shr;
+
+      filter_goertzel_s32_block(&filter, &X, x);
+
+      TEST_ASSERT_EQUAL(K, X.length);
+      TEST_ASSERT_EQUAL(vect_complex_s32_headroom(X.data, K), X.hr);
+
+      // Rounding errors in the recurrence are amplified more for bins near DC or Nyquist
+      for(unsigned k = 0; k < K; k++){
+        double re, im;
+        dbl_dft_bin(&re, &im, x, N, bins[k]);
+        const double s = sin(2 * M_PI * bins[k] / N);
+        const int32_t threshold = (int32_t) ceil(4 + N / (4 * s * s));
+        TEST_ASSERT_INT32_WITHIN(threshold, (int32_t) lround(ldexp(re, -X.exp)), X.data[k].re);
+        TEST_ASSERT_INT32_WITHIN(threshold, (int32_t) lround(ldexp(im, -X.exp)), X.data[k].im);
+      }
+    }
+  }
+}
+
+
+// DTMF-style detection: a tone on one bin shows up there and not elsewhere
+TEST(filter_goertzel_s32, goertzel_tone)
+{
+  const unsigned N = 205;
+  unsigned bins[] = { 18, 20, 22, 24, 31, 34, 38, 42 };
+  const unsigned K = sizeof(bins) / sizeof(bins[0]);
+
+  int32_t x[205];
+  DWORD_ALIGNED complex_s32_t X_data[8];
+
+  filter_goertzel_s32_t filter;
+  filter_goertzel_s32_init(&filter, state, bins, K, N);
+
+  for(unsigned t = 0; t < K; t++){
+    sprintf(msg_buff, "( tone bin: %u )", bins[t]);
+    UNITY_SET_DETAIL(msg_buff);
+
+    for(unsigned n = 0; n < N; n++)
+      x[n] = (int32_t) lround(ldexp(cos(2 * M_PI * bins[t] * n / N + 0.3), 30));
+
+    bfp_complex_s32_t X;
+    bfp_complex_s32_init(&X, X_data, 0, K, 0);
+    filter_goertzel_s32_block(&filter, &X, x);
+
+    for(unsigned k = 0; k < K; k++){
+      const double mag = ldexp(sqrt(pow(X.data[k].re, 2) + pow(X.data[k].im, 2)), X.exp);
+      const double expected = (k == t)? ldexp(N / 2.0, 30) : 0.0;
+      TEST_ASSERT_FLOAT_WITHIN(ldexp(N, 30 - 16), expected, mag);
+    }
+  }
+}
+
+
+TEST(filter_goertzel_s32, sdft_tracking)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  unsigned bins[MAX_BINS];
+  int32_t x[4 * MAX_LEN];
+  DWORD_ALIGNED complex_s32_t X_data[MAX_BINS];
+
+  for(int r = 0; r < REPS; r++){
+    const unsigned N = pseudo_rand_uint(&seed, 16, MAX_LEN / 4 + 1);
+    const unsigned K = pseudo_rand_uint(&seed, 1, MAX_BINS + 1);
+    const unsigned T = 4 * N;
+
+    sprintf(msg_buff, "( rep: %d; N: %u; K: %u )", r, N, K);
+    UNITY_SET_DETAIL(msg_buff);
+
+    rand_bins(bins, K, N, &seed);
+
+    filter_sdft_s32_t filter;
+    filter_sdft_s32_init(&filter, state, bins, K, N);
+
+    bfp_complex_s32_t X;
+    bfp_complex_s32_init(&X, X_data, 0, K, 0);
+
+    for(unsigned t = 0; t < T; t++){
+      x[t] = pseudo_rand_int32(&seed) >> 1;
+      filter_sdft_s32(&filter, &X, x[t]);
+
+      TEST_ASSERT_EQUAL(K, X.length);
+      TEST_ASSERT_EQUAL(vect_complex_s32_headroom(X.data, K), X.hr);
+
+      // Window of the most recent N samples, with zeros before the first sample
+      int32_t window[MAX_LEN];
+      for(unsigned m = 0; m < N; m++){
+        const int idx = (int) t - (int) N + 1 + (int) m;
+        window[m] = (idx < 0)? 0 : x[idx];
+      }
+
+      for(unsigned k = 0; k < K; k++){
+        double re, im;
+        dbl_dft_bin(&re, &im, window, N, bins[k]);
+        const double s = sin(2 * M_PI * bins[k] / N);
+        // After re-normalisation the state carries the Goertzel error, which is at a coarser
+        // exponent than the recursion's own.
+        const int32_t threshold = (int32_t) ceil(16 + 4 * N / (s * s * s));
+        TEST_ASSERT_INT32_WITHIN(threshold, (int32_t) lround(ldexp(re, -X.exp)), X.data[k].re);
+        TEST_ASSERT_INT32_WITHIN(threshold, (int32_t) lround(ldexp(im, -X.exp)), X.data[k].im);
+      }
+    }
+  }
+}
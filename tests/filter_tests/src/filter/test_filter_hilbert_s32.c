@@ -0,0 +1,144 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(filter_hilbert_s32) {
+  RUN_TEST_CASE(filter_hilbert_s32, hilbert_block);
+  RUN_TEST_CASE(filter_hilbert_s32, hilbert_tone);
+}
+
+TEST_GROUP(filter_hilbert_s32);
+TEST_SETUP(filter_hilbert_s32) { fflush(stdout); }
+TEST_TEAR_DOWN(filter_hilbert_s32) {}
+
+
+#define MAX_TAPS    (127)
+#define MAX_LEN     (1024)
+
+#if SMOKE_TEST
+#  define REPS      (10)
+#else
+#  define REPS      (100)
+#endif
+
+static char msg_buff[200];
+
+static int32_t state[FILTER_HILBERT_S32_STATE_WORDS(MAX_TAPS)];
+
+
+TEST(filter_hilbert_s32, hilbert_block)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t x[MAX_LEN];
+  DWORD_ALIGNED complex_s32_t z_data[MAX_LEN];
+
+  for(int r = 0; r < REPS; r++){
+    const unsigned N = 4 * pseudo_rand_uint(&seed, 1, (MAX_TAPS + 1) / 4 + 1) - 1;
+    const unsigned T = pseudo_rand_uint(&seed, 1, MAX_LEN + 1);
+    const right_shift_t x_shr = pseudo_rand_uint(&seed, 0, 8);
+
+    sprintf(msg_buff, "( rep: %d; N: %u; T: %u )", r, N, T);
+    UNITY_SET_DETAIL(msg_buff);
+
+    for(unsigned t = 0; t < T; t++)
+      x[t] = pseudo_rand_int32(&seed) >> x_shr;
+
+    filter_hilbert_s32_t filter;
+    filter_hilbert_s32_init(&filter, state, N);
+
+    // The coefficients are those of the windowed ideal response (designed in single precision),
+    // and are exactly antisymmetric
+    const unsigned L = (N + 1) / 2;
+    for(unsigned i = 0; i < L; i++){
+      const int m = 2 * (int) i - (int) (N - 1) / 2;
+      const double w = 0.42 + 0.5 * cos(M_PI * m / L) + 0.08 * cos(2 * M_PI * m / L);
+      TEST_ASSERT_INT32_WITHIN(256, (int32_t) lround(ldexp(2 * w / (M_PI * m), 30)),
+                               filter.coef[i]);
+      TEST_ASSERT_EQUAL_INT32(-filter.coef[i], filter.coef[L - 1 - i]);
+    }
+
+    // The stream is processed in blocks of random lengths, which must not affect the output
+    unsigned t0 = 0;
+    while(t0 < T){
+      const unsigned len = pseudo_rand_uint(&seed, 1, T - t0 + 1);
+
+      bfp_complex_s32_t z;
+      bfp_complex_s32_init(&z, z_data, 0, len, 0);
+      filter_hilbert_s32_block(&filter, &z, &x[t0], len);
+
+      TEST_ASSERT_EQUAL(len, z.length);
+      TEST_ASSERT_EQUAL(filter.output_shr, z.exp);
+      TEST_ASSERT_EQUAL(vect_complex_s32_headroom(z.data, len), z.hr);
+
+      for(unsigned n = 0; n < len; n++){
+        const int t = t0 + n;
+
+        // Direct N-tap FIR, with each product rounded as by the VPU
+        int64_t acc = 0;
+        for(unsigned k = 0; k < N; k += 2){
+          const int64_t xk = (t - (int) k < 0)? 0 : x[t - k];
+          acc += (xk * filter.coef[k / 2] + (1 << 29)) >> 30;
+        }
+        const int c = (N - 1) / 2;
+        const int64_t re = (t - c < 0)? 0 : x[t - c];
+
+        TEST_ASSERT_INT32_WITHIN(1, (int32_t) lround(ldexp((double) re, -z.exp)), z.data[n].re);
+        TEST_ASSERT_INT32_WITHIN(1, (int32_t) lround(ldexp((double) acc, -z.exp)), z.data[n].im);
+      }
+      t0 += len;
+    }
+  }
+}
+
+
+// In the passband, a cosine becomes a sine of the same amplitude and phase
+TEST(filter_hilbert_s32, hilbert_tone)
+{
+  const unsigned taps[] = { 31, 63, 127 };
+  const unsigned T = 512;
+
+  int32_t x[512];
+  DWORD_ALIGNED complex_s32_t z_data[512];
+
+  for(unsigned i = 0; i < sizeof(taps) / sizeof(taps[0]); i++){
+    const unsigned N = taps[i];
+    const int c = (N - 1) / 2;
+
+    // The windowed response is flat away from DC and Nyquist, over a band which widens with N
+    const double f_lo = 4.0 / N;
+    for(double f = f_lo; f <= 0.5 - f_lo; f += (0.5 - 2 * f_lo) / 7){
+      sprintf(msg_buff, "( N: %u; f: %f )", N, f);
+      UNITY_SET_DETAIL(msg_buff);
+
+      for(unsigned t = 0; t < T; t++)
+        x[t] = (int32_t) lround(ldexp(cos(2 * M_PI * f * t + 0.3), 30));
+
+      filter_hilbert_s32_t filter;
+      filter_hilbert_s32_init(&filter, state, N);
+
+      bfp_complex_s32_t z;
+      bfp_complex_s32_init(&z, z_data, 0, T, 0);
+      filter_hilbert_s32_block(&filter, &z, x, T);
+
+      for(unsigned t = N; t < T; t++){
+        const double phase = 2 * M_PI * f * ((double) t - c) + 0.3;
+        TEST_ASSERT_FLOAT_WITHIN(ldexp(1, 30 - 8), ldexp(cos(phase), 30),
+                                 ldexp(z.data[t].re, z.exp));
+        TEST_ASSERT_FLOAT_WITHIN(ldexp(1, 30 - 8), ldexp(sin(phase), 30),
+                                 ldexp(z.data[t].im, z.exp));
+      }
+    }
+  }
+}
@@ -0,0 +1,256 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(filter_nlms_s32) {
+  RUN_TEST_CASE(filter_nlms_s32, fixed_matches_fir);
+  RUN_TEST_CASE(filter_nlms_s32, energy_tracking);
+  RUN_TEST_CASE(filter_nlms_s32, update_rule);
+  RUN_TEST_CASE(filter_nlms_s32, identify_sample);
+  RUN_TEST_CASE(filter_nlms_s32, identify_block);
+}
+
+TEST_GROUP(filter_nlms_s32);
+TEST_SETUP(filter_nlms_s32) { fflush(stdout); }
+TEST_TEAR_DOWN(filter_nlms_s32) {}
+
+
+#define MAX_TAPS    (64)
+#define MAX_BLOCK   (16)
+
+#if SMOKE_TEST
+#  define REPS      (20)
+#else
+#  define REPS      (200)
+#endif
+
+static char msg_buff[200];
+
+static int32_t state[FILTER_NLMS_S32_STATE_WORDS(MAX_TAPS, MAX_BLOCK)];
+
+
+// With mu = 0 the filter must behave exactly like filter_fir_s32().
+TEST(filter_nlms_s32, fixed_matches_fir)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  const unsigned block_lengths[] = { 1, 3, 8, MAX_BLOCK };
+
+  int32_t coef[MAX_TAPS];
+  int32_t fir_coef[MAX_TAPS];
+  int32_t fir_state[MAX_TAPS];
+  int32_t x[MAX_BLOCK], d[MAX_BLOCK], e[MAX_BLOCK];
+
+  for(int r = 0; r < REPS; r++){
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_TAPS + 1);
+    const unsigned B = block_lengths[r % 4];
+    const right_shift_t shift = pseudo_rand_uint(&seed, 0, 4);
+
+    sprintf(msg_buff, "( Taps: %u; Block: %u )", N, B);
+    UNITY_SET_DETAIL(msg_buff);
+
+    for(unsigned k = 0; k < N; k++)
+      fir_coef[k] = coef[k] = pseudo_rand_int32(&seed) >> 6;
+
+    filter_fir_s32_t fir;
+    memset(fir_state, 0, sizeof(fir_state));
+    filter_fir_s32_init(&fir, fir_state, N, fir_coef, shift);
+
+    filter_nlms_s32_t filter;
+    filter_nlms_s32_init(&filter, state, coef, N, B, shift, 0, 1 << 20);
+
+    for(int t = 0; t < 10; t++){
+      for(unsigned j = 0; j < B; j++){
+        x[j] = pseudo_rand_int32(&seed) >> 4;
+        d[j] = pseudo_rand_int32(&seed) >> 4;
+      }
+
+      filter_nlms_s32_block(&filter, e, d, x, 1);
+
+      for(unsigned j = 0; j < B; j++){
+        const int32_t y = filter_fir_s32(&fir, x[j]);
+        TEST_ASSERT_EQUAL_INT32(d[j] - y, e[j]);
+      }
+    }
+
+    TEST_ASSERT_EQUAL_INT32_ARRAY(fir_coef, coef, N);
+  }
+}
+
+
+// The running energy must equal the energy of the most recent num_taps samples exactly.
+TEST(filter_nlms_s32, energy_tracking)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t coef[MAX_TAPS] = { 0 };
+  int32_t hist[MAX_TAPS + 1000];
+
+  for(int r = 0; r < REPS; r++){
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_TAPS + 1);
+    const unsigned count = pseudo_rand_uint(&seed, 1, 1000);
+
+    filter_nlms_s32_t filter;
+    filter_nlms_s32_init(&filter, state, coef, N, 1, 0, 0, 1);
+
+    memset(hist, 0, sizeof(hist));
+
+    for(unsigned t = 0; t < count; t++){
+      hist[MAX_TAPS + t] = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 16);
+      filter_nlms_s32(&filter, hist[MAX_TAPS + t], 0, 0);
+    }
+
+    int64_t expected = 0;
+    for(unsigned k = 0; k < N; k++){
+      const int64_t s = hist[MAX_TAPS + count - 1 - k];
+      expected += (s * s) >> 16;
+    }
+
+    TEST_ASSERT_EQUAL_INT64(expected, filter.energy);
+  }
+}
+
+
+// A single block's coefficient update must match the NLMS rule computed in double precision.
+TEST(filter_nlms_s32, update_rule)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t coef[MAX_TAPS], coef0[MAX_TAPS];
+  int32_t x[MAX_TAPS + 2 * MAX_BLOCK], d[MAX_BLOCK], e[MAX_BLOCK];
+
+  for(int r = 0; r < REPS; r++){
+    const unsigned N = pseudo_rand_uint(&seed, 1, MAX_TAPS + 1);
+    const unsigned B = pseudo_rand_uint(&seed, 1, MAX_BLOCK + 1);
+    const right_shift_t shift = pseudo_rand_int(&seed, -2, 3);
+    const uq2_30 mu = pseudo_rand_uint32(&seed) >> 2;
+    const int64_t delta = ((int64_t) 1) << pseudo_rand_uint(&seed, 20, 50);
+    const right_shift_t x_shr = pseudo_rand_uint(&seed, 0, 16);
+
+    sprintf(msg_buff, "( rep: %d; Taps: %u; Block: %u )", r, N, B);
+    UNITY_SET_DETAIL(msg_buff);
+
+    for(unsigned k = 0; k < N; k++)
+      coef0[k] = coef[k] = pseudo_rand_int32(&seed) >> 8;
+
+    filter_nlms_s32_t filter;
+    filter_nlms_s32_init(&filter, state, coef, N, B, shift, mu, delta);
+
+    // Fill the window without adapting, and then adapt on the final block
+    const unsigned blocks = (N + B - 1) / B;
+    for(unsigned t = 0; t <= blocks; t++){
+      for(unsigned j = 0; j < B; j++){
+        x[t * B + j] = pseudo_rand_int32(&seed) >> x_shr;
+        d[j] = pseudo_rand_int32(&seed) >> x_shr;
+      }
+      filter_nlms_s32_block(&filter, e, d, &x[t * B], t == blocks);
+    }
+
+    const double scale = ldexp(mu, -30) / ldexp((double) (filter.energy + (delta >> 16)), 16);
+    const int last = blocks * B;
+
+    // The block's steps share an exponent, with enough headroom to sum B products
+    int growth = 0;
+    while((1u << growth) < B) growth++;
+
+    double max_step = 0;
+    for(unsigned j = 0; j < B; j++)
+      max_step = MAX(max_step, fabs(ldexp(scale * e[j], 30 + shift)));
+
+    for(unsigned k = 0; k < N; k++){
+      double expected = coef0[k];
+      double threshold = 2;
+      for(unsigned j = 0; j < B; j++){
+        const double step = ldexp(scale * e[j], 30 + shift);
+        const double delta_k = step * x[last + j - k];
+        expected += delta_k;
+        threshold += 1 + ldexp(max_step, growth) + ldexp(max_step * fabs(x[last + j - k]), growth - 28);
+      }
+
+      // Saturated updates are not checked
+      if(fabs(expected) >= ldexp(1, 30))
+        continue;
+
+      TEST_ASSERT_FLOAT_WITHIN(threshold, expected, (double) coef[k]);
+    }
+  }
+}
+
+
+// Runs a system identification of a random FIR and returns the final error attenuation in dB.
+static double identify(
+    unsigned* seed,
+    const unsigned B)
+{
+  const unsigned N = 48;
+  const unsigned frames = 4000 / B;
+  const unsigned tail = 160 / B;
+
+  double h[MAX_TAPS];
+  double x_hist[MAX_TAPS] = { 0 };
+  for(unsigned k = 0; k < N; k++)
+    h[k] = ldexp(pseudo_rand_int32(seed), -32) * exp(-(double) k / 16);
+
+  int32_t coef[MAX_TAPS] = { 0 };
+  filter_nlms_s32_t filter;
+  filter_nlms_s32_init(&filter, state, coef, N, B, 0, 0x20000000, 1 << 20);
+
+  int32_t x[MAX_BLOCK], d[MAX_BLOCK], e[MAX_BLOCK];
+  double e_energy = 0, d_energy = 0;
+
+  for(unsigned t = 0; t < frames; t++){
+    for(unsigned j = 0; j < B; j++){
+      x[j] = pseudo_rand_int32(seed) >> 2;
+
+      memmove(&x_hist[1], &x_hist[0], sizeof(double) * (N - 1));
+      x_hist[0] = x[j];
+
+      double acc = 0;
+      for(unsigned k = 0; k < N; k++)
+        acc += h[k] * x_hist[k];
+      d[j] = (int32_t) round(acc);
+    }
+
+    filter_nlms_s32_block(&filter, e, d, x, 1);
+
+    if(t >= frames - tail){
+      for(unsigned j = 0; j < B; j++){
+        e_energy += ((double) e[j]) * e[j];
+        d_energy += ((double) d[j]) * d[j];
+      }
+    }
+  }
+
+  return 10 * log10(d_energy / (e_energy + 1));
+}
+
+
+TEST(filter_nlms_s32, identify_sample)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  const double erle = identify(&seed, 1);
+
+  TEST_ASSERT_GREATER_THAN_INT32(60, (int32_t) erle);
+}
+
+
+TEST(filter_nlms_s32, identify_block)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  const double erle = identify(&seed, 8);
+
+  TEST_ASSERT_GREATER_THAN_INT32(60, (int32_t) erle);
+}
@@ -23,6 +23,10 @@ int main(int argc, const char* argv[])
   RUN_TEST_GROUP(filter_fir_s16_push_sample);
   RUN_TEST_GROUP(filter_biquad_s32);
   RUN_TEST_GROUP(filter_biquad_sat_s32);
+  RUN_TEST_GROUP(filter_nlms_s32);
+  RUN_TEST_GROUP(filter_fdaf_s32);
+  RUN_TEST_GROUP(filter_goertzel_s32);
+  RUN_TEST_GROUP(filter_hilbert_s32);
 
   return UNITY_END();
 }
@@ -34,6 +34,7 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(vect_clip);
     RUN_TEST_GROUP(vect_rect);
     RUN_TEST_GROUP(vect_inverse);
+    RUN_TEST_GROUP(vect_divide);
     RUN_TEST_GROUP(vect_sum);
     RUN_TEST_GROUP(vect_abs_sum);
     RUN_TEST_GROUP(vect_dot);
@@ -47,9 +48,13 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(vect_sqrt);
     RUN_TEST_GROUP(vect_log);
     RUN_TEST_GROUP(vect_exp);
+    RUN_TEST_GROUP(vect_float_s32);
+    RUN_TEST_GROUP(vect_trig);
+    RUN_TEST_GROUP(vect_activation);
     RUN_TEST_GROUP(vect_bitdepth_convert);
     RUN_TEST_GROUP(vect_macc);
     RUN_TEST_GROUP(vect_zip);
+    RUN_TEST_GROUP(vect_strided);
 
     // complex vector
     RUN_TEST_GROUP(vect_complex_add);
@@ -62,6 +67,7 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(vect_complex_real_scale);
     RUN_TEST_GROUP(vect_complex_squared_mag);
     RUN_TEST_GROUP(vect_complex_mag);
+    RUN_TEST_GROUP(vect_complex_angle);
     RUN_TEST_GROUP(vect_complex_sum);
     RUN_TEST_GROUP(vect_complex_s32_to_vect_complex_s16);
     RUN_TEST_GROUP(vect_complex_s16_to_vect_complex_s32);
@@ -75,9 +81,12 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(vect_s32_to_vect_f32);
     RUN_TEST_GROUP(vect_f32_dot);
     RUN_TEST_GROUP(vect_f32_add);
+    RUN_TEST_GROUP(vect_f32_elementwise);
+    RUN_TEST_GROUP(vect_f32_reduce);
 
     RUN_TEST_GROUP(vect_complex_f32_mul);
     RUN_TEST_GROUP(vect_complex_f32_macc);
+    RUN_TEST_GROUP(vect_complex_f32_ops);
 
 
     // misc
@@ -0,0 +1,220 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(vect_complex_angle) {
+  RUN_TEST_CASE(vect_complex_angle, vect_complex_s32_angle_basic);
+  RUN_TEST_CASE(vect_complex_angle, vect_complex_s32_angle_random);
+  RUN_TEST_CASE(vect_complex_angle, vect_complex_s16_angle_random);
+  RUN_TEST_CASE(vect_complex_angle, vect_s32_unwrap_phase);
+  RUN_TEST_CASE(vect_complex_angle, vect_complex_s32_to_polar);
+}
+
+TEST_GROUP(vect_complex_angle);
+TEST_SETUP(vect_complex_angle) { fflush(stdout); }
+TEST_TEAR_DOWN(vect_complex_angle) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+// pi in Q8.24
+#define PI_Q24       (0x3243F6B)
+
+
+extern const unsigned rot_table32_rows;
+extern const complex_s32_t rot_table32[30][4];
+
+extern const unsigned rot_table16_rows;
+extern const int16_t rot_table16[14][2][16];
+
+
+// Difference between two angles (in Q8.24), wrapped into [-pi, pi)
+static int32_t angle_diff(double expected, radian_q24_t actual)
+{
+  double diff = ldexp(actual, -24) - expected;
+  diff = remainder(diff, 2 * M_PI);
+  return (int32_t) lround(ldexp(diff, 24));
+}
+
+
+TEST(vect_complex_angle, vect_complex_s32_angle_basic)
+{
+  complex_s32_t DWORD_ALIGNED B[] = {
+    { 0x40000000, 0 },  { 0, 0x40000000 },  { -0x40000000, 0 },   { 0, -0x40000000 },
+    { 1000, 1000 },     { -1000, 1000 },    { -1000, -1000 },     { 1000, -1000 },
+    { INT32_MIN, INT32_MIN }, { INT32_MAX, INT32_MIN }, { 0, 0 }, { 1, 0 },
+  };
+  const unsigned length = sizeof(B) / sizeof(B[0]);
+  radian_q24_t A[sizeof(B) / sizeof(B[0])];
+
+  vect_complex_s32_angle(A, B, length, (complex_s32_t*) rot_table32, rot_table32_rows);
+
+  for(unsigned int i = 0; i < length; i++){
+    const double expected = atan2(B[i].im, B[i].re);
+    TEST_ASSERT_INT32_WITHIN(2, 0, angle_diff(expected, A[i]));
+    TEST_ASSERT_INT32_WITHIN(PI_Q24, 0, A[i]);
+  }
+}
+
+
+TEST(vect_complex_angle, vect_complex_s32_angle_random)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t DWORD_ALIGNED B[MAX_LEN];
+  radian_q24_t A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    headroom_t hr = pseudo_rand_uint(&seed, 0, 24);
+
+    for(unsigned int i = 0; i < length; i++){
+      B[i].re = pseudo_rand_int32(&seed) >> hr;
+      B[i].im = pseudo_rand_int32(&seed) >> hr;
+    }
+
+    vect_complex_s32_angle(A, B, length, (complex_s32_t*) rot_table32, rot_table32_rows);
+
+    for(unsigned int i = 0; i < length; i++){
+      if(B[i].re == 0 && B[i].im == 0)
+        continue;
+
+      // Small inputs cannot resolve their angle to better than about 1/|b| radians.
+      const double mag = hypot(B[i].re, B[i].im);
+      const int32_t threshold = 2 + (int32_t) ldexp(2.0 / mag, 24);
+
+      const double expected = atan2(B[i].im, B[i].re);
+      TEST_ASSERT_INT32_WITHIN(threshold, 0, angle_diff(expected, A[i]));
+    }
+  }
+}
+
+
+TEST(vect_complex_angle, vect_complex_s16_angle_random)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int16_t WORD_ALIGNED B_re[MAX_LEN];
+  int16_t WORD_ALIGNED B_im[MAX_LEN];
+  radian_q24_t A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    headroom_t hr = pseudo_rand_uint(&seed, 0, 8);
+
+    for(unsigned int i = 0; i < length; i++){
+      B_re[i] = pseudo_rand_int16(&seed) >> hr;
+      B_im[i] = pseudo_rand_int16(&seed) >> hr;
+    }
+
+    vect_complex_s16_angle(A, B_re, B_im, length, (int16_t*) rot_table16, rot_table16_rows);
+
+    for(unsigned int i = 0; i < length; i++){
+      if(B_re[i] == 0 && B_im[i] == 0)
+        continue;
+
+      const double expected = atan2(B_im[i], B_re[i]);
+
+      // The 16-bit rotation table limits precision to about 1e-4 radians
+      TEST_ASSERT_INT32_WITHIN(1 << 11, 0, angle_diff(expected, A[i]));
+    }
+  }
+}
+
+
+TEST(vect_complex_angle, vect_s32_unwrap_phase)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  radian_q24_t B[MAX_LEN];
+  radian_q24_t A[MAX_LEN];
+  double phase[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+    // A phase which drifts by less than pi per step, wrapped into [-pi, pi)
+    phase[0] = ldexp(pseudo_rand_int32(&seed), -29);
+    for(unsigned int i = 1; i < length; i++)
+      phase[i] = phase[i-1] + ldexp(pseudo_rand_int32(&seed), -31) * 0.1 * M_PI + 0.05;
+
+    for(unsigned int i = 0; i < length; i++)
+      B[i] = (radian_q24_t) lround(ldexp(remainder(phase[i], 2 * M_PI), 24));
+
+    memcpy(A, B, sizeof(B[0]) * length);
+    vect_s32_unwrap_phase(A, A, length);
+
+    const double offset = ldexp(B[0], -24) - phase[0];
+
+    for(unsigned int i = 0; i < length; i++)
+      TEST_ASSERT_INT32_WITHIN(length + 1, lround(ldexp(phase[i] + offset, 24)), A[i]);
+  }
+}
+
+
+// The single-pass polar conversion must agree with the separate angle operation.
+TEST(vect_complex_angle, vect_complex_s32_to_polar)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  complex_s32_t DWORD_ALIGNED B[MAX_LEN];
+  int32_t A_mag[MAX_LEN];
+  radian_q24_t A_angle[MAX_LEN];
+  int32_t expected_mag[MAX_LEN];
+  radian_q24_t expected_angle[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    headroom_t hr = pseudo_rand_uint(&seed, 0, 12);
+
+    for(unsigned int i = 0; i < length; i++){
+      B[i].re = pseudo_rand_int32(&seed) >> hr;
+      B[i].im = pseudo_rand_int32(&seed) >> hr;
+    }
+
+    exponent_t a_exp;
+    right_shift_t b_shr;
+    vect_complex_s32_mag_prepare(&a_exp, &b_shr, 0, vect_complex_s32_headroom(B, length));
+
+    headroom_t a_hr = vect_complex_s32_to_polar(A_mag, A_angle, B, length, b_shr,
+                                                (complex_s32_t*) rot_table32, rot_table32_rows);
+
+    // (More precise than vect_complex_s32_mag(), which does not normalize its inputs.)
+    for(unsigned int i = 0; i < length; i++)
+      expected_mag[i] = (int32_t) llround(ldexp(hypot(B[i].re, B[i].im), -b_shr));
+
+    vect_complex_s32_angle(expected_angle, B, length,
+                           (complex_s32_t*) rot_table32, rot_table32_rows);
+
+    TEST_ASSERT_EQUAL(vect_s32_headroom(A_mag, length), a_hr);
+    TEST_ASSERT_INT32_ARRAY_WITHIN(4, expected_mag, A_mag, length);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected_angle, A_angle, length);
+  }
+}
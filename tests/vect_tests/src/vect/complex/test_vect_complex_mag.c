@@ -22,6 +22,7 @@ TEST_GROUP_RUNNER(vect_complex_mag) {
   RUN_TEST_CASE(vect_complex_mag, vect_complex_s16_mag_random);
   RUN_TEST_CASE(vect_complex_mag, vect_complex_s32_mag_basic);
   RUN_TEST_CASE(vect_complex_mag, vect_complex_s32_mag_random);
+  RUN_TEST_CASE(vect_complex_mag, vect_complex_s32_mag_fast);
 }
 
 TEST_GROUP(vect_complex_mag);
@@ -456,3 +457,57 @@ TEST(vect_complex_mag, vect_complex_s32_mag_random)
 #undef REPS
 #undef THRESHOLD
 
+
+
+
+#define MAX_LEN     100
+#define REPS        ((SMOKE_TEST)?100:1000)
+TEST(vect_complex_mag, vect_complex_s32_mag_fast)
+{
+    
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    // Documented error bound for each accuracy tier, as relative error plus LSbs.
+    const double rel_tol[] = { 0.0396, 0x1p-13, 0x1p-20, 0.0 };
+    const double abs_tol[] = { 1.0, 1.0, 1.0, 2.0 };
+
+    int32_t A[MAX_LEN];
+    complex_s32_t B[MAX_LEN];
+
+    for(unsigned int v = 0; v < REPS; v++){
+
+        unsigned rep_seed = seed;
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        const unsigned iterations = v % 4;
+        
+        headroom_t B_hr = pseudo_rand_uint32(&seed) % 8;
+
+        for(unsigned int i = 0; i < len; i++){
+            B[i].re = pseudo_rand_int32(&seed) >> (B_hr + pseudo_rand_uint32(&seed) % 16);
+            B[i].im = pseudo_rand_int32(&seed) >> (B_hr + pseudo_rand_uint32(&seed) % 16);
+        }
+        
+        B_hr = vect_s32_headroom((int32_t*) B, 2*len);
+
+        right_shift_t b_shr = -(int)B_hr + 1;
+        
+        headroom_t hr = vect_complex_s32_mag_fast(A, B, len, b_shr, iterations);
+
+        for(unsigned int i = 0; i < len; i++){
+            const double re = vlashr32(B[i].re, b_shr);
+            const double im = vlashr32(B[i].im, b_shr);
+            const double expected = sqrt(re * re + im * im);
+            const double delta = fabs(A[i] - expected);
+
+            if(delta > expected * rel_tol[iterations] + abs_tol[iterations]){
+                sprintf(msg_buff, "(rep %d; seed: 0x%08X; iterations: %u) A[%i]: mag(( %d + i*%d) >> %d)",
+                        v, rep_seed, iterations, i, (int) B[i].re, (int) B[i].im, b_shr);
+                TEST_FAIL_MESSAGE(msg_buff);
+            }
+        }
+        TEST_ASSERT_EQUAL_MSG(vect_s32_headroom((int32_t*) A, len), hr, v);
+    }
+}
+#undef MAX_LEN
+#undef REPS
@@ -0,0 +1,251 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdarg.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+#include "../../tst_common.h"
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(vect_complex_f32_ops) {
+  RUN_TEST_CASE(vect_complex_f32_ops, vect_complex_f32_set_conjugate);
+  RUN_TEST_CASE(vect_complex_f32_ops, vect_complex_f32_sub_add_scalar);
+  RUN_TEST_CASE(vect_complex_f32_ops, vect_complex_f32_scale);
+  RUN_TEST_CASE(vect_complex_f32_ops, vect_complex_f32_nmacc);
+  RUN_TEST_CASE(vect_complex_f32_ops, vect_complex_f32_mag);
+  RUN_TEST_CASE(vect_complex_f32_ops, vect_complex_f32_sum);
+}
+
+TEST_GROUP(vect_complex_f32_ops);
+TEST_SETUP(vect_complex_f32_ops) { fflush(stdout); }
+TEST_TEAR_DOWN(vect_complex_f32_ops) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+static float rand_f32(
+    unsigned* seed)
+{
+  return ldexpf((float) pseudo_rand_int32(seed), pseudo_rand_int(seed, -40, 0));
+}
+
+static void rand_vect_complex_f32(
+    complex_float_t a[],
+    const unsigned len,
+    unsigned* seed)
+{
+  for(unsigned int k = 0; k < len; k++){
+    a[k].re = rand_f32(seed);
+    a[k].im = rand_f32(seed);
+  }
+}
+
+
+TEST(vect_complex_f32_ops, vect_complex_f32_set_conjugate)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED complex_float_t a[MAX_LEN];
+  DWORD_ALIGNED complex_float_t b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_complex_f32(b, len, &seed);
+
+    vect_complex_f32_conjugate(a, b, len);
+    for(unsigned int k = 0; k < len; k++){
+      TEST_ASSERT_EQUAL_FLOAT( b[k].re, a[k].re);
+      TEST_ASSERT_EQUAL_FLOAT(-b[k].im, a[k].im);
+    }
+
+    vect_complex_f32_set(a, b[0].re, b[0].im, len);
+    for(unsigned int k = 0; k < len; k++){
+      TEST_ASSERT_EQUAL_FLOAT(b[0].re, a[k].re);
+      TEST_ASSERT_EQUAL_FLOAT(b[0].im, a[k].im);
+    }
+  }
+}
+
+
+TEST(vect_complex_f32_ops, vect_complex_f32_sub_add_scalar)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED complex_float_t a[MAX_LEN];
+  DWORD_ALIGNED complex_float_t b[MAX_LEN];
+  DWORD_ALIGNED complex_float_t c[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_complex_f32(b, len, &seed);
+    rand_vect_complex_f32(c, len, &seed);
+
+    vect_complex_f32_sub(a, b, c, len);
+    for(unsigned int k = 0; k < len; k++){
+      TEST_ASSERT_EQUAL_FLOAT(b[k].re - c[k].re, a[k].re);
+      TEST_ASSERT_EQUAL_FLOAT(b[k].im - c[k].im, a[k].im);
+    }
+
+    vect_complex_f32_add_scalar(a, b, c[0], len);
+    for(unsigned int k = 0; k < len; k++){
+      TEST_ASSERT_EQUAL_FLOAT(b[k].re + c[0].re, a[k].re);
+      TEST_ASSERT_EQUAL_FLOAT(b[k].im + c[0].im, a[k].im);
+    }
+  }
+}
+
+
+TEST(vect_complex_f32_ops, vect_complex_f32_scale)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED complex_float_t a[MAX_LEN];
+  DWORD_ALIGNED complex_float_t b[MAX_LEN];
+  DWORD_ALIGNED float c[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_complex_f32(b, len, &seed);
+    for(unsigned int k = 0; k < len; k++)
+      c[k] = rand_f32(&seed);
+
+    vect_complex_f32_real_mul(a, b, c, len);
+    for(unsigned int k = 0; k < len; k++){
+      TEST_ASSERT_EQUAL_FLOAT(b[k].re * c[k], a[k].re);
+      TEST_ASSERT_EQUAL_FLOAT(b[k].im * c[k], a[k].im);
+    }
+
+    vect_complex_f32_real_scale(a, b, c[0], len);
+    for(unsigned int k = 0; k < len; k++){
+      TEST_ASSERT_EQUAL_FLOAT(b[k].re * c[0], a[k].re);
+      TEST_ASSERT_EQUAL_FLOAT(b[k].im * c[0], a[k].im);
+    }
+
+    const float c_re = c[0], c_im = c[len-1];
+    vect_complex_f32_scale(a, b, c_re, c_im, len);
+    for(unsigned int k = 0; k < len; k++){
+      const double exp_re = ((double) b[k].re) * c_re - ((double) b[k].im) * c_im;
+      const double exp_im = ((double) b[k].re) * c_im + ((double) b[k].im) * c_re;
+      const float tol = ldexpf((fabsf(b[k].re) + fabsf(b[k].im)) * (fabsf(c_re) + fabsf(c_im)), -22);
+      TEST_ASSERT_FLOAT_WITHIN(tol, (float) exp_re, a[k].re);
+      TEST_ASSERT_FLOAT_WITHIN(tol, (float) exp_im, a[k].im);
+    }
+  }
+}
+
+
+TEST(vect_complex_f32_ops, vect_complex_f32_nmacc)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED complex_float_t a[MAX_LEN];
+  DWORD_ALIGNED complex_float_t a_orig[MAX_LEN];
+  DWORD_ALIGNED complex_float_t b[MAX_LEN];
+  DWORD_ALIGNED complex_float_t c[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_complex_f32(a_orig, len, &seed);
+    rand_vect_complex_f32(b, len, &seed);
+    rand_vect_complex_f32(c, len, &seed);
+
+    for(int conj = 0; conj < 2; conj++){
+      memcpy(a, a_orig, sizeof(complex_float_t) * len);
+
+      if(conj) vect_complex_f32_conj_nmacc(a, b, c, len);
+      else     vect_complex_f32_nmacc(a, b, c, len);
+
+      for(unsigned int k = 0; k < len; k++){
+        const double c_im = conj? -c[k].im : c[k].im;
+        const double exp_re = a_orig[k].re - (((double) b[k].re) * c[k].re - ((double) b[k].im) * c_im);
+        const double exp_im = a_orig[k].im - (((double) b[k].re) * c_im + ((double) b[k].im) * c[k].re);
+        const float tol = ldexpf(fabsf(a_orig[k].re) + fabsf(a_orig[k].im)
+                          + (fabsf(b[k].re) + fabsf(b[k].im)) * (fabsf(c[k].re) + fabsf(c[k].im)), -21);
+        TEST_ASSERT_FLOAT_WITHIN(tol, (float) exp_re, a[k].re);
+        TEST_ASSERT_FLOAT_WITHIN(tol, (float) exp_im, a[k].im);
+      }
+    }
+  }
+}
+
+
+TEST(vect_complex_f32_ops, vect_complex_f32_mag)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float a[MAX_LEN];
+  DWORD_ALIGNED complex_float_t b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_complex_f32(b, len, &seed);
+
+    vect_complex_f32_squared_mag(a, b, len);
+    for(unsigned int k = 0; k < len; k++){
+      const double expected = ((double) b[k].re) * b[k].re + ((double) b[k].im) * b[k].im;
+      TEST_ASSERT_FLOAT_WITHIN(ldexpf((float) expected, -21), (float) expected, a[k]);
+    }
+
+    vect_complex_f32_mag(a, b, len);
+    for(unsigned int k = 0; k < len; k++){
+      const double expected = sqrt(((double) b[k].re) * b[k].re + ((double) b[k].im) * b[k].im);
+      TEST_ASSERT_FLOAT_WITHIN(ldexpf((float) expected, -21), (float) expected, a[k]);
+    }
+  }
+}
+
+
+TEST(vect_complex_f32_ops, vect_complex_f32_sum)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED complex_float_t b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_complex_f32(b, len, &seed);
+
+    double exp_re = 0, exp_im = 0, abs_re = 0, abs_im = 0;
+    for(unsigned int k = 0; k < len; k++){
+      exp_re += b[k].re;  abs_re += fabs(b[k].re);
+      exp_im += b[k].im;  abs_im += fabs(b[k].im);
+    }
+
+    complex_float_t res = vect_complex_f32_sum(b, len);
+
+    TEST_ASSERT_FLOAT_WITHIN(ldexpf((float) abs_re, -20), (float) exp_re, res.re);
+    TEST_ASSERT_FLOAT_WITHIN(ldexpf((float) abs_im, -20), (float) exp_im, res.im);
+  }
+}
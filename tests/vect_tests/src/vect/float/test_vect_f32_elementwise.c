@@ -0,0 +1,252 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdarg.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+#include "../../tst_common.h"
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(vect_f32_elementwise) {
+  RUN_TEST_CASE(vect_f32_elementwise, vect_f32_set_copy);
+  RUN_TEST_CASE(vect_f32_elementwise, vect_f32_sub_mul);
+  RUN_TEST_CASE(vect_f32_elementwise, vect_f32_scale_add_scalar);
+  RUN_TEST_CASE(vect_f32_elementwise, vect_f32_macc_nmacc);
+  RUN_TEST_CASE(vect_f32_elementwise, vect_f32_abs_rect_clip);
+  RUN_TEST_CASE(vect_f32_elementwise, vect_f32_max_min_elementwise);
+  RUN_TEST_CASE(vect_f32_elementwise, vect_f32_sqrt_inverse);
+}
+
+TEST_GROUP(vect_f32_elementwise);
+TEST_SETUP(vect_f32_elementwise) { fflush(stdout); }
+TEST_TEAR_DOWN(vect_f32_elementwise) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+static void rand_vect_f32(
+    float a[],
+    const unsigned len,
+    unsigned* seed)
+{
+  for(unsigned int k = 0; k < len; k++)
+    a[k] = ldexpf((float) pseudo_rand_int32(seed), pseudo_rand_int(seed, -40, 0));
+}
+
+
+TEST(vect_f32_elementwise, vect_f32_set_copy)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float a[MAX_LEN];
+  DWORD_ALIGNED float b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(b, len, &seed);
+    const float value = b[0];
+
+    vect_f32_copy(a, b, len);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT(b[k], a[k]);
+
+    vect_f32_set(a, value, len);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT(value, a[k]);
+  }
+}
+
+
+TEST(vect_f32_elementwise, vect_f32_sub_mul)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float a[MAX_LEN];
+  DWORD_ALIGNED float b[MAX_LEN];
+  DWORD_ALIGNED float c[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(b, len, &seed);
+    rand_vect_f32(c, len, &seed);
+
+    vect_f32_sub(a, b, c, len);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT(b[k] - c[k], a[k]);
+
+    vect_f32_mul(a, b, c, len);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT(b[k] * c[k], a[k]);
+  }
+}
+
+
+TEST(vect_f32_elementwise, vect_f32_scale_add_scalar)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float a[MAX_LEN];
+  DWORD_ALIGNED float b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(b, len, &seed);
+    const float c = ldexpf((float) pseudo_rand_int32(&seed), -31);
+
+    vect_f32_scale(a, b, len, c);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT(b[k] * c, a[k]);
+
+    vect_f32_add_scalar(a, b, len, c);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT(b[k] + c, a[k]);
+  }
+}
+
+
+TEST(vect_f32_elementwise, vect_f32_macc_nmacc)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  float expected[MAX_LEN];
+
+  DWORD_ALIGNED float a[MAX_LEN];
+  DWORD_ALIGNED float b[MAX_LEN];
+  DWORD_ALIGNED float c[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(a, len, &seed);
+    rand_vect_f32(b, len, &seed);
+    rand_vect_f32(c, len, &seed);
+
+    for(unsigned int k = 0; k < len; k++)
+      expected[k] = a[k];
+
+    vect_f32_macc(a, b, c, len);
+    for(unsigned int k = 0; k < len; k++){
+      const double e = ((double) expected[k]) + ((double) b[k]) * c[k];
+      TEST_ASSERT_FLOAT_WITHIN(ldexpf(fabsf(expected[k]) + fabsf(b[k] * c[k]), -22), (float) e, a[k]);
+    }
+
+    vect_f32_nmacc(a, b, c, len);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_FLOAT_WITHIN(ldexpf(fabsf(expected[k]) + fabsf(b[k] * c[k]), -21), expected[k], a[k]);
+  }
+}
+
+
+TEST(vect_f32_elementwise, vect_f32_abs_rect_clip)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float a[MAX_LEN];
+  DWORD_ALIGNED float b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(b, len, &seed);
+
+    vect_f32_abs(a, b, len);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT(fabsf(b[k]), a[k]);
+
+    vect_f32_rect(a, b, len);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT((b[k] > 0)? b[k] : 0.0f, a[k]);
+
+    const float lower = -ldexpf(1.0f, pseudo_rand_int(&seed, -10, 0));
+    const float upper = ldexpf(1.0f, pseudo_rand_int(&seed, -10, 0));
+
+    vect_f32_clip(a, b, len, lower, upper);
+    for(unsigned int k = 0; k < len; k++){
+      const float e = (b[k] < lower)? lower : (b[k] > upper)? upper : b[k];
+      TEST_ASSERT_EQUAL_FLOAT(e, a[k]);
+    }
+  }
+}
+
+
+TEST(vect_f32_elementwise, vect_f32_max_min_elementwise)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float a[MAX_LEN];
+  DWORD_ALIGNED float b[MAX_LEN];
+  DWORD_ALIGNED float c[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(b, len, &seed);
+    rand_vect_f32(c, len, &seed);
+
+    vect_f32_max_elementwise(a, b, c, len);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT((b[k] > c[k])? b[k] : c[k], a[k]);
+
+    vect_f32_min_elementwise(a, b, c, len);
+    for(unsigned int k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT((b[k] < c[k])? b[k] : c[k], a[k]);
+  }
+}
+
+
+TEST(vect_f32_elementwise, vect_f32_sqrt_inverse)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float a[MAX_LEN];
+  DWORD_ALIGNED float b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(b, len, &seed);
+
+    vect_f32_sqrt(a, b, len);
+    for(unsigned int k = 0; k < len; k++){
+      const float e = (b[k] > 0)? sqrtf(b[k]) : 0.0f;
+      TEST_ASSERT_FLOAT_WITHIN(ldexpf(e, -22), e, a[k]);
+    }
+
+    vect_f32_inverse(a, b, len);
+    for(unsigned int k = 0; k < len; k++){
+      const float e = 1.0f / b[k];
+      TEST_ASSERT_FLOAT_WITHIN(ldexpf(fabsf(e), -22), e, a[k]);
+    }
+  }
+}
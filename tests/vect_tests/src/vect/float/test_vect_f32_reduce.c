@@ -0,0 +1,125 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdarg.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+#include "../../tst_common.h"
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(vect_f32_reduce) {
+  RUN_TEST_CASE(vect_f32_reduce, vect_f32_max_min);
+  RUN_TEST_CASE(vect_f32_reduce, vect_f32_sum);
+  RUN_TEST_CASE(vect_f32_reduce, vect_f32_energy);
+}
+
+TEST_GROUP(vect_f32_reduce);
+TEST_SETUP(vect_f32_reduce) { fflush(stdout); }
+TEST_TEAR_DOWN(vect_f32_reduce) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+static void rand_vect_f32(
+    float a[],
+    const unsigned len,
+    unsigned* seed)
+{
+  for(unsigned int k = 0; k < len; k++)
+    a[k] = ldexpf((float) pseudo_rand_int32(seed), pseudo_rand_int(seed, -40, 0));
+}
+
+
+TEST(vect_f32_reduce, vect_f32_max_min)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(b, len, &seed);
+
+    // Force a tie to check that the lowest index is reported
+    if(len > 2 && (v & 1))
+      b[len-1] = b[pseudo_rand_uint(&seed, 0, len-1)];
+
+    unsigned exp_argmax = 0, exp_argmin = 0;
+    for(unsigned int k = 1; k < len; k++){
+      if(b[k] > b[exp_argmax]) exp_argmax = k;
+      if(b[k] < b[exp_argmin]) exp_argmin = k;
+    }
+
+    TEST_ASSERT_EQUAL_UINT(exp_argmax, vect_f32_argmax(b, len));
+    TEST_ASSERT_EQUAL_UINT(exp_argmin, vect_f32_argmin(b, len));
+    TEST_ASSERT_EQUAL_FLOAT(b[exp_argmax], vect_f32_max(b, len));
+    TEST_ASSERT_EQUAL_FLOAT(b[exp_argmin], vect_f32_min(b, len));
+  }
+}
+
+
+TEST(vect_f32_reduce, vect_f32_sum)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(b, len, &seed);
+
+    double expected = 0, expected_abs = 0;
+    for(unsigned int k = 0; k < len; k++){
+      expected += b[k];
+      expected_abs += fabs(b[k]);
+    }
+
+    // Error bound scales with the magnitude of the terms, not of the result
+    const float tol = ldexpf((float) expected_abs, -20);
+
+    TEST_ASSERT_FLOAT_WITHIN(tol, (float) expected, vect_f32_sum(b, len));
+    TEST_ASSERT_FLOAT_WITHIN(tol, (float) expected_abs, vect_f32_abs_sum(b, len));
+  }
+}
+
+
+TEST(vect_f32_reduce, vect_f32_energy)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED float b[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_f32(b, len, &seed);
+
+    double expected = 0;
+    for(unsigned int k = 0; k < len; k++)
+      expected += ((double) b[k]) * b[k];
+
+    TEST_ASSERT_FLOAT_WITHIN(ldexpf((float) expected, -20), (float) expected, vect_f32_energy(b, len));
+  }
+}
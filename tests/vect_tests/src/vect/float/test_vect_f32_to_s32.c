@@ -17,6 +17,8 @@
 
 TEST_GROUP_RUNNER(vect_f32_to_vect_s32) {
   RUN_TEST_CASE(vect_f32_to_vect_s32, vect_f32_to_vect_s32);
+  RUN_TEST_CASE(vect_f32_to_vect_s32, vect_f32_to_vect_s32_wide_range);
+  RUN_TEST_CASE(vect_f32_to_vect_s32, vect_f32_to_vect_s32_auto_exp);
 }
 
 TEST_GROUP(vect_f32_to_vect_s32);
@@ -78,3 +80,80 @@ TEST(vect_f32_to_vect_s32, vect_f32_to_vect_s32)
 }
 
 
+TEST(vect_f32_to_vect_s32, vect_f32_to_vect_s32_wide_range)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED
+  float vec_in[MAX_LEN];
+  DWORD_ALIGNED
+  int32_t vec_out[MAX_LEN];
+  int32_t expected[MAX_LEN];
+
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    // Exponents spanning much more than 32 bits, and some exact zeros
+    for(unsigned int i = 0; i < len; i++){
+      int32_t mant = pseudo_rand_int32(&seed);
+      exponent_t exp = pseudo_rand_int(&seed, -100, 60);
+      vec_in[i] = (pseudo_rand_uint(&seed, 0, 8) == 0)? 0.0f : ldexpf((float) mant, exp);
+    }
+
+    // Output exponents above and below the ideal one, so that some elements are shifted out
+    // entirely and others saturate.
+    exponent_t exp_out = vect_f32_max_exponent(vec_in, len) + pseudo_rand_int(&seed, -40, 40);
+
+    for(unsigned int k = 0; k < len; k++){
+      float_s32_t f32 = f32_to_float_s32(vec_in[k]);
+      expected[k] = vlashr32(f32.mant, exp_out - f32.exp);
+    }
+
+    vect_f32_to_vect_s32(vec_out, vec_in, len, exp_out);
+
+    TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(expected, vec_out, len, "");
+  }
+}
+
+
+TEST(vect_f32_to_vect_s32, vect_f32_to_vect_s32_auto_exp)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  DWORD_ALIGNED
+  float vec_in[MAX_LEN];
+  DWORD_ALIGNED
+  int32_t vec_out[MAX_LEN];
+  int32_t expected[MAX_LEN];
+
+
+  for(unsigned int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+
+    unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    for(unsigned int i = 0; i < len; i++){
+      int32_t mant = pseudo_rand_int32(&seed);
+      exponent_t exp = pseudo_rand_int(&seed, -30, 30);
+      vec_in[i] = ldexpf((float) mant, exp);
+    }
+
+    const headroom_t hr = pseudo_rand_uint(&seed, 0, 4);
+    const exponent_t expected_exp = vect_f32_max_exponent(vec_in, len) + hr;
+
+    vect_f32_to_vect_s32(expected, vec_in, len, expected_exp);
+
+    // In-place
+    exponent_t exp_out = vect_f32_to_vect_s32_auto_exp((int32_t*) vec_in, vec_in, len, hr);
+    memcpy(vec_out, vec_in, sizeof(int32_t) * len);
+
+    TEST_ASSERT_EQUAL_INT32(expected_exp, exp_out);
+    TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(expected, vec_out, len, "");
+    TEST_ASSERT_EQUAL(hr, vect_s32_headroom(vec_out, len));
+  }
+}
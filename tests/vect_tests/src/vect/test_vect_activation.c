@@ -0,0 +1,145 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+#include "../tst_common.h"
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(vect_activation) {
+  RUN_TEST_CASE(vect_activation, vect_s32_logistic);
+  RUN_TEST_CASE(vect_activation, vect_s32_tanh);
+  RUN_TEST_CASE(vect_activation, vect_s32_relu_to_vect_s16);
+  RUN_TEST_CASE(vect_activation, vect_s32_relu_to_vect_s8);
+}
+
+TEST_GROUP(vect_activation);
+TEST_SETUP(vect_activation) { fflush(stdout); }
+TEST_TEAR_DOWN(vect_activation) {}
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+TEST(vect_activation, vect_s32_logistic)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  q8_24 B[MAX_LEN];
+  q8_24 A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+    for(unsigned int i = 0; i < length; i++)
+      B[i] = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 8);
+
+    B[0] = INT32_MIN;
+    B[length-1] = 0;
+
+    memcpy(A, B, sizeof(int32_t) * length);
+    vect_s32_logistic(A, A, length);
+
+    for(unsigned int i = 0; i < length; i++){
+      double expected = 1.0 / (1.0 + exp(-ldexp(B[i], -24)));
+      TEST_ASSERT_INT32_WITHIN(2, llround(ldexp(expected, 24)), A[i]);
+    }
+  }
+}
+
+
+TEST(vect_activation, vect_s32_tanh)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  q8_24 B[MAX_LEN];
+  q2_30 A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+    for(unsigned int i = 0; i < length; i++)
+      B[i] = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 12);
+
+    // Saturates the logistic
+    B[length/2] = INT32_MAX;
+    B[0] = INT32_MIN;
+    B[length-1] = 0;
+
+    vect_s32_tanh(A, B, length);
+
+    for(unsigned int i = 0; i < length; i++){
+      double expected = tanh(ldexp(B[i], -24));
+      TEST_ASSERT_INT32_WITHIN(16, llround(ldexp(expected, 30)), A[i]);
+    }
+  }
+}
+
+
+TEST(vect_activation, vect_s32_relu_to_vect_s16)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN];
+  int16_t WORD_ALIGNED A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    right_shift_t b_shr = pseudo_rand_int(&seed, 8, 20);
+
+    for(unsigned int i = 0; i < length; i++)
+      B[i] = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 8);
+
+    vect_s32_relu_to_vect_s16(A, B, length, b_shr);
+
+    for(unsigned int i = 0; i < length; i++){
+      int32_t expected = (B[i] < 0)? 0 : (int32_t) ((((int64_t) B[i]) + (1 << (b_shr - 1))) >> b_shr);
+      expected = MIN(expected, INT16_MAX);
+      TEST_ASSERT_EQUAL_INT16(expected, A[i]);
+    }
+  }
+}
+
+
+TEST(vect_activation, vect_s32_relu_to_vect_s8)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN];
+  int8_t WORD_ALIGNED A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    right_shift_t b_shr = pseudo_rand_int(&seed, 16, 28);
+
+    for(unsigned int i = 0; i < length; i++)
+      B[i] = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 8);
+
+    vect_s32_relu_to_vect_s8(A, B, length, b_shr);
+
+    for(unsigned int i = 0; i < length; i++){
+      int32_t expected = (B[i] < 0)? 0 : (int32_t) ((((int64_t) B[i]) + (1 << (b_shr - 1))) >> b_shr);
+      expected = MIN(expected, INT8_MAX);
+      TEST_ASSERT_EQUAL_INT8(expected, A[i]);
+    }
+  }
+}
@@ -0,0 +1,178 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdarg.h>
+
+#include "xmath/xmath.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+TEST_GROUP_RUNNER(vect_divide) {
+  RUN_TEST_CASE(vect_divide, vect_s32_divide_cases);
+  RUN_TEST_CASE(vect_divide, vect_s32_divide_random);
+  RUN_TEST_CASE(vect_divide, vect_s32_divide_prepare);
+}
+
+TEST_GROUP(vect_divide);
+TEST_SETUP(vect_divide) { fflush(stdout); }
+TEST_TEAR_DOWN(vect_divide) {}
+
+
+#define MAX_LEN     64
+#define REPS        ((SMOKE_TEST)?100:1000)
+
+
+// round(b * 2^scale / c) with ties away from zero, for -8 <= scale <= 31
+static int32_t divide_s32(
+    const int32_t b,
+    const int32_t c,
+    const int scale)
+{
+    const int negative = (b < 0) != (c < 0);
+    uint64_t n = (b < 0)? -((int64_t) b) : b;
+    uint64_t d = (c < 0)? -((int64_t) c) : c;
+
+    if(n == 0) return 0;
+    if(d == 0) return negative? INT32_MIN : INT32_MAX;
+
+    if(scale >= 0)  n <<= scale;
+    else            d <<= -scale;
+
+    uint64_t q = n / d;
+    if(2 * (n % d) >= d) q++;
+
+    if(negative)    return (q >= 0x80000000ULL)? INT32_MIN : -((int64_t) q);
+    else            return (q >= 0x7FFFFFFFULL)? INT32_MAX : (int32_t) q;
+}
+
+
+TEST(vect_divide, vect_s32_divide_cases)
+{
+    typedef struct { int32_t b; int32_t c; int scale; int32_t expected; } case_t;
+
+    const case_t cases[] = {
+        {          3,          2,   0,          2 },
+        {         -3,          2,   0,         -2 },
+        {          5,          2,   0,          3 },
+        {          7,         -2,   0,         -4 },
+        {          1,          3,  30,  357913941 },
+        {          2,          3,  30,  715827883 },
+        { 0x40000000, 0x40000000,  30, 0x40000000 },
+        { 0x40000000,         -1,   0,-0x40000000 },
+        {  INT32_MIN,         -1,   0,  INT32_MAX },
+        {  INT32_MIN,          1,   0,  INT32_MIN },
+        {  INT32_MIN,  INT32_MIN,  30, 0x40000000 },
+        {  INT32_MAX,  INT32_MIN,  31, -INT32_MAX },
+        {          1,  INT32_MIN,   0,          0 },
+        {        100,          0,   0,  INT32_MAX },
+        {       -100,          0,   0,  INT32_MIN },
+        {          0,          0,   0,          0 },
+        {          0,        123,  20,          0 },
+        {  INT32_MAX,          1,   1,  INT32_MAX },
+        {  INT32_MAX,          1, 100,  INT32_MAX },
+        {  INT32_MAX,  INT32_MAX,-100,          0 },
+        {       1000,          8,  -2,         31 },
+        {       1004,          8,  -2,         31 },
+        {       1005,          8,  -2,         31 },
+        {       1006,          8,  -2,         31 },
+        {      -1008,          8,  -2,        -32 },
+    };
+
+    const unsigned count = sizeof(cases) / sizeof(cases[0]);
+
+    for(unsigned i = 0; i < count; i++){
+        int32_t a;
+        vect_s32_divide(&a, &cases[i].b, &cases[i].c, 1, cases[i].scale);
+        TEST_ASSERT_EQUAL_INT32(cases[i].expected, a);
+    }
+}
+
+
+TEST(vect_divide, vect_s32_divide_random)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t A[MAX_LEN];
+    int32_t B[MAX_LEN];
+    int32_t C[MAX_LEN];
+
+    for(unsigned int v = 0; v < REPS; v++){
+        setExtraInfo_RS(v, seed);
+
+        const unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const int scale = pseudo_rand_int(&seed, -8, 32);
+
+        for(unsigned int i = 0; i < length; i++){
+            B[i] = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 31);
+            C[i] = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 31);
+        }
+
+        const headroom_t hr = vect_s32_divide(A, B, C, length, scale);
+
+        TEST_ASSERT_EQUAL(vect_s32_headroom(A, length), hr);
+
+        for(unsigned int i = 0; i < length; i++)
+            TEST_ASSERT_EQUAL_INT32(divide_s32(B[i], C[i], scale), A[i]);
+
+        // In-place on the divisor
+        memcpy(A, C, sizeof(int32_t) * length);
+        vect_s32_divide(A, B, A, length, scale);
+
+        for(unsigned int i = 0; i < length; i++)
+            TEST_ASSERT_EQUAL_INT32(divide_s32(B[i], C[i], scale), A[i]);
+    }
+}
+
+
+TEST(vect_divide, vect_s32_divide_prepare)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t A[MAX_LEN];
+    int32_t B[MAX_LEN];
+    int32_t C[MAX_LEN];
+
+    for(unsigned int v = 0; v < REPS; v++){
+        setExtraInfo_RS(v, seed);
+
+        const unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const exponent_t b_exp = pseudo_rand_int(&seed, -30, 30);
+        const exponent_t c_exp = pseudo_rand_int(&seed, -30, 30);
+        const headroom_t b_shr = pseudo_rand_uint(&seed, 0, 28);
+        const headroom_t c_shr = pseudo_rand_uint(&seed, 0, 28);
+
+        for(unsigned int i = 0; i < length; i++){
+            B[i] = pseudo_rand_int32(&seed) >> b_shr;
+            C[i] = pseudo_rand_int32(&seed) >> c_shr;
+        }
+
+        // A zero divisor must not affect the output exponent
+        C[pseudo_rand_uint(&seed, 0, length)] = 0;
+
+        exponent_t a_exp;
+        left_shift_t scale;
+        vect_s32_divide_prepare(&a_exp, &scale, b_exp, vect_s32_headroom(B, length), C, c_exp, length);
+
+        TEST_ASSERT_EQUAL_INT(b_exp - c_exp - scale, a_exp);
+
+        vect_s32_divide(A, B, C, length, scale);
+
+        for(unsigned int i = 0; i < length; i++){
+            if(C[i] == 0)
+                continue;
+
+            // No saturation, and the result is the correctly rounded quotient
+            TEST_ASSERT(A[i] != INT32_MAX && A[i] != INT32_MIN);
+
+            const double expected = ldexp(B[i], b_exp) / ldexp(C[i], c_exp);
+            const double delta = fabs(ldexp(A[i], a_exp) - expected);
+            TEST_ASSERT(delta <= ldexp(0.5, a_exp));
+        }
+    }
+}
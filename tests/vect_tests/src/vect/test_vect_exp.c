@@ -16,6 +16,8 @@
 TEST_GROUP_RUNNER(vect_exp) {
   RUN_TEST_CASE(vect_exp, chunk_q30_exp_small_RANDOM);
   RUN_TEST_CASE(vect_exp, vect_q30_exp_small_RANDOM);
+  RUN_TEST_CASE(vect_exp, vect_s32_exp_RANDOM);
+  RUN_TEST_CASE(vect_exp, vect_float_s32_exp_RANDOM);
 }
 
 TEST_GROUP(vect_exp);
@@ -153,3 +155,77 @@ TEST(vect_exp, vect_q30_exp_small_RANDOM)
   // printf("Max max error: %u\n", max_max_error);
 }
 
+
+
+TEST(vect_exp, vect_s32_exp_RANDOM)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN];
+  int32_t A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+    // Inputs span roughly (-16, 16)
+    const exponent_t b_exp = -27 - (int) pseudo_rand_uint(&seed, 0, 8);
+
+    for(unsigned int i = 0; i < length; i++){
+      B[i] = pseudo_rand_int32(&seed);
+    }
+
+    exponent_t a_exp;
+    headroom_t hr = vect_s32_exp(A, &a_exp, B, b_exp, length);
+
+    TEST_ASSERT_EQUAL(vect_s32_headroom(A, length), hr);
+
+    double max_expected = 0;
+    for(unsigned int i = 0; i < length; i++)
+      max_expected = fmax(max_expected, exp(ldexp(B[i], b_exp)));
+
+    for(unsigned int i = 0; i < length; i++){
+      double expected = exp(ldexp(B[i], b_exp));
+      double result = ldexp(A[i], a_exp);
+
+      // Error relative to the largest output, which sets the output exponent.
+      TEST_ASSERT_INT32_WITHIN(8, 0, (int32_t) ((expected - result) / ldexp(1, a_exp)));
+    }
+
+    // The largest output should not be left with excess headroom.
+    TEST_ASSERT_LESS_OR_EQUAL(1, hr);
+    TEST_ASSERT_TRUE(max_expected < ldexp(1, a_exp + 31));
+  }
+}
+
+
+
+TEST(vect_exp, vect_float_s32_exp_RANDOM)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  float_s32_t B[MAX_LEN];
+  float_s32_t A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+    for(unsigned int i = 0; i < length; i++){
+      B[i].mant = pseudo_rand_int32(&seed) >> pseudo_rand_uint(&seed, 0, 8);
+      B[i].exp = -27 - (int) pseudo_rand_uint(&seed, 0, 20);
+    }
+
+    vect_float_s32_exp(A, B, length);
+
+    for(unsigned int i = 0; i < length; i++){
+      double expected = exp(ldexp(B[i].mant, B[i].exp));
+      double result = ldexp(A[i].mant, A[i].exp);
+
+      // Relative error, in units of 2^-29
+      TEST_ASSERT_INT32_WITHIN(8, 0, (int32_t) ldexp((result - expected) / expected, 29));
+    }
+  }
+}
@@ -0,0 +1,279 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include "xmath/xmath.h"
+#include "../tst_common.h"
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(vect_float_s32) {
+  RUN_TEST_CASE(vect_float_s32, vect_float_s32_mul);
+  RUN_TEST_CASE(vect_float_s32, vect_float_s32_add_sub);
+  RUN_TEST_CASE(vect_float_s32, vect_float_s32_macc);
+  RUN_TEST_CASE(vect_float_s32, vect_float_s32_ema);
+  RUN_TEST_CASE(vect_float_s32, vect_float_s32_compare);
+  RUN_TEST_CASE(vect_float_s32, vect_float_s32_compare_lsb);
+}
+
+TEST_GROUP(vect_float_s32);
+TEST_SETUP(vect_float_s32) { fflush(stdout); }
+TEST_TEAR_DOWN(vect_float_s32) {}
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+// Elements with independent exponents spanning a wide range, with some zeros and some
+// elements at full scale.
+static float_s32_t rand_float_s32(
+    unsigned* seed)
+{
+  float_s32_t res;
+  res.mant = pseudo_rand_int32(seed) >> pseudo_rand_uint(seed, 0, 28);
+  res.exp = pseudo_rand_int(seed, -60, 20);
+  switch(pseudo_rand_uint(seed, 0, 16)){
+    case 0: res.mant = 0; break;
+    case 1: res.mant = INT32_MIN; break;
+    case 2: res.mant = INT32_MAX; break;
+    default: break;
+  }
+  return res;
+}
+
+static void rand_vect_float_s32(
+    float_s32_t a[],
+    const unsigned length,
+    unsigned* seed)
+{
+  for(unsigned k = 0; k < length; k++)
+    a[k] = rand_float_s32(seed);
+}
+
+// Exact in double precision, for the mantissas and exponents generated here
+static double dbl_float_s32(
+    const float_s32_t x)
+{
+  return ldexp(x.mant, x.exp);
+}
+
+#define TEST_ASSERT_EQUAL_FLOAT_S32(EXPECTED, ACTUAL)     do {                    \
+    TEST_ASSERT_EQUAL_INT32((EXPECTED).mant, (ACTUAL).mant);                      \
+    TEST_ASSERT_EQUAL_INT32((EXPECTED).exp, (ACTUAL).exp);                        \
+  } while(0)
+
+
+TEST(vect_float_s32, vect_float_s32_mul)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  float_s32_t A[MAX_LEN];
+  float_s32_t B[MAX_LEN];
+  float_s32_t C[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_float_s32(B, len, &seed);
+    rand_vect_float_s32(C, len, &seed);
+
+    vect_float_s32_mul(A, B, C, len);
+    for(unsigned k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT_S32(float_s32_mul(B[k], C[k]), A[k]);
+
+    vect_float_s32_scale(A, B, C[0], len);
+    for(unsigned k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT_S32(float_s32_mul(B[k], C[0]), A[k]);
+  }
+}
+
+
+TEST(vect_float_s32, vect_float_s32_add_sub)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  float_s32_t A[MAX_LEN];
+  float_s32_t B[MAX_LEN];
+  float_s32_t C[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_float_s32(B, len, &seed);
+    rand_vect_float_s32(C, len, &seed);
+
+    vect_float_s32_add(A, B, C, len);
+    for(unsigned k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT_S32(float_s32_add(B[k], C[k]), A[k]);
+
+    vect_float_s32_sub(A, B, C, len);
+    for(unsigned k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT_S32(float_s32_sub(B[k], C[k]), A[k]);
+  }
+}
+
+
+TEST(vect_float_s32, vect_float_s32_macc)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  float_s32_t acc[MAX_LEN];
+  float_s32_t expected[MAX_LEN];
+  float_s32_t B[MAX_LEN];
+  float_s32_t C[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_float_s32(acc, len, &seed);
+    rand_vect_float_s32(B, len, &seed);
+    rand_vect_float_s32(C, len, &seed);
+
+    for(unsigned k = 0; k < len; k++)
+      expected[k] = float_s32_add(acc[k], float_s32_mul(B[k], C[k]));
+
+    vect_float_s32_macc(acc, B, C, len);
+
+    for(unsigned k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT_S32(expected[k], acc[k]);
+  }
+}
+
+
+TEST(vect_float_s32, vect_float_s32_ema)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  float_s32_t acc[MAX_LEN];
+  float_s32_t expected[MAX_LEN];
+  float_s32_t B[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    const uq2_30 coef = pseudo_rand_uint(&seed, 0, 0x40000001);
+
+    rand_vect_float_s32(acc, len, &seed);
+
+    for(unsigned k = 0; k < len; k++)
+      expected[k] = acc[k];
+
+    // Several updates, as a running noise estimate would see
+    for(int t = 0; t < 4; t++){
+      rand_vect_float_s32(B, len, &seed);
+
+      for(unsigned k = 0; k < len; k++)
+        expected[k] = float_s32_ema(expected[k], B[k], coef);
+
+      vect_float_s32_ema(acc, B, coef, len);
+
+      for(unsigned k = 0; k < len; k++)
+        TEST_ASSERT_EQUAL_FLOAT_S32(expected[k], acc[k]);
+    }
+  }
+}
+
+
+TEST(vect_float_s32, vect_float_s32_compare)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int8_t gt[MAX_LEN];
+  float_s32_t A[MAX_LEN];
+  float_s32_t B[MAX_LEN];
+  float_s32_t C[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+    setExtraInfo_RSL(v, old_seed, len);
+
+    rand_vect_float_s32(B, len, &seed);
+    rand_vect_float_s32(C, len, &seed);
+
+    // Some equal elements
+    for(unsigned k = 0; k < len; k += 7)
+      C[k] = B[k];
+
+    vect_float_s32_gt(gt, B, C, len);
+    for(unsigned k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_INT8(dbl_float_s32(B[k]) > dbl_float_s32(C[k]), gt[k]);
+
+    vect_float_s32_max_elementwise(A, B, C, len);
+    for(unsigned k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT_S32((dbl_float_s32(B[k]) >= dbl_float_s32(C[k]))? B[k] : C[k], A[k]);
+
+    vect_float_s32_min_elementwise(A, B, C, len);
+    for(unsigned k = 0; k < len; k++)
+      TEST_ASSERT_EQUAL_FLOAT_S32((dbl_float_s32(B[k]) <= dbl_float_s32(C[k]))? B[k] : C[k], A[k]);
+  }
+}
+
+
+// Values which differ by one LSB, at equal exponents and at exponents which differ
+TEST(vect_float_s32, vect_float_s32_compare_lsb)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int8_t gt[2];
+  float_s32_t A[2];
+  float_s32_t B[2];
+  float_s32_t C[2];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned old_seed = seed;
+    setExtraInfo_RSL(v, old_seed, 2);
+
+    // C[0] has the same exponent as B[0], and C[1] an exponent which is `shl` smaller. The
+    // mantissas of C have (almost) no headroom, so that the LSB is significant.
+    const right_shift_t shl = pseudo_rand_uint(&seed, 1, 8);
+    const int32_t delta = pseudo_rand_uint(&seed, 0, 2)? 1 : -1;
+    const int32_t mant0 = MAX(-INT32_MAX + 1, MIN(INT32_MAX - 1, pseudo_rand_int32(&seed)));
+    const int32_t mant1 = pseudo_rand_int32(&seed) >> shl;
+    B[0].mant = mant0;
+    B[1].mant = mant1;
+    B[0].exp = B[1].exp = pseudo_rand_int(&seed, -60, 20);
+    C[0].mant = mant0 + delta;
+    C[0].exp = B[0].exp;
+    C[1].mant = mant1 * (1 << shl) + delta;
+    C[1].exp = B[1].exp - shl;
+
+    // Each pair is also compared the other way round
+    for(int swap = 0; swap < 2; swap++){
+      const float_s32_t* b = swap? C : B;
+      const float_s32_t* c = swap? B : C;
+      const int b_gt = swap? (delta > 0) : (delta < 0);
+
+      vect_float_s32_gt(gt, b, c, 2);
+      TEST_ASSERT_EQUAL_INT8(b_gt, gt[0]);
+      TEST_ASSERT_EQUAL_INT8(b_gt, gt[1]);
+
+      vect_float_s32_max_elementwise(A, b, c, 2);
+      TEST_ASSERT_EQUAL_FLOAT_S32(b_gt? b[0] : c[0], A[0]);
+      TEST_ASSERT_EQUAL_FLOAT_S32(b_gt? b[1] : c[1], A[1]);
+
+      vect_float_s32_min_elementwise(A, b, c, 2);
+      TEST_ASSERT_EQUAL_FLOAT_S32(b_gt? c[0] : b[0], A[0]);
+      TEST_ASSERT_EQUAL_FLOAT_S32(b_gt? c[1] : b[1], A[1]);
+    }
+  }
+}
@@ -7,6 +7,7 @@
 #include <string.h>
 #include <assert.h>
 #include <stdarg.h>
+#include <math.h>
 
 #include "xmath/xmath.h"
 
@@ -22,6 +23,7 @@ TEST_GROUP_RUNNER(vect_sqrt) {
   RUN_TEST_CASE(vect_sqrt, vect_s16_sqrt_B);
   RUN_TEST_CASE(vect_sqrt, vect_s32_sqrt_A);
   RUN_TEST_CASE(vect_sqrt, vect_s32_sqrt_B);
+  RUN_TEST_CASE(vect_sqrt, vect_s32_sqrt_fast);
 }
 
 TEST_GROUP(vect_sqrt);
@@ -380,3 +382,57 @@ TEST(vect_sqrt, vect_s32_sqrt_B)
     }
 }
 
+
+
+TEST(vect_sqrt, vect_s32_sqrt_fast)
+{
+
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    // Documented error bound for each number of iterations, as relative error plus LSbs.
+    const double rel_tol[] = { 0x1p-7, 0x1p-13, 0x1p-20, 0.0 };
+    const double abs_tol[] = { 1.0, 1.0, 1.0, 2.0 };
+
+    int32_t B[MAX_LEN];
+    int32_t A[MAX_LEN];
+
+    for(unsigned int v = 0; v < REPS; v++){
+        setExtraInfo_RS(v, seed);
+
+        const unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN-1);
+        const unsigned iterations = v % 4;
+
+        const exponent_t b_exp = pseudo_rand_int(&seed, -30, 30);
+        headroom_t b_hr = pseudo_rand_uint(&seed, 0, 28);
+
+        for(unsigned int i = 0; i < length; i++){
+            B[i] = pseudo_rand_int32(&seed) >> b_hr;
+        }
+
+        b_hr = vect_s32_headroom(B, length);
+
+        exponent_t a_exp;
+        right_shift_t b_shr;
+
+        vect_s32_sqrt_prepare(&a_exp, &b_shr, b_exp, b_hr);
+
+        const headroom_t a_hr = vect_s32_sqrt_fast(A, B, length, b_shr, iterations);
+
+        TEST_ASSERT_EQUAL(vect_s32_headroom(A, length), a_hr);
+
+        for(unsigned int i = 0; i < length; i++){
+
+            const int32_t target = vlashr32(B[i], b_shr);
+
+            if(target <= 0){
+                TEST_ASSERT_EQUAL_INT32(0, A[i]);
+                continue;
+            }
+
+            const double expected = sqrt(ldexp(target, 30));
+            const double delta = fabs(A[i] - expected);
+
+            TEST_ASSERT(delta <= expected * rel_tol[iterations] + abs_tol[iterations]);
+        }
+    }
+}
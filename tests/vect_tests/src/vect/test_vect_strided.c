@@ -0,0 +1,399 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "xmath/xmath.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(vect_strided) {
+  RUN_TEST_CASE(vect_strided, vect_s32_copy_strided);
+  RUN_TEST_CASE(vect_strided, vect_s32_headroom_strided);
+  RUN_TEST_CASE(vect_strided, vect_s32_shl_strided);
+  RUN_TEST_CASE(vect_strided, vect_s32_add_strided);
+  RUN_TEST_CASE(vect_strided, vect_s32_mul_strided);
+  RUN_TEST_CASE(vect_strided, vect_s32_scale_strided);
+  RUN_TEST_CASE(vect_strided, vect_s32_macc_strided);
+  RUN_TEST_CASE(vect_strided, vect_s32_dot_strided);
+  RUN_TEST_CASE(vect_strided, vect_s32_energy_strided);
+  RUN_TEST_CASE(vect_strided, vect_s32_sum_strided);
+}
+
+TEST_GROUP(vect_strided);
+TEST_SETUP(vect_strided) { fflush(stdout); }
+TEST_TEAR_DOWN(vect_strided) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (50)
+#else
+#  define REPS       (500)
+#endif
+
+#define MAX_LEN       (100)
+#define MAX_STRIDE    (5)
+
+
+/*
+ * Each strided function must produce results identical to its contiguous counterpart applied to
+ * the de-interleaved data. Operands are filled with random data for all "channels" so that any
+ * out-of-channel reads or writes are caught.
+ */
+
+static unsigned seed_state;
+
+static unsigned rand_stride()
+{
+  return pseudo_rand_uint(&seed_state, 1, MAX_STRIDE+1);
+}
+
+static void fill_random(
+    int32_t buff[],
+    const unsigned count)
+{
+  const headroom_t hr = pseudo_rand_uint(&seed_state, 0, 8);
+  for(unsigned k = 0; k < count; k++)
+    buff[k] = pseudo_rand_int32(&seed_state) >> hr;
+}
+
+static void gather_ref(
+    int32_t dst[],
+    const int32_t src[],
+    const unsigned stride,
+    const unsigned length)
+{
+  for(unsigned k = 0; k < length; k++)
+    dst[k] = src[k*stride];
+}
+
+static void check_strided(
+    const int32_t expected[],
+    const int32_t actual[],
+    const unsigned stride,
+    const unsigned length,
+    const int32_t original[])
+{
+  for(unsigned k = 0; k < length * stride; k++){
+    if(k % stride == 0)
+      TEST_ASSERT_EQUAL_INT32(expected[k/stride], actual[k]);
+    else
+      TEST_ASSERT_EQUAL_INT32(original[k], actual[k]);
+  }
+}
+
+
+TEST(vect_strided, vect_s32_copy_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t A[MAX_LEN * MAX_STRIDE];
+  int32_t A_orig[MAX_LEN * MAX_STRIDE];
+  int32_t expected[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned a_stride = rand_stride();
+    const unsigned b_stride = rand_stride();
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+    fill_random(A_orig, length * a_stride);
+    memcpy(A, A_orig, sizeof(A));
+
+    gather_ref(expected, B, b_stride, length);
+
+    headroom_t hr = vect_s32_copy_strided(A, a_stride, B, b_stride, length);
+
+    check_strided(expected, A, a_stride, length, A_orig);
+    TEST_ASSERT_EQUAL(vect_s32_headroom(expected, length), hr);
+  }
+}
+
+
+TEST(vect_strided, vect_s32_headroom_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t B_c[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned b_stride = rand_stride();
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+
+    // Make the other channels much larger so they would dominate if read
+    const headroom_t hr = pseudo_rand_uint(&seed_state, 2, 20);
+    for(unsigned k = 0; k < length * b_stride; k++)
+      B[k] = (k % b_stride)? 0x7FFFFFFF : (B[k] >> hr);
+
+    gather_ref(B_c, B, b_stride, length);
+
+    TEST_ASSERT_EQUAL(vect_s32_headroom(B_c, length), vect_s32_headroom_strided(B, b_stride, length));
+  }
+}
+
+
+TEST(vect_strided, vect_s32_shl_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t A[MAX_LEN * MAX_STRIDE];
+  int32_t A_orig[MAX_LEN * MAX_STRIDE];
+  int32_t B_c[MAX_LEN];
+  int32_t expected[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned a_stride = rand_stride();
+    const unsigned b_stride = rand_stride();
+    const left_shift_t shl = pseudo_rand_int(&seed_state, -10, 10);
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+    fill_random(A_orig, length * a_stride);
+    memcpy(A, A_orig, sizeof(A));
+
+    gather_ref(B_c, B, b_stride, length);
+    headroom_t exp_hr = vect_s32_shl(expected, B_c, length, shl);
+
+    headroom_t hr = vect_s32_shl_strided(A, a_stride, B, b_stride, length, shl);
+
+    check_strided(expected, A, a_stride, length, A_orig);
+    TEST_ASSERT_EQUAL(exp_hr, hr);
+  }
+}
+
+
+TEST(vect_strided, vect_s32_add_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t C[MAX_LEN * MAX_STRIDE];
+  int32_t A[MAX_LEN * MAX_STRIDE];
+  int32_t A_orig[MAX_LEN * MAX_STRIDE];
+  int32_t B_c[MAX_LEN];
+  int32_t C_c[MAX_LEN];
+  int32_t expected[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned a_stride = rand_stride();
+    const unsigned b_stride = rand_stride();
+    const unsigned c_stride = rand_stride();
+    const right_shift_t b_shr = pseudo_rand_int(&seed_state, -2, 4);
+    const right_shift_t c_shr = pseudo_rand_int(&seed_state, -2, 4);
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+    fill_random(C, length * c_stride);
+    fill_random(A_orig, length * a_stride);
+    memcpy(A, A_orig, sizeof(A));
+
+    gather_ref(B_c, B, b_stride, length);
+    gather_ref(C_c, C, c_stride, length);
+    headroom_t exp_hr = vect_s32_add(expected, B_c, C_c, length, b_shr, c_shr);
+
+    headroom_t hr = vect_s32_add_strided(A, a_stride, B, b_stride, C, c_stride, length, b_shr, c_shr);
+
+    check_strided(expected, A, a_stride, length, A_orig);
+    TEST_ASSERT_EQUAL(exp_hr, hr);
+  }
+}
+
+
+TEST(vect_strided, vect_s32_mul_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t C[MAX_LEN * MAX_STRIDE];
+  int32_t A[MAX_LEN * MAX_STRIDE];
+  int32_t A_orig[MAX_LEN * MAX_STRIDE];
+  int32_t B_c[MAX_LEN];
+  int32_t C_c[MAX_LEN];
+  int32_t expected[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned a_stride = rand_stride();
+    const unsigned b_stride = rand_stride();
+    const unsigned c_stride = rand_stride();
+    const right_shift_t b_shr = pseudo_rand_int(&seed_state, -2, 4);
+    const right_shift_t c_shr = pseudo_rand_int(&seed_state, -2, 4);
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+    fill_random(C, length * c_stride);
+    fill_random(A_orig, length * a_stride);
+    memcpy(A, A_orig, sizeof(A));
+
+    gather_ref(B_c, B, b_stride, length);
+    gather_ref(C_c, C, c_stride, length);
+    headroom_t exp_hr = vect_s32_mul(expected, B_c, C_c, length, b_shr, c_shr);
+
+    headroom_t hr = vect_s32_mul_strided(A, a_stride, B, b_stride, C, c_stride, length, b_shr, c_shr);
+
+    check_strided(expected, A, a_stride, length, A_orig);
+    TEST_ASSERT_EQUAL(exp_hr, hr);
+  }
+}
+
+
+TEST(vect_strided, vect_s32_scale_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t A[MAX_LEN * MAX_STRIDE];
+  int32_t A_orig[MAX_LEN * MAX_STRIDE];
+  int32_t B_c[MAX_LEN];
+  int32_t expected[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned a_stride = rand_stride();
+    const unsigned b_stride = rand_stride();
+    const int32_t c = pseudo_rand_int32(&seed_state);
+    const right_shift_t b_shr = pseudo_rand_int(&seed_state, -2, 4);
+    const right_shift_t c_shr = pseudo_rand_int(&seed_state, 0, 4);
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+    fill_random(A_orig, length * a_stride);
+    memcpy(A, A_orig, sizeof(A));
+
+    gather_ref(B_c, B, b_stride, length);
+    headroom_t exp_hr = vect_s32_scale(expected, B_c, length, c, b_shr, c_shr);
+
+    headroom_t hr = vect_s32_scale_strided(A, a_stride, B, b_stride, length, c, b_shr, c_shr);
+
+    check_strided(expected, A, a_stride, length, A_orig);
+    TEST_ASSERT_EQUAL(exp_hr, hr);
+  }
+}
+
+
+TEST(vect_strided, vect_s32_macc_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t C[MAX_LEN * MAX_STRIDE];
+  int32_t A[MAX_LEN * MAX_STRIDE];
+  int32_t A_orig[MAX_LEN * MAX_STRIDE];
+  int32_t B_c[MAX_LEN];
+  int32_t C_c[MAX_LEN];
+  int32_t expected[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned a_stride = rand_stride();
+    const unsigned b_stride = rand_stride();
+    const unsigned c_stride = rand_stride();
+    const right_shift_t acc_shr = pseudo_rand_int(&seed_state, 0, 4);
+    const right_shift_t b_shr = pseudo_rand_int(&seed_state, -2, 4);
+    const right_shift_t c_shr = pseudo_rand_int(&seed_state, -2, 4);
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+    fill_random(C, length * c_stride);
+    fill_random(A_orig, length * a_stride);
+    memcpy(A, A_orig, sizeof(A));
+
+    gather_ref(expected, A, a_stride, length);
+    gather_ref(B_c, B, b_stride, length);
+    gather_ref(C_c, C, c_stride, length);
+    headroom_t exp_hr = vect_s32_macc(expected, B_c, C_c, length, acc_shr, b_shr, c_shr);
+
+    headroom_t hr = vect_s32_macc_strided(A, a_stride, B, b_stride, C, c_stride, length,
+                                          acc_shr, b_shr, c_shr);
+
+    check_strided(expected, A, a_stride, length, A_orig);
+    TEST_ASSERT_EQUAL(exp_hr, hr);
+  }
+}
+
+
+TEST(vect_strided, vect_s32_dot_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t C[MAX_LEN * MAX_STRIDE];
+  int32_t B_c[MAX_LEN];
+  int32_t C_c[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned b_stride = rand_stride();
+    const unsigned c_stride = rand_stride();
+    const right_shift_t b_shr = pseudo_rand_int(&seed_state, 0, 4);
+    const right_shift_t c_shr = pseudo_rand_int(&seed_state, 0, 4);
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+    fill_random(C, length * c_stride);
+
+    gather_ref(B_c, B, b_stride, length);
+    gather_ref(C_c, C, c_stride, length);
+
+    TEST_ASSERT_EQUAL_INT64(vect_s32_dot(B_c, C_c, length, b_shr, c_shr),
+                            vect_s32_dot_strided(B, b_stride, C, c_stride, length, b_shr, c_shr));
+  }
+}
+
+
+TEST(vect_strided, vect_s32_energy_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t B_c[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned b_stride = rand_stride();
+    const right_shift_t b_shr = pseudo_rand_int(&seed_state, 0, 4);
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+    gather_ref(B_c, B, b_stride, length);
+
+    TEST_ASSERT_EQUAL_INT64(vect_s32_energy(B_c, length, b_shr),
+                            vect_s32_energy_strided(B, b_stride, length, b_shr));
+  }
+}
+
+
+TEST(vect_strided, vect_s32_sum_strided)
+{
+  seed_state = SEED_FROM_FUNC_NAME();
+
+  int32_t B[MAX_LEN * MAX_STRIDE];
+  int32_t B_c[MAX_LEN];
+
+  for(int v = 0; v < REPS; v++){
+    const unsigned length = pseudo_rand_uint(&seed_state, 1, MAX_LEN+1);
+    const unsigned b_stride = rand_stride();
+    setExtraInfo_RSL(v, seed_state, length);
+
+    fill_random(B, length * b_stride);
+    gather_ref(B_c, B, b_stride, length);
+
+    TEST_ASSERT_EQUAL_INT64(vect_s32_sum(B_c, length),
+                            vect_s32_sum_strided(B, b_stride, length));
+  }
+}
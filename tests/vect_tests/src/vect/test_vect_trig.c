@@ -0,0 +1,155 @@
+// Copyright 2026 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xmath/xmath.h"
+#include "../tst_common.h"
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(vect_trig) {
+  RUN_TEST_CASE(vect_trig, vect_sbrad_sin);
+  RUN_TEST_CASE(vect_trig, vect_s32_sin);
+  RUN_TEST_CASE(vect_trig, vect_s32_cos);
+  RUN_TEST_CASE(vect_trig, vect_s32_tan);
+}
+
+TEST_GROUP(vect_trig);
+TEST_SETUP(vect_trig) { fflush(stdout); }
+TEST_TEAR_DOWN(vect_trig) {}
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+TEST(vect_trig, vect_sbrad_sin)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  sbrad_t B[MAX_LEN];
+  q2_30 A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+    for(unsigned int i = 0; i < length; i++)
+      B[i] = pseudo_rand_int32(&seed);
+
+    // Include the end points
+    B[0] = INT32_MIN;
+    B[length-1] = INT32_MAX;
+
+    vect_sbrad_sin(A, B, length);
+
+    for(unsigned int i = 0; i < length; i++){
+      double expected = sin(M_PI / 2 * ldexp(B[i], -31));
+      TEST_ASSERT_INT32_WITHIN(4, llround(ldexp(expected, 30)), A[i]);
+      // Must agree with the scalar version (which is slightly less accurate near the peaks, and
+      // does not handle -1)
+      if(B[i] != INT32_MIN)
+        TEST_ASSERT_INT32_WITHIN(128, sbrad_sin(B[i]), A[i]);
+    }
+  }
+}
+
+
+TEST(vect_trig, vect_s32_sin)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  radian_q24_t B[MAX_LEN];
+  q2_30 A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+    for(unsigned int i = 0; i < length; i++)
+      B[i] = pseudo_rand_int32(&seed);
+
+    memcpy(A, B, sizeof(int32_t) * length);
+    vect_s32_sin(A, A, length);
+
+    for(unsigned int i = 0; i < length; i++){
+      double expected = sin(ldexp(B[i], -24));
+      TEST_ASSERT_INT32_WITHIN(300, llround(ldexp(expected, 30)), A[i]);
+      TEST_ASSERT_INT32_WITHIN(128, q24_sin(B[i]), A[i]);
+    }
+  }
+}
+
+
+TEST(vect_trig, vect_s32_cos)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  radian_q24_t B[MAX_LEN];
+  q2_30 A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+    for(unsigned int i = 0; i < length; i++)
+      B[i] = pseudo_rand_int32(&seed);
+
+    vect_s32_cos(A, B, length);
+
+    for(unsigned int i = 0; i < length; i++){
+      double expected = cos(ldexp(B[i], -24));
+      TEST_ASSERT_INT32_WITHIN(300, llround(ldexp(expected, 30)), A[i]);
+      TEST_ASSERT_INT32_WITHIN(128, q24_cos(B[i]), A[i]);
+    }
+  }
+}
+
+
+TEST(vect_trig, vect_s32_tan)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  radian_q24_t B[MAX_LEN];
+  float_s32_t A[MAX_LEN];
+
+  for(unsigned int v = 0; v < REPS; v++){
+    setExtraInfo_RS(v, seed);
+
+    unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+    // Keep away from the poles, where the input quantization dominates.
+    for(unsigned int i = 0; i < length; i++){
+      double theta;
+      do {
+        B[i] = pseudo_rand_int32(&seed) >> 2;
+        theta = ldexp(B[i], -24);
+      } while(fabs(cos(theta)) < 0.01);
+    }
+
+    vect_s32_tan(A, B, length);
+
+    for(unsigned int i = 0; i < length; i++){
+      double expected = tan(ldexp(B[i], -24));
+      double result = ldexp(A[i].mant, A[i].exp);
+      float_s32_t q24_res = q24_tan(B[i]);
+      double q24 = ldexp(q24_res.mant, q24_res.exp);
+
+      // Relative error, in parts per million
+      TEST_ASSERT_INT32_WITHIN(100, 0, (int32_t) (1e6 * (result - expected) / fmax(1, fabs(expected))));
+      TEST_ASSERT_INT32_WITHIN(10, 0, (int32_t) (1e6 * (result - q24) / fmax(1, fabs(q24))));
+    }
+  }
+}